@@ -0,0 +1,63 @@
+/**
+ * @file rti_bridge.h
+ * @author CYK-Dot
+ * @brief Bridge forwarding every message of one VLAN to another.
+ * @version 0.1
+ * @date 2026-10-16
+ *
+ * @copyright Copyright (c) 2025 CYK-Dot, MIT License.
+ */
+#pragma once
+
+/* Header import ------------------------------------------------------------------*/
+#include <stdbool.h>
+#include "rti_internal.h"
+#include "rti_vlan.h"
+
+/* Config macros -----------------------------------------------------------------*/
+
+/* Export macros -----------------------------------------------------------------*/
+
+/* Exported typedef --------------------------------------------------------------*/
+
+/**
+ * @brief Routing function of a bridge, may change the destination lane.
+ * @note lane is the source lane on entry. return false to drop the message.
+ *       it runs in producer context of the source VLAN when forwarding inline.
+ *       a source other than built-in queue does not report lanes, lane is 0 on entry.
+ */
+typedef bool (*RTI_BridgeRouteFptr)(const void *msg, size_t size, uint8_t *lane, void *arg);
+
+/**
+ * @brief Bridge configuration.
+ *
+ */
+typedef struct {
+    RTI_VlanId srcVlan;                 /* VLAN the bridge consumes */
+    RTI_VlanId dstVlan;                 /* VLAN the bridge produces to */
+    uint32_t batch;                     /* maximum messages moved by one poll, 0 means 1 */
+    uint32_t msgSizeMax;                /* bridge buffer size, only used if a VLAN is not a built-in queue */
+    bool inlineForward;                 /* forward RTI_QueueSend() of srcVlan in producer context */
+    RTI_BridgeRouteFptr routeF;         /* optional, NULL forwards everything to the same lane */
+    void *routeArg;
+} RTI_BRIDGE_CFG;
+
+typedef struct rti_bridge RTI_BRIDGE;
+
+/* C++ ---------------------------------------------------------------------------*/
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Exported function -------------------------------------------------------------*/
+
+/* RTI exported functions */
+RTI_ERR RTI_BridgeCreate(const RTI_BRIDGE_CFG *cfg, RTI_BRIDGE **bridgeOut);
+void RTI_BridgeDelete(RTI_BRIDGE *bridge);
+RTI_ERR RTI_BridgePoll(RTI_BRIDGE *bridge, size_t *movedOut);
+bool RTI_BridgeIsInline(const RTI_BRIDGE *bridge);
+
+/* C++ ---------------------------------------------------------------------------*/
+#ifdef __cplusplus
+}
+#endif
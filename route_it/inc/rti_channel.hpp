@@ -0,0 +1,197 @@
+/**
+ * @file rti_channel.hpp
+ * @author CYK-Dot
+ * @brief C++17 typed channels of VLANs, bound to their VLAN ID and backend at compile time.
+ * @version 0.1
+ * @date 2026-10-16
+ *
+ * @copyright Copyright (c) 2025 CYK-Dot, MIT License.
+ */
+#pragma once
+
+/* Header import ------------------------------------------------------------------*/
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+#include "rti_vlan.h"
+#include "rti_queue.h"
+
+/* Exported typedef --------------------------------------------------------------*/
+
+namespace rti {
+
+/**
+ * @brief Backend of any VLAN, calls through the interface of its descriptor.
+ *
+ */
+struct DynamicBackend {
+    static bool Accepts(const RTI_VLAN_IFX *ifx, size_t msgSize) noexcept
+    {
+        (void)msgSize;
+        return ifx->sendF != nullptr && ifx->recvF != nullptr;
+    }
+
+    static RTI_ERR Send(const RTI_VLAN_IFX *ifx, void *producer, const void *msg, size_t size, uint8_t lane) noexcept
+    {
+        return ifx->sendF(producer, msg, size, lane);
+    }
+
+    static RTI_ERR Recv(const RTI_VLAN_IFX *ifx, void *consumer, void *msg, size_t *size) noexcept
+    {
+        return ifx->recvF(consumer, msg, size);
+    }
+};
+
+/**
+ * @brief Backend of built-in queues, calls the queue directly instead of through the interface.
+ * @note VLANs registered by RTI_QUEUE_IFX_DEFINE and its wrappers only.
+ */
+struct QueueBackend {
+    static bool Accepts(const RTI_VLAN_IFX *ifx, size_t msgSize) noexcept
+    {
+        // RTI_QUEUE_IFX starts with its RTI_VLAN_IFX
+        return ifx->sendF == &RTI_QueueSend && ifx->recvF == &RTI_QueueRecv &&
+               msgSize <= reinterpret_cast<const RTI_QUEUE_IFX *>(ifx)->cfg.msgSize;
+    }
+
+    static RTI_ERR Send(const RTI_VLAN_IFX *, void *producer, const void *msg, size_t size, uint8_t lane) noexcept
+    {
+        return RTI_QueueSend(producer, msg, size, lane);
+    }
+
+    static RTI_ERR Recv(const RTI_VLAN_IFX *, void *consumer, void *msg, size_t *size) noexcept
+    {
+        return RTI_QueueRecv(consumer, msg, size);
+    }
+};
+
+/**
+ * @brief Typed channel of VLAN VLAN_ID, carrying messages of Msg.
+ * @note the descriptor is resolved once, on first use of the channel type,
+ *       so a dynamic VLAN must be registered before. VLAN_ID is usually
+ *       a RTI_VLANID_xxx of the generated header.
+ *       with QueueBackend sends and receives are direct calls, which the compiler can inline.
+ */
+template <class Msg, RTI_VlanId VLAN_ID, class Backend = DynamicBackend>
+class Channel {
+    static_assert(std::is_trivially_copyable<Msg>::value, "messages are copied as bytes");
+
+public:
+    using MsgType = Msg;
+    static constexpr RTI_VlanId vlanId = VLAN_ID;
+
+    /**
+     * @brief Typed producer handle, see Channel::CreateProducer().
+     */
+    class Producer {
+    public:
+        RTI_ERR Send(const Msg &msg, uint8_t lane = 0) const noexcept
+        {
+            return Backend::Send(ifx_, handle_, &msg, sizeof(Msg), lane);
+        }
+
+        void *handle() const noexcept { return handle_; }
+
+    private:
+        friend class Channel;
+        const RTI_VLAN_IFX *ifx_ = nullptr;
+        void *handle_ = nullptr;
+    };
+
+    /**
+     * @brief Typed consumer handle, see Channel::CreateConsumer().
+     */
+    class Consumer {
+    public:
+        /**
+         * @brief Receive a message, RTI_ERR_INVALID_PARAM if the VLAN carried another size.
+         */
+        RTI_ERR Recv(Msg &msg) const noexcept
+        {
+            size_t size = sizeof(Msg);
+            RTI_ERR err = Backend::Recv(ifx_, handle_, &msg, &size);
+            if (err == RTI_OK && size != sizeof(Msg)) {
+                return RTI_ERR_INVALID_PARAM;
+            }
+            return err;
+        }
+
+        void *handle() const noexcept { return handle_; }
+
+    private:
+        friend class Channel;
+        const RTI_VLAN_IFX *ifx_ = nullptr;
+        void *handle_ = nullptr;
+    };
+
+    /**
+     * @brief Get the descriptor of the channel VLAN.
+     *
+     * @param descOut Pointer to store the descriptor.
+     * @return RTI_ERR RTI_ERR_NOT_SUPPORTED if Backend can not carry Msg on the VLAN.
+     */
+    static RTI_ERR Resolve(const RTI_VLAN_DESC **descOut) noexcept
+    {
+        static const Resolved resolved = ResolveOnce();
+        *descOut = &resolved.desc;
+        return resolved.err;
+    }
+
+    static RTI_ERR CreateProducer(Producer *producerOut) noexcept
+    {
+        const RTI_VLAN_DESC *desc = nullptr;
+        RTI_ERR err = Resolve(&desc);
+        if (err != RTI_OK) {
+            return err;
+        }
+        producerOut->handle_ = desc->ifx->createProducerF();
+        producerOut->ifx_ = desc->ifx;
+        return (producerOut->handle_ != nullptr) ? RTI_OK : RTI_ERR_FAILED;
+    }
+
+    static void DeleteProducer(Producer *producer) noexcept
+    {
+        if (producer->handle_ != nullptr) {
+            producer->ifx_->deleteProducerF(producer->handle_);
+            producer->handle_ = nullptr;
+        }
+    }
+
+    static RTI_ERR CreateConsumer(Consumer *consumerOut) noexcept
+    {
+        const RTI_VLAN_DESC *desc = nullptr;
+        RTI_ERR err = Resolve(&desc);
+        if (err != RTI_OK) {
+            return err;
+        }
+        consumerOut->handle_ = desc->ifx->createConsumerF();
+        consumerOut->ifx_ = desc->ifx;
+        return (consumerOut->handle_ != nullptr) ? RTI_OK : RTI_ERR_FAILED;
+    }
+
+    static void DeleteConsumer(Consumer *consumer) noexcept
+    {
+        if (consumer->handle_ != nullptr) {
+            consumer->ifx_->deleteConsumerF(consumer->handle_);
+            consumer->handle_ = nullptr;
+        }
+    }
+
+private:
+    struct Resolved {
+        RTI_VLAN_DESC desc;
+        RTI_ERR err;
+    };
+
+    static Resolved ResolveOnce() noexcept
+    {
+        Resolved resolved = {};
+        resolved.err = RTIPriv_VlanSelect(VLAN_ID, &resolved.desc);
+        if (resolved.err == RTI_OK && Backend::Accepts(resolved.desc.ifx, sizeof(Msg)) == false) {
+            resolved.err = RTI_ERR_NOT_SUPPORTED;
+        }
+        return resolved;
+    }
+};
+
+} // namespace rti
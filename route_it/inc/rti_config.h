@@ -9,4 +9,139 @@
  */
 #pragma once
 /* Config macros -----------------------------------------------------------------*/
-#define RTI_ENABLE_DYNAMIC_VLAN 1
\ No newline at end of file
+#define RTI_ENABLE_DYNAMIC_VLAN 1
+
+/**
+ * @brief Cache line size of target, used to separate hot atomics.
+ */
+#define RTI_CACHELINE_SIZE 64
+
+/**
+ * @brief Enable OS wait primitives (futex, eventfd), required by blocking modes
+ *        and pollable consumers.
+ */
+#ifndef RTI_ENABLE_OS_WAIT
+#if defined(__linux__)
+#define RTI_ENABLE_OS_WAIT 1
+#else
+#define RTI_ENABLE_OS_WAIT 0
+#endif
+#endif
+
+/**
+ * @brief Enable per-VLAN token bucket rate limiter of built-in queue backend,
+ *        it reads the monotonic clock of OS wait primitives.
+ */
+#ifndef RTI_ENABLE_RATE_LIMIT
+#define RTI_ENABLE_RATE_LIMIT RTI_ENABLE_OS_WAIT
+#endif
+
+/**
+ * @brief Enable NUMA placement of built-in queue memory by mbind(2),
+ *        see numaNode of RTI_QUEUE_CFG.
+ */
+#ifndef RTI_ENABLE_NUMA
+#define RTI_ENABLE_NUMA RTI_ENABLE_OS_WAIT
+#endif
+
+/**
+ * @brief Enable huge page backed memory of built-in queue, see RTI_QUEUE_MEM_HUGE.
+ */
+#ifndef RTI_ENABLE_HUGE_PAGES
+#define RTI_ENABLE_HUGE_PAGES RTI_ENABLE_OS_WAIT
+#endif
+
+/**
+ * @brief Huge page size of target, huge page backed queues are rounded up to it.
+ */
+#define RTI_HUGE_PAGE_SIZE (2u * 1024 * 1024)
+
+/**
+ * @brief Maximum count of priority lanes in built-in queue backend.
+ * @note lanes are selected by a 32bit ready mask, do not exceed 31,
+ *       its top bit marks messages in ISR mailboxes.
+ */
+#define RTI_QUEUE_LANES_MAX 8
+
+/**
+ * @brief Polls of an empty queue before a waiting consumer parks on OS wait.
+ */
+#define RTI_QUEUE_WAIT_SPIN 256
+
+/**
+ * @brief Recycled producers and consumers kept by each queue, must be power of 2.
+ * @note it also bounds the handle pool of a queue, see RTI_QueuePoolSet().
+ */
+#define RTI_QUEUE_HANDLE_CACHE 16
+
+/**
+ * @brief Maximum rule count of one routing table.
+ * @note matching rules are kept in a 64bit mask, do not exceed 64.
+ */
+#define RTI_ROUTE_RULES_MAX 64
+
+/**
+ * @brief Slot count of topic router match cache, must be power of 2.
+ */
+#define RTI_TOPIC_CACHE_SIZE 64
+
+/**
+ * @brief Maximum topic length and VLAN count kept by one cache slot,
+ *        results beyond them are not cached.
+ */
+#define RTI_TOPIC_CACHE_TOPIC_LEN 64
+#define RTI_TOPIC_CACHE_VLANS 8
+
+/**
+ * @brief Level count of hierarchical timer wheel and slot bits of each level.
+ * @note timers up to 2^(LEVELS*BITS) ticks ahead are placed directly,
+ *       farther timers are placed again when they come into range.
+ */
+#define RTI_TIMER_WHEEL_LEVELS 4
+#define RTI_TIMER_WHEEL_BITS 6
+
+/**
+ * @brief Maximum count of distinct VLANs one timer service posts to.
+ */
+#define RTI_TIMER_SERVICE_VLANS_MAX 8
+
+/**
+ * @brief Maximum count of distinct reply VLANs one RPC server answers to.
+ */
+#define RTI_RPC_SERVER_PEERS_MAX 8
+
+/**
+ * @brief Maximum count of VLANs one dispatcher group consumes.
+ */
+#define RTI_DISPATCH_VLANS_MAX 16
+
+/**
+ * @brief Maximum CPU number in affinity masks of dispatcher groups, multiple of 64.
+ */
+#define RTI_DISPATCH_CPUS_MAX 256
+
+/**
+ * @brief Enable shared-memory cross-process VLAN backend.
+ */
+#ifndef RTI_ENABLE_SHM
+#if defined(__linux__)
+#define RTI_ENABLE_SHM 1
+#else
+#define RTI_ENABLE_SHM 0
+#endif
+#endif
+
+/**
+ * @brief Maximum count of processes attached to one shared-memory VLAN.
+ */
+#define RTI_SHM_PEERS_MAX 16
+
+/**
+ * @brief Minimum interval of automatic dead peer recovery, in milliseconds.
+ */
+#define RTI_SHM_RECOVER_INTERVAL_MS 100
+
+/**
+ * @brief Maximum time a lazily opened shared-memory VLAN waits for its creator to finish, in milliseconds.
+ */
+#define RTI_SHM_READY_TIMEOUT_MS 1000
\ No newline at end of file
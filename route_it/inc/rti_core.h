@@ -1,31 +1,108 @@
-/**
- * @file rti_core.h
- * @author CYK-Dot
- * @brief Brief description
- * @version 0.1
- * @date 2025-10-04
- *
- * @copyright Copyright (c) 2025 CYK-Dot, MIT License.
- */
-#pragma once
-
-/* Header import ------------------------------------------------------------------*/
-#include "rti_internal.h"
-
-/* Config macros -----------------------------------------------------------------*/
-
-/* Export macros -----------------------------------------------------------------*/
-
-/* Exported typedef --------------------------------------------------------------*/
-
-/* C++ ---------------------------------------------------------------------------*/
-#ifdef __cplusplus
-extern "C" {
-#endif
-
-/* Exported function -------------------------------------------------------------*/
-
-/* C++ ---------------------------------------------------------------------------*/
-#ifdef __cplusplus
-}
+/**
+ * @file rti_core.h
+ * @author CYK-Dot
+ * @brief RouteIt-Framework routing decision core.
+ * @version 0.1
+ * @date 2025-10-04
+ *
+ * @copyright Copyright (c) 2025 CYK-Dot, MIT License.
+ */
+#pragma once
+
+/* Header import ------------------------------------------------------------------*/
+#include "rti_internal.h"
+#include "rti_vlan.h"
+
+/* Config macros -----------------------------------------------------------------*/
+
+/* Export macros -----------------------------------------------------------------*/
+
+/**
+ * @brief Fields a routing rule matches on, unset fields match any value.
+ */
+#define RTI_ROUTE_MATCH_SOURCE (1u << 0)
+#define RTI_ROUTE_MATCH_TYPE (1u << 1)
+#define RTI_ROUTE_MATCH_KEY (1u << 2)
+#define RTI_ROUTE_MATCH_ALL (RTI_ROUTE_MATCH_SOURCE | RTI_ROUTE_MATCH_TYPE | RTI_ROUTE_MATCH_KEY)
+
+/* Exported typedef --------------------------------------------------------------*/
+
+/**
+ * @brief Message attributes used by routing decision.
+ *
+ */
+typedef struct {
+    uint32_t source;
+    uint32_t type;
+    uint32_t key;
+} RTI_ROUTE_ATTR;
+
+/**
+ * @brief Routing rule, a message matching attr on all fields in match goes to vlanId.
+ * @note a message is delivered to VLANs of every matching rule, in rule order.
+ */
+typedef struct {
+    RTI_ROUTE_ATTR attr;
+    uint8_t match;                      /* RTI_ROUTE_MATCH_xxx bits */
+    RTI_VlanId vlanId;
+} RTI_ROUTE_RULE;
+
+typedef struct rti_route_table RTI_ROUTE_TABLE;
+
+/**
+ * @brief Comparison of a message header field with a filter value.
+ *
+ */
+typedef enum {
+    RTI_FILTER_OP_EQ = 0,
+    RTI_FILTER_OP_NE,
+    RTI_FILTER_OP_LT,
+    RTI_FILTER_OP_LE,
+    RTI_FILTER_OP_GT,
+    RTI_FILTER_OP_GE,
+    RTI_FILTER_OP_RANGE,                /* value <= field <= value2 */
+    RTI_FILTER_OP_MASK,                 /* (field & value) == value2 */
+} RTI_FILTER_OP;
+
+/**
+ * @brief Filter condition on one unsigned header field, read in host byte order.
+ *
+ */
+typedef struct {
+    uint16_t offset;                    /* field offset from message start */
+    uint8_t width;                      /* field size in bytes, 1, 2, 4 or 8 */
+    uint8_t op;                         /* see RTI_FILTER_OP */
+    uint64_t value;
+    uint64_t value2;                    /* only for RTI_FILTER_OP_RANGE and RTI_FILTER_OP_MASK */
+} RTI_FILTER_COND;
+
+/**
+ * @brief Consumer filter, a message passes if it matches all conditions.
+ */
+typedef struct rti_filter RTI_FILTER;
+
+/* C++ ---------------------------------------------------------------------------*/
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Exported function -------------------------------------------------------------*/
+
+/* RTI exported functions */
+RTI_ERR RTI_RouteCreate(const RTI_ROUTE_RULE *rules, size_t count, RTI_ROUTE_TABLE **tableOut);
+void RTI_RouteDelete(RTI_ROUTE_TABLE *table);
+RTI_ERR RTI_RouteLookup(const RTI_ROUTE_TABLE *table, const RTI_ROUTE_ATTR *attr, RTI_VlanId *vlanOut, size_t *count);
+RTI_ERR RTI_FilterCreate(const RTI_FILTER_COND *conds, size_t count, RTI_FILTER **filterOut);
+void RTI_FilterDelete(RTI_FILTER *filter);
+RTI_ERR RTI_FilterEval(const RTI_FILTER *filter, const void *msgs, size_t stride, size_t count, uint64_t *matchOut);
+RTI_ERR RTI_FilterSend(const RTI_FILTER *filter, const RTI_VLAN_IFX *ifx, void *producer,
+                       const void *msgs, size_t stride, size_t count, uint8_t lane, size_t *doneOut);
+
+/* RTI private functions */
+RTI_ERR RTIPriv_RouteEmit(const RTI_VlanId *vlans, const uint64_t *dupRules, uint64_t match,
+                          RTI_VlanId *vlanOut, size_t *count);
+
+/* C++ ---------------------------------------------------------------------------*/
+#ifdef __cplusplus
+}
 #endif
\ No newline at end of file
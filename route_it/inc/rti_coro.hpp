@@ -0,0 +1,224 @@
+/**
+ * @file rti_coro.hpp
+ * @author CYK-Dot
+ * @brief C++20 coroutine awaitables over VLAN producers and consumers.
+ * @version 0.1
+ * @date 2026-10-16
+ *
+ * @copyright Copyright (c) 2025 CYK-Dot, MIT License.
+ */
+#pragma once
+
+/* Header import ------------------------------------------------------------------*/
+#include <coroutine>
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+#include "rti_vlan.h"
+
+/* Exported typedef --------------------------------------------------------------*/
+
+namespace rti {
+
+/**
+ * @brief Result of an awaited receive.
+ *
+ */
+struct RecvResult {
+    RTI_ERR err;
+    size_t size;                        /* message size, or the needed size if the buffer is too small */
+};
+
+/**
+ * @brief Awaitable view of a consumer handle, co_await consumer.recv(msg).
+ * @note the handle stays owned by the caller, one coroutine at a time may await it.
+ *       a suspended coroutine is resumed by the producer which publishes the next message,
+ *       on its thread and inside its send, the awaiter lives in the coroutine frame.
+ */
+class CoConsumer {
+public:
+    class RecvAwaiter {
+    public:
+        RecvAwaiter(RTI_VLAN_IFX *ifx, void *consumer, void *msg, size_t capacity) noexcept
+            : ifx_(ifx), consumer_(consumer), msg_(msg), capacity_(capacity) {}
+
+        bool await_ready() noexcept { return TryRecv(); }
+
+        bool await_suspend(std::coroutine_handle<> handle) noexcept
+        {
+            handle_ = handle;
+            return Step() == false;
+        }
+
+        RecvResult await_resume() const noexcept { return {err_, size_}; }
+
+    private:
+        /**
+         * @brief Receive once, true if done, with a message or an error.
+         */
+        bool TryRecv() noexcept
+        {
+            if (ifx_->recvF == nullptr) {
+                err_ = RTI_ERR_NOT_SUPPORTED;
+                return true;
+            }
+            size_ = capacity_;
+            err_ = ifx_->recvF(consumer_, msg_, &size_);
+            return err_ != RTI_ERR_QUEUE_EMPTY;
+        }
+
+        /**
+         * @brief Arm the wake, or receive if a message came meanwhile, true if done.
+         * @note once armed the awaiter must not be touched, the wake may already run.
+         */
+        bool Step() noexcept
+        {
+            for (;;) {
+                if (ifx_->recvArmF == nullptr) {
+                    err_ = RTI_ERR_NOT_SUPPORTED;
+                    return true;
+                }
+                RTI_ERR err = ifx_->recvArmF(consumer_, &RecvAwaiter::Wake, this);
+                if (err == RTI_OK) {
+                    return false;
+                }
+                if (err != RTI_ERR_ALREADY_READY) {
+                    err_ = err;
+                    return true;
+                }
+                if (TryRecv() == true) {
+                    return true;
+                }
+            }
+        }
+
+        static void Wake(void *arg) noexcept
+        {
+            RecvAwaiter *self = static_cast<RecvAwaiter *>(arg);
+            // another consumer may take the message first, then wait for the next one
+            if (self->TryRecv() == true || self->Step() == true) {
+                self->handle_.resume();
+            }
+        }
+
+        RTI_VLAN_IFX *ifx_;
+        void *consumer_;
+        void *msg_;
+        size_t capacity_;
+        size_t size_ = 0;
+        RTI_ERR err_ = RTI_OK;
+        std::coroutine_handle<> handle_;
+    };
+
+    CoConsumer(const RTI_VLAN_DESC &desc, void *consumer) noexcept : ifx_(desc.ifx), consumer_(consumer) {}
+
+    RecvAwaiter recv(void *msg, size_t capacity) const noexcept { return RecvAwaiter(ifx_, consumer_, msg, capacity); }
+
+    template <class Msg>
+    RecvAwaiter recv(Msg &msg) const noexcept { return recv(&msg, sizeof(Msg)); }
+
+    void *handle() const noexcept { return consumer_; }
+
+private:
+    RTI_VLAN_IFX *ifx_;
+    void *consumer_;
+};
+
+/**
+ * @brief Awaitable view of a producer handle, co_await producer.send(msg).
+ * @note the handle stays owned by the caller, one coroutine at a time may await it.
+ *       only a throttled producer suspends, so give it flow control of RTI_VLAN_FLOW_MODE_NONBLOCK,
+ *       it is resumed by the consumer which drains the VLAN, on its thread and inside its receive.
+ *       other errors, like RTI_ERR_QUEUE_FULL without flow control, are returned at once.
+ */
+class CoProducer {
+public:
+    class SendAwaiter {
+    public:
+        SendAwaiter(RTI_VLAN_IFX *ifx, void *producer, const void *msg, size_t size, uint8_t lane) noexcept
+            : ifx_(ifx), producer_(producer), msg_(msg), size_(size), lane_(lane) {}
+
+        bool await_ready() noexcept { return TrySend(); }
+
+        bool await_suspend(std::coroutine_handle<> handle) noexcept
+        {
+            handle_ = handle;
+            return Step() == false;
+        }
+
+        RTI_ERR await_resume() const noexcept { return err_; }
+
+    private:
+        /**
+         * @brief Send once, true if done, sent or failed for another reason than throttling.
+         */
+        bool TrySend() noexcept
+        {
+            if (ifx_->sendF == nullptr) {
+                err_ = RTI_ERR_NOT_SUPPORTED;
+                return true;
+            }
+            err_ = ifx_->sendF(producer_, msg_, size_, lane_);
+            return err_ != RTI_ERR_FLOW_THROTTLED;
+        }
+
+        /**
+         * @brief Arm the wake, or send if resumed meanwhile, true if done.
+         * @note once armed the awaiter must not be touched, the wake may already run.
+         */
+        bool Step() noexcept
+        {
+            for (;;) {
+                if (ifx_->sendArmF == nullptr) {
+                    return true;
+                }
+                RTI_ERR err = ifx_->sendArmF(producer_, &SendAwaiter::Wake, this);
+                if (err == RTI_OK) {
+                    return false;
+                }
+                if (err != RTI_ERR_ALREADY_READY) {
+                    return true;
+                }
+                if (TrySend() == true) {
+                    return true;
+                }
+            }
+        }
+
+        static void Wake(void *arg) noexcept
+        {
+            SendAwaiter *self = static_cast<SendAwaiter *>(arg);
+            // other producers may fill the VLAN first, then wait for the next resume
+            if (self->TrySend() == true || self->Step() == true) {
+                self->handle_.resume();
+            }
+        }
+
+        RTI_VLAN_IFX *ifx_;
+        void *producer_;
+        const void *msg_;
+        size_t size_;
+        uint8_t lane_;
+        RTI_ERR err_ = RTI_OK;
+        std::coroutine_handle<> handle_;
+    };
+
+    CoProducer(const RTI_VLAN_DESC &desc, void *producer) noexcept : ifx_(desc.ifx), producer_(producer) {}
+
+    SendAwaiter send(const void *msg, size_t size, uint8_t lane = 0) const noexcept
+    {
+        return SendAwaiter(ifx_, producer_, msg, size, lane);
+    }
+
+    template <class Msg>
+        requires(std::is_pointer_v<Msg> == false)
+    SendAwaiter send(const Msg &msg, uint8_t lane = 0) const noexcept { return send(&msg, sizeof(Msg), lane); }
+
+    void *handle() const noexcept { return producer_; }
+
+private:
+    RTI_VLAN_IFX *ifx_;
+    void *producer_;
+};
+
+} // namespace rti
@@ -0,0 +1,85 @@
+/**
+ * @file rti_dispatch.h
+ * @author CYK-Dot
+ * @brief Dispatcher groups owning consumer threads of VLANs.
+ * @version 0.1
+ * @date 2026-10-16
+ *
+ * @copyright Copyright (c) 2025 CYK-Dot, MIT License.
+ */
+#pragma once
+
+/* Header import ------------------------------------------------------------------*/
+#include <stdbool.h>
+#include "rti_internal.h"
+#include "rti_vlan.h"
+
+/* Config macros -----------------------------------------------------------------*/
+
+/* Export macros -----------------------------------------------------------------*/
+
+/**
+ * @brief Words of a dispatcher CPU mask.
+ */
+#define RTI_DISPATCH_CPU_WORDS (RTI_DISPATCH_CPUS_MAX / 64)
+
+/**
+ * @brief Add a CPU to the mask of a dispatcher group configuration.
+ *
+ * @param CFG[RTI_DISPATCH_GROUP_CFG] The configuration.
+ * @param CPU CPU number, less than RTI_DISPATCH_CPUS_MAX.
+ */
+#define RTI_DISPATCH_CPU_SET(CFG, CPU) ((CFG).cpuMask[(CPU) / 64] |= (uint64_t)1 << ((CPU) % 64))
+
+/* Exported typedef --------------------------------------------------------------*/
+
+/**
+ * @brief Message callback of a VLAN in a dispatcher group.
+ * @note it runs on a dispatcher thread, msg is only valid during the call.
+ *       a group with several threads calls it concurrently.
+ */
+typedef void (*RTI_DispatchFptr)(RTI_VlanId vlanId, const void *msg, size_t size, void *arg);
+
+/**
+ * @brief Dispatcher group configuration.
+ *
+ */
+typedef struct {
+    uint64_t cpuMask[RTI_DISPATCH_CPU_WORDS];   /* CPUs of the group threads, all zero keeps inherited affinity */
+    uint32_t threads;                   /* dispatcher threads, 0 if driven by RTI_DispatchGroupPoll() */
+    uint32_t batch;                     /* messages taken from one VLAN before the next, 0 means 1 */
+    uint32_t msgSizeMax;                /* receive buffer size, only used if a VLAN is not a built-in queue */
+    uint32_t idleUs;                    /* sleep of idle threads if a VLAN has no pollable consumer, 0 means 100 */
+    bool pinEach;                       /* pin thread N to the N-th CPU of cpuMask, instead of the whole mask */
+    bool steal;                         /* share VLANs between threads by work stealing, see RTI_DISPATCH_GROUP */
+} RTI_DISPATCH_GROUP_CFG;
+
+/**
+ * @brief Dispatcher group, a set of VLANs consumed by the same threads.
+ * @note each thread has its own consumers, created after the thread is pinned,
+ *       so queues of RTI_QUEUE_NUMA_AUTO follow the group CPUs.
+ *       with steal, a VLAN has one consumer and its batches are tasks on per-thread
+ *       Chase-Lev deques: idle threads steal batches of busy VLANs, and a VLAN token
+ *       lets one thread at a time deliver it, so callbacks of a VLAN keep its order.
+ */
+typedef struct rti_dispatch_group RTI_DISPATCH_GROUP;
+
+/* C++ ---------------------------------------------------------------------------*/
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Exported function -------------------------------------------------------------*/
+
+/* RTI exported functions */
+RTI_ERR RTI_DispatchGroupCreate(const RTI_DISPATCH_GROUP_CFG *cfg, RTI_DISPATCH_GROUP **groupOut);
+void RTI_DispatchGroupDelete(RTI_DISPATCH_GROUP *group);
+RTI_ERR RTI_DispatchGroupAdd(RTI_DISPATCH_GROUP *group, RTI_VlanId vlanId, RTI_DispatchFptr handlerF, void *arg);
+RTI_ERR RTI_DispatchGroupStart(RTI_DISPATCH_GROUP *group);
+RTI_ERR RTI_DispatchGroupStop(RTI_DISPATCH_GROUP *group);
+RTI_ERR RTI_DispatchGroupPoll(RTI_DISPATCH_GROUP *group, size_t *dispatchedOut);
+
+/* C++ ---------------------------------------------------------------------------*/
+#ifdef __cplusplus
+}
+#endif
@@ -1,15 +1,15 @@
-/**
- * @file rti_generated_vlanid.h
- * @brief generated header file for vlan id
- * ---------------------------------------------------------------------------
- * @note this file is auto generated, do not edit manually
- * @version 2025-10-04 20:15:07
- */
-#ifndef __RTI_GENERATED_VLANID_H__
-#define __RTI_GENERATED_VLANID_H__
-
-#define RTI_VLANID_INVALID 0
-#define RTI_VLANID_haha 1
-#define RTI_VLANID_haha1 2
-
+/**
+ * @file rti_generated_vlanid.h
+ * @brief generated header file for vlan id
+ * ---------------------------------------------------------------------------
+ * @note this file is auto generated, do not edit manually
+ * @version 2025-10-04 20:15:07
+ */
+#ifndef __RTI_GENERATED_VLANID_H__
+#define __RTI_GENERATED_VLANID_H__
+
+#define RTI_VLANID_INVALID 0
+#define RTI_VLANID_haha 1
+#define RTI_VLANID_haha1 2
+
 #endif
\ No newline at end of file
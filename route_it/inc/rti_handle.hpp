@@ -0,0 +1,255 @@
+/**
+ * @file rti_handle.hpp
+ * @author CYK-Dot
+ * @brief C++17 move-only owners of VLAN producers and consumers, allocated through std::pmr.
+ * @version 0.1
+ * @date 2026-10-16
+ *
+ * @copyright Copyright (c) 2025 CYK-Dot, MIT License.
+ */
+#pragma once
+
+/* Header import ------------------------------------------------------------------*/
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <memory_resource>
+#include <new>
+#include <type_traits>
+#include <utility>
+#include <vector>
+#include "rti_vlan.h"
+
+/* Exported typedef --------------------------------------------------------------*/
+
+namespace rti {
+
+/**
+ * @brief Owner of a producer handle, deletes it through deleteProducerF when destroyed.
+ *
+ */
+class Producer {
+public:
+    Producer() noexcept = default;
+    Producer(const Producer &) = delete;
+    Producer &operator=(const Producer &) = delete;
+
+    Producer(Producer &&other) noexcept : ifx_(other.ifx_), handle_(other.release()) {}
+
+    Producer &operator=(Producer &&other) noexcept
+    {
+        if (this != &other) {
+            reset();
+            ifx_ = other.ifx_;
+            handle_ = other.release();
+        }
+        return *this;
+    }
+
+    ~Producer() { reset(); }
+
+    /**
+     * @brief Create a producer of the VLAN, deleting the one held before.
+     *
+     * @param desc Descriptor of the VLAN.
+     * @return RTI_ERR RTI_ERR_FAILED if the VLAN created no producer.
+     */
+    RTI_ERR Create(const RTI_VLAN_DESC &desc) noexcept
+    {
+        reset();
+        ifx_ = desc.ifx;
+        handle_ = ifx_->createProducerF();
+        return (handle_ != nullptr) ? RTI_OK : RTI_ERR_FAILED;
+    }
+
+    RTI_ERR Send(const void *msg, size_t size, uint8_t lane = 0) const noexcept
+    {
+        if (handle_ == nullptr || ifx_->sendF == nullptr) {
+            return RTI_ERR_NOT_SUPPORTED;
+        }
+        return ifx_->sendF(handle_, msg, size, lane);
+    }
+
+    template <class Msg, class = std::enable_if_t<std::is_pointer<Msg>::value == false>>
+    RTI_ERR Send(const Msg &msg, uint8_t lane = 0) const noexcept { return Send(&msg, sizeof(Msg), lane); }
+
+    /**
+     * @brief Give up the handle without deleting it.
+     */
+    void *release() noexcept { return std::exchange(handle_, nullptr); }
+
+    void reset() noexcept
+    {
+        if (handle_ != nullptr) {
+            ifx_->deleteProducerF(std::exchange(handle_, nullptr));
+        }
+    }
+
+    void *handle() const noexcept { return handle_; }
+    RTI_VLAN_IFX *ifx() const noexcept { return ifx_; }
+    explicit operator bool() const noexcept { return handle_ != nullptr; }
+
+private:
+    RTI_VLAN_IFX *ifx_ = nullptr;
+    void *handle_ = nullptr;
+};
+
+/**
+ * @brief Owner of a consumer handle and of its receive buffer, deletes the handle
+ *        through deleteConsumerF when destroyed.
+ * @note allocator-aware, the receive buffer comes from the memory resource of its allocator,
+ *       which PmrNew() passes on, so the wrapper and its buffer share one arena.
+ */
+class Consumer {
+public:
+    using allocator_type = std::pmr::polymorphic_allocator<std::byte>;
+
+    Consumer() noexcept = default;
+    explicit Consumer(const allocator_type &alloc) noexcept : buffer_(alloc) {}
+    Consumer(const Consumer &) = delete;
+    Consumer &operator=(const Consumer &) = delete;
+
+    Consumer(Consumer &&other) noexcept
+        : ifx_(other.ifx_), handle_(other.release()), buffer_(std::move(other.buffer_)), size_(other.size_) {}
+
+    /**
+     * @note the buffer stays in the resource of this consumer, it is copied if the other one has another resource.
+     */
+    Consumer &operator=(Consumer &&other)
+    {
+        if (this != &other) {
+            reset();
+            buffer_ = std::move(other.buffer_);
+            ifx_ = other.ifx_;
+            handle_ = other.release();
+            size_ = other.size_;
+        }
+        return *this;
+    }
+
+    ~Consumer() { reset(); }
+
+    /**
+     * @brief Create a consumer of the VLAN, deleting the one held before.
+     * @note the buffer is allocated first, so a throwing resource leaves no handle behind.
+     *
+     * @param desc Descriptor of the VLAN.
+     * @param capacity Size of the receive buffer used by Recv(), 0 if messages are received into caller buffers only.
+     * @return RTI_ERR RTI_ERR_FAILED if the VLAN created no consumer.
+     */
+    RTI_ERR Create(const RTI_VLAN_DESC &desc, size_t capacity = 0)
+    {
+        reset();
+        buffer_.resize(capacity);
+        size_ = 0;
+        ifx_ = desc.ifx;
+        handle_ = ifx_->createConsumerF();
+        return (handle_ != nullptr) ? RTI_OK : RTI_ERR_FAILED;
+    }
+
+    RTI_ERR Recv(void *msg, size_t *size) const noexcept
+    {
+        if (handle_ == nullptr || ifx_->recvF == nullptr) {
+            return RTI_ERR_NOT_SUPPORTED;
+        }
+        return ifx_->recvF(handle_, msg, size);
+    }
+
+    /**
+     * @brief Receive a message, RTI_ERR_INVALID_PARAM if the VLAN carried another size.
+     */
+    template <class Msg, class = std::enable_if_t<std::is_pointer<Msg>::value == false>>
+    RTI_ERR Recv(Msg &msg) const noexcept
+    {
+        size_t size = sizeof(Msg);
+        RTI_ERR err = Recv(&msg, &size);
+        if (err == RTI_OK && size != sizeof(Msg)) {
+            return RTI_ERR_INVALID_PARAM;
+        }
+        return err;
+    }
+
+    /**
+     * @brief Receive a message into the owned buffer, see data() and size().
+     */
+    RTI_ERR Recv() noexcept
+    {
+        size_t size = buffer_.size();
+        RTI_ERR err = Recv(buffer_.data(), &size);
+        size_ = (err == RTI_OK) ? size : 0;
+        return err;
+    }
+
+    /**
+     * @brief Give up the handle without deleting it, the buffer stays.
+     */
+    void *release() noexcept { return std::exchange(handle_, nullptr); }
+
+    void reset() noexcept
+    {
+        if (handle_ != nullptr) {
+            ifx_->deleteConsumerF(std::exchange(handle_, nullptr));
+        }
+    }
+
+    const std::byte *data() const noexcept { return buffer_.data(); }
+    size_t size() const noexcept { return size_; }
+    size_t capacity() const noexcept { return buffer_.size(); }
+    allocator_type get_allocator() const noexcept { return buffer_.get_allocator(); }
+
+    void *handle() const noexcept { return handle_; }
+    RTI_VLAN_IFX *ifx() const noexcept { return ifx_; }
+    explicit operator bool() const noexcept { return handle_ != nullptr; }
+
+private:
+    RTI_VLAN_IFX *ifx_ = nullptr;
+    void *handle_ = nullptr;
+    std::pmr::vector<std::byte> buffer_;
+    size_t size_ = 0;
+};
+
+/**
+ * @brief Deleter of objects from PmrNew(), destroys them and returns their memory to the resource.
+ *
+ */
+template <class T>
+class PmrDelete {
+public:
+    PmrDelete() noexcept = default;
+    explicit PmrDelete(std::pmr::memory_resource *resource) noexcept : resource_(resource) {}
+
+    void operator()(T *object) const noexcept
+    {
+        object->~T();
+        resource_->deallocate(object, sizeof(T), alignof(T));
+    }
+
+    std::pmr::memory_resource *resource() const noexcept { return resource_; }
+
+private:
+    std::pmr::memory_resource *resource_ = nullptr;
+};
+
+template <class T>
+using PmrPtr = std::unique_ptr<T, PmrDelete<T>>;
+
+/**
+ * @brief Construct an object in memory of the resource, passing the resource on to allocator-aware types.
+ * @note throws what the resource throws, like std::bad_alloc.
+ *       a monotonic arena does not free on deallocate, the handles are still deleted.
+ */
+template <class T, class... Args>
+PmrPtr<T> PmrNew(std::pmr::memory_resource *resource, Args &&...args)
+{
+    std::pmr::polymorphic_allocator<T> alloc(resource);
+    T *object = alloc.allocate(1);
+    try {
+        alloc.construct(object, std::forward<Args>(args)...);
+    } catch (...) {
+        alloc.deallocate(object, 1);
+        throw;
+    }
+    return PmrPtr<T>(object, PmrDelete<T>(resource));
+}
+
+} // namespace rti
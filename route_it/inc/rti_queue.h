@@ -0,0 +1,346 @@
+/**
+ * @file rti_queue.h
+ * @author CYK-Dot
+ * @brief Built-in lock-free ring queue VLAN backend.
+ * @version 0.1
+ * @date 2026-10-16
+ *
+ * @copyright Copyright (c) 2025 CYK-Dot, MIT License.
+ */
+#pragma once
+
+/* Header import ------------------------------------------------------------------*/
+#include <stdbool.h>
+#include "rti_vlan.h"
+
+/* Config macros -----------------------------------------------------------------*/
+
+/* Export macros -----------------------------------------------------------------*/
+
+/**
+ * @brief Memory reserved for queue control block in front of the slots.
+ */
+#define RTI_QUEUE_HDR_SIZE (RTI_CACHELINE_SIZE * (16 + 2 * RTI_QUEUE_LANES_MAX) + 32 * RTI_QUEUE_HANDLE_CACHE)
+
+/**
+ * @brief Slot stride of a message size, 16 bytes slot header followed by payload.
+ */
+#define RTI_QUEUE_SLOT_STRIDE(MSG_SIZE) (((size_t)(MSG_SIZE) + 31) & ~(size_t)15)
+
+/**
+ * @brief Compile time memory size of a queue, not less than RTI_QueueMemSize().
+ *
+ * @param DEPTH Slot count of each lane.
+ * @param MSG_SIZE Maximum message size in bytes.
+ * @param LANE_COUNT Priority lane count.
+ */
+#define RTI_QUEUE_MEM_SIZE(DEPTH, MSG_SIZE, LANE_COUNT) \
+    (RTI_QUEUE_HDR_SIZE + (size_t)(LANE_COUNT) * (DEPTH) * RTI_QUEUE_SLOT_STRIDE(MSG_SIZE))
+
+/**
+ * @brief Memory of one producer or consumer in a handle pool.
+ */
+#define RTI_QUEUE_HANDLE_SIZE (2 * RTI_CACHELINE_SIZE)
+
+/**
+ * @brief Memory size of a handle pool, see RTI_QueuePoolSet().
+ *
+ * @param HANDLE_COUNT Producers and consumers alive at the same time, up to RTI_QUEUE_HANDLE_CACHE.
+ */
+#define RTI_QUEUE_POOL_SIZE(HANDLE_COUNT) ((size_t)(HANDLE_COUNT) * RTI_QUEUE_HANDLE_SIZE)
+
+/**
+ * @brief NUMA placement of queue memory, numaNode of RTI_QUEUE_CFG.
+ * @note NONE is the zero value, so configurations without numaNode keep first touch placement.
+ *       AUTO moves ring and handle pool to the node of the first consumer thread,
+ *       a node given by RTI_QUEUE_NUMA_NODE() is bound before the ring is touched.
+ *       only queues with a node hint are page aligned on heap, so they can be bound alone.
+ */
+#define RTI_QUEUE_NUMA_NONE 0
+#define RTI_QUEUE_NUMA_AUTO 0xFF
+#define RTI_QUEUE_NUMA_NODE(NODE) ((uint8_t)((NODE) + 1))
+
+/**
+ * @brief Memory options of a queue, memFlags of RTI_QUEUE_CFG.
+ * @note HUGE backs a heap queue by reserved huge pages, falling back to
+ *       transparent huge pages and then to normal pages, caller storage is only advised.
+ *       PREFAULT faults in ring, handle pool and ISR mailboxes when they are created.
+ */
+#define RTI_QUEUE_MEM_HUGE (1u << 0)
+#define RTI_QUEUE_MEM_PREFAULT (1u << 1)
+
+/**
+ * @brief Pages backing a queue, see RTIPriv_QueuePageKind().
+ */
+#define RTI_QUEUE_PAGE_NORMAL 0
+#define RTI_QUEUE_PAGE_HUGETLB 1
+#define RTI_QUEUE_PAGE_THP 2
+
+/**
+ * @brief Define a VLAN interface backed by the built-in queue.
+ *
+ * @param IFX_NAME Name of the RTI_QUEUE_IFX variable to define.
+ * @param DEPTH Slot count of each lane, must be power of 2.
+ * @param MSG_SIZE Maximum message size in bytes.
+ * @param LANE_COUNT Priority lane count, 1 ~ RTI_QUEUE_LANES_MAX.
+ * @param SCHED Dequeue policy between lanes, see RTI_QUEUE_SCHED.
+ * @note pass &IFX_NAME.ifx to VLAN register macros.
+ */
+#define RTI_QUEUE_IFX_DEFINE(IFX_NAME, DEPTH, MSG_SIZE, LANE_COUNT, SCHED) \
+    RTI_QUEUE_IFX_DEFINE_OPTS(IFX_NAME, DEPTH, MSG_SIZE, LANE_COUNT, SCHED, .rate = NULL)
+
+/**
+ * @brief Define a VLAN interface backed by the built-in queue with options.
+ *
+ * @param IFX_NAME Name of the RTI_QUEUE_IFX variable to define.
+ * @param DEPTH Slot count of each lane, must be power of 2.
+ * @param MSG_SIZE Maximum message size in bytes.
+ * @param LANE_COUNT Priority lane count, 1 ~ RTI_QUEUE_LANES_MAX.
+ * @param SCHED Dequeue policy between lanes, see RTI_QUEUE_SCHED.
+ * @param ... Designated initializers of RTI_QUEUE_OPTS, like .rate = &RATE, .memFlags = RTI_QUEUE_MEM_HUGE,
+ *            in declaration order for C++, options not given are zero.
+ */
+#define RTI_QUEUE_IFX_DEFINE_OPTS(IFX_NAME, DEPTH, MSG_SIZE, LANE_COUNT, SCHED, ...) \
+    static void *IFX_NAME##_Create(void); \
+    static void IFX_NAME##_Delete(void *vlan); \
+    static void *IFX_NAME##_CreateProducer(void); \
+    static void IFX_NAME##_DeleteProducer(void *producer); \
+    static void *IFX_NAME##_CreateConsumer(void); \
+    static void IFX_NAME##_DeleteConsumer(void *consumer); \
+    static void *IFX_NAME##_CreateIsrProducer(void); \
+    static void IFX_NAME##_DeleteIsrProducer(void *producer); \
+    static RTI_QUEUE_IFX IFX_NAME = { \
+        .ifx = { \
+            .createF = IFX_NAME##_Create, \
+            .deleteF = IFX_NAME##_Delete, \
+            .createProducerF = IFX_NAME##_CreateProducer, \
+            .deleteProducerF = IFX_NAME##_DeleteProducer, \
+            .createConsumerF = IFX_NAME##_CreateConsumer, \
+            .deleteConsumerF = IFX_NAME##_DeleteConsumer, \
+            .sendF = RTI_QueueSend, \
+            .recvF = RTI_QueueRecv, \
+            .flowSetF = RTI_QueueFlowSet, \
+            .flowGetF = RTI_QueueFlowGet, \
+            .recvWaitF = RTI_QueueRecvWait, \
+            .consumerFdF = RTI_QueueConsumerGetFd, \
+            .createIsrProducerF = IFX_NAME##_CreateIsrProducer, \
+            .deleteIsrProducerF = IFX_NAME##_DeleteIsrProducer, \
+            .sendIsrF = RTI_QueueSendIsr, \
+            .lazy = RTI_VLAN_LAZY_INIT, \
+            .recvArmF = RTI_QueueConsumerWaitArm, \
+            .sendArmF = RTI_QueueProducerWaitArm, \
+        }, \
+        .cfg = {DEPTH, MSG_SIZE, LANE_COUNT, SCHED, {0}, RTI_QUEUE_NUMA_NONE, 0}, \
+        .opts = {__VA_ARGS__}, \
+        .queue = NULL, \
+    }; \
+    static void *IFX_NAME##_Create(void) { return RTI_QueueIfxCreate(&IFX_NAME); } \
+    static void IFX_NAME##_Delete(void *vlan) { RTI_QueueIfxDelete(&IFX_NAME, vlan); } \
+    static void *IFX_NAME##_CreateProducer(void) { return RTI_QueueIfxCreateProducer(&IFX_NAME); } \
+    static void IFX_NAME##_DeleteProducer(void *producer) { RTI_QueueIfxDeleteProducer(&IFX_NAME, producer); } \
+    static void *IFX_NAME##_CreateConsumer(void) { return RTI_QueueIfxCreateConsumer(&IFX_NAME); } \
+    static void IFX_NAME##_DeleteConsumer(void *consumer) { RTI_QueueIfxDeleteConsumer(&IFX_NAME, consumer); } \
+    static void *IFX_NAME##_CreateIsrProducer(void) { return RTI_QueueIfxCreateIsrProducer(&IFX_NAME); } \
+    static void IFX_NAME##_DeleteIsrProducer(void *producer) { RTI_QueueIfxDeleteIsrProducer(&IFX_NAME, producer); }
+
+/**
+ * @brief Register a static VLAN with priority lanes, VLAN ID auto destributed by python script.
+ *
+ * @param VLAN_NAME VLAN name.
+ * @param DEPTH Slot count of each lane, must be power of 2.
+ * @param MSG_SIZE Maximum message size in bytes.
+ * @param LANE_COUNT Priority lane count, lane 0 has the highest priority.
+ * @param SCHED Dequeue policy between lanes, see RTI_QUEUE_SCHED.
+ */
+#define RTI_VLAN_REGISTER_STATIC_QOS(VLAN_NAME, DEPTH, MSG_SIZE, LANE_COUNT, SCHED) \
+    RTI_VLAN_REGISTER_STATIC_QOS_OPTS_WITH_ID(VLAN_NAME, RTI_VLANID_##VLAN_NAME, DEPTH, MSG_SIZE, LANE_COUNT, SCHED, .rate = NULL)
+
+/**
+ * @brief Register a static VLAN with priority lanes and specified VLAN ID.
+ *
+ * @param VLAN_NAME VLAN name.
+ * @param VLAN_ID VLAN ID.
+ * @param DEPTH Slot count of each lane, must be power of 2.
+ * @param MSG_SIZE Maximum message size in bytes.
+ * @param LANE_COUNT Priority lane count, lane 0 has the highest priority.
+ * @param SCHED Dequeue policy between lanes, see RTI_QUEUE_SCHED.
+ */
+#define RTI_VLAN_REGISTER_STATIC_QOS_WITH_ID(VLAN_NAME, VLAN_ID, DEPTH, MSG_SIZE, LANE_COUNT, SCHED) \
+    RTI_VLAN_REGISTER_STATIC_QOS_OPTS_WITH_ID(VLAN_NAME, VLAN_ID, DEPTH, MSG_SIZE, LANE_COUNT, SCHED, .rate = NULL)
+
+/**
+ * @brief Register a static VLAN with priority lanes and options, VLAN ID auto destributed by python script.
+ *
+ * @param VLAN_NAME VLAN name.
+ * @param DEPTH Slot count of each lane, must be power of 2.
+ * @param MSG_SIZE Maximum message size in bytes.
+ * @param LANE_COUNT Priority lane count, lane 0 has the highest priority.
+ * @param SCHED Dequeue policy between lanes, see RTI_QUEUE_SCHED.
+ * @param ... Designated initializers of RTI_QUEUE_OPTS, see RTI_QUEUE_IFX_DEFINE_OPTS.
+ */
+#define RTI_VLAN_REGISTER_STATIC_QOS_OPTS(VLAN_NAME, DEPTH, MSG_SIZE, LANE_COUNT, SCHED, ...) \
+    RTI_VLAN_REGISTER_STATIC_QOS_OPTS_WITH_ID(VLAN_NAME, RTI_VLANID_##VLAN_NAME, DEPTH, MSG_SIZE, LANE_COUNT, SCHED, __VA_ARGS__)
+
+/**
+ * @brief Register a static VLAN with priority lanes, options and specified VLAN ID.
+ *
+ * @param VLAN_NAME VLAN name.
+ * @param VLAN_ID VLAN ID.
+ * @param DEPTH Slot count of each lane, must be power of 2.
+ * @param MSG_SIZE Maximum message size in bytes.
+ * @param LANE_COUNT Priority lane count, lane 0 has the highest priority.
+ * @param SCHED Dequeue policy between lanes, see RTI_QUEUE_SCHED.
+ * @param ... Designated initializers of RTI_QUEUE_OPTS, see RTI_QUEUE_IFX_DEFINE_OPTS.
+ * @note rate configurations and static storages of rti_config.json are generated as
+ *       RTI_VLANRATE_<NAME> and RTI_VLANSTORAGE_<NAME>, pass them as .rate and .storage.
+ */
+#define RTI_VLAN_REGISTER_STATIC_QOS_OPTS_WITH_ID(VLAN_NAME, VLAN_ID, DEPTH, MSG_SIZE, LANE_COUNT, SCHED, ...) \
+    RTI_QUEUE_IFX_DEFINE_OPTS(RTI_VLAN_##VLAN_NAME##_IFX, DEPTH, MSG_SIZE, LANE_COUNT, SCHED, __VA_ARGS__) \
+    RTI_TYPE_EXTERN_C const RTI_VLAN_DESC RTI_VLAN_##VLAN_NAME = { \
+        .ifx = &RTI_VLAN_##VLAN_NAME##_IFX.ifx, \
+        .name = (char *)#VLAN_NAME, \
+        .id = VLAN_ID, \
+        .lanes = LANE_COUNT, \
+    };\
+    RTI_TYPE_SECTION_VLAN_USED const RTI_VLAN_DESC *RTI_VLAN_##VLAN_NAME##_PTR = &RTI_VLAN_##VLAN_NAME
+
+/* Exported typedef --------------------------------------------------------------*/
+
+/**
+ * @brief Dequeue policy between priority lanes.
+ *
+ */
+typedef enum {
+    RTI_QUEUE_SCHED_STRICT = 0,         /* always drain the lowest non-empty lane first */
+    RTI_QUEUE_SCHED_WRR,                /* weighted round-robin over non-empty lanes */
+} RTI_QUEUE_SCHED;
+
+/**
+ * @brief Queue configuration.
+ * @note weights only used by RTI_QUEUE_SCHED_WRR, a zero weight of lane N
+ *       is replaced by 2^(lanes-1-N), so lane 0 gets the largest share.
+ */
+typedef struct {
+    uint32_t depth;
+    uint32_t msgSize;
+    uint8_t lanes;
+    uint8_t sched;
+    uint8_t weights[RTI_QUEUE_LANES_MAX];
+    uint8_t numaNode RTI_TYPE_DEFAULT(RTI_QUEUE_NUMA_NONE); /* RTI_QUEUE_NUMA_NONE, RTI_QUEUE_NUMA_AUTO or RTI_QUEUE_NUMA_NODE() */
+    uint8_t memFlags RTI_TYPE_DEFAULT(0);   /* RTI_QUEUE_MEM_xxx, 0 for heap pages faulted on first use */
+} RTI_QUEUE_CFG;
+
+typedef struct rti_queue RTI_QUEUE;
+
+/**
+ * @brief A slot claimed for in-place write or read.
+ *
+ */
+typedef struct {
+    void *data;                         /* payload inside the queue */
+    size_t size;                        /* payload size in bytes */
+    uint8_t lane;                       /* lane of the slot */
+    size_t pos;                         /* private, ring position of the slot */
+} RTI_QUEUE_BUF;
+
+typedef bool (*RTI_QueueOwnerDeadFptr)(uint32_t owner, void *arg);
+
+/**
+ * @brief Takes over RTI_QueueSend() of a queue in producer context, see RTI_QueueForwardSet().
+ *
+ */
+typedef RTI_ERR (*RTI_QueueForwardFptr)(const void *msg, size_t size, uint8_t lane, void *arg);
+
+/**
+ * @brief Caller provided memory of a queue VLAN, so it never allocates on heap.
+ * @note mem should be aligned to RTI_CACHELINE_SIZE.
+ *       ISR producers still allocate their mailboxes, create them at startup.
+ */
+typedef struct {
+    void *mem;                          /* queue memory, see RTI_QUEUE_MEM_SIZE() */
+    size_t memSize;
+    void *pool;                         /* handle pool, NULL to allocate handles on heap */
+    size_t poolSize;                    /* see RTI_QUEUE_POOL_SIZE() */
+} RTI_QUEUE_STORAGE;
+
+/**
+ * @brief Options of a queue VLAN, see RTI_QUEUE_IFX_DEFINE_OPTS.
+ * @note all zero is a heap queue without rate limit, memory options or NUMA placement.
+ */
+typedef struct {
+    const RTI_VLAN_RATE_CFG *rate RTI_TYPE_DEFAULT(NULL);       /* NULL if not rate limited */
+    const RTI_QUEUE_STORAGE *storage RTI_TYPE_DEFAULT(NULL);    /* NULL if allocated on heap */
+    uint8_t memFlags RTI_TYPE_DEFAULT(0);                       /* RTI_QUEUE_MEM_xxx */
+    uint8_t numaNode RTI_TYPE_DEFAULT(RTI_QUEUE_NUMA_NONE);     /* RTI_QUEUE_NUMA_NONE, RTI_QUEUE_NUMA_AUTO or RTI_QUEUE_NUMA_NODE() */
+} RTI_QUEUE_OPTS;
+
+/**
+ * @brief VLAN interface of built-in queue, defined by RTI_QUEUE_IFX_DEFINE.
+ * @note memFlags and numaNode of cfg are taken from opts when the queue is created.
+ */
+typedef struct {
+    RTI_VLAN_IFX ifx;
+    RTI_QUEUE_CFG cfg;
+    RTI_QUEUE_OPTS opts;
+    RTI_QUEUE *queue;
+} RTI_QUEUE_IFX;
+
+/* C++ ---------------------------------------------------------------------------*/
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Exported function -------------------------------------------------------------*/
+
+/* RTI exported functions */
+size_t RTI_QueueMemSize(const RTI_QUEUE_CFG *cfg);
+RTI_ERR RTI_QueueInit(void *mem, size_t sizeBytes, const RTI_QUEUE_CFG *cfg, RTI_QUEUE **queueOut);
+RTI_ERR RTI_QueueCreate(const RTI_QUEUE_CFG *cfg, RTI_QUEUE **queueOut);
+void RTI_QueueDelete(RTI_QUEUE *queue);
+RTI_ERR RTI_QueueProducerCreate(RTI_QUEUE *queue, void **producerOut);
+void RTI_QueueProducerDelete(void *producer);
+RTI_ERR RTI_QueueConsumerCreate(RTI_QUEUE *queue, void **consumerOut);
+void RTI_QueueConsumerDelete(void *consumer);
+int RTI_QueueConsumerGetFd(void *consumer);
+RTI_ERR RTI_QueueConsumerWaitArm(void *consumer, RTI_VlanWakeFptr wakeF, void *arg);
+RTI_ERR RTI_QueueProducerWaitArm(void *producer, RTI_VlanWakeFptr wakeF, void *arg);
+RTI_ERR RTI_QueueSend(void *producer, const void *msg, size_t size, uint8_t lane);
+RTI_ERR RTI_QueueIsrProducerCreate(RTI_QUEUE *queue, uint32_t depth, void **producerOut);
+void RTI_QueueIsrProducerDelete(void *producer);
+RTI_ERR RTI_QueueSendIsr(void *producer, const void *msg, size_t size, uint8_t lane);
+RTI_ERR RTI_QueueRecv(void *consumer, void *msg, size_t *size);
+RTI_ERR RTI_QueueSendAcquire(void *producer, size_t size, uint8_t lane, RTI_QUEUE_BUF *buf);
+RTI_ERR RTI_QueueSendCommit(void *producer, RTI_QUEUE_BUF *buf);
+RTI_ERR RTI_QueueRecvAcquire(void *consumer, RTI_QUEUE_BUF *buf);
+RTI_ERR RTI_QueueRecvRelease(void *consumer, RTI_QUEUE_BUF *buf);
+RTI_ERR RTI_QueueRecvWait(void *consumer, void *msg, size_t *size, int32_t timeoutMs);
+RTI_ERR RTI_QueueRecvAcquireWait(void *consumer, RTI_QUEUE_BUF *buf, int32_t timeoutMs);
+RTI_ERR RTI_QueueFlowSet(void *producer, const RTI_VLAN_FLOW_CFG *cfg);
+RTI_ERR RTI_QueueFlowGet(void *producer, RTI_VLAN_FLOW *flow);
+RTI_ERR RTI_QueueRateSet(RTI_QUEUE *queue, const RTI_VLAN_RATE_CFG *cfg);
+RTI_ERR RTI_QueueForwardSet(RTI_QUEUE *queue, RTI_QueueForwardFptr forwardF, void *arg);
+RTI_ERR RTI_QueuePoolSet(RTI_QUEUE *queue, void *mem, size_t sizeBytes);
+RTI_ERR RTI_QueueNumaBind(RTI_QUEUE *queue, int node);
+
+/* RTI private functions */
+uint32_t RTIPriv_QueueUsed(RTI_QUEUE *queue);
+int RTIPriv_QueueNumaNode(RTI_QUEUE *queue);
+uint8_t RTIPriv_QueuePageKind(RTI_QUEUE *queue);
+bool RTIPriv_QueueHasPolicy(RTI_QUEUE *queue);
+void RTIPriv_QueueSetShared(RTI_QUEUE *queue);
+void RTIPriv_QueueSetOwner(void *handle, bool isProducer, uint32_t owner);
+RTI_QUEUE *RTIPriv_QueueGet(void *handle, bool isProducer);
+uint32_t RTIPriv_QueueRecover(RTI_QUEUE *queue, RTI_QueueOwnerDeadFptr isDeadF, void *arg, bool dropUnknown);
+void *RTI_QueueIfxCreate(RTI_QUEUE_IFX *ifx);
+void RTI_QueueIfxDelete(RTI_QUEUE_IFX *ifx, void *vlan);
+void *RTI_QueueIfxCreateProducer(RTI_QUEUE_IFX *ifx);
+void RTI_QueueIfxDeleteProducer(RTI_QUEUE_IFX *ifx, void *producer);
+void *RTI_QueueIfxCreateConsumer(RTI_QUEUE_IFX *ifx);
+void RTI_QueueIfxDeleteConsumer(RTI_QUEUE_IFX *ifx, void *consumer);
+void *RTI_QueueIfxCreateIsrProducer(RTI_QUEUE_IFX *ifx);
+void RTI_QueueIfxDeleteIsrProducer(RTI_QUEUE_IFX *ifx, void *producer);
+
+/* C++ ---------------------------------------------------------------------------*/
+#ifdef __cplusplus
+}
+#endif
@@ -0,0 +1,101 @@
+/**
+ * @file rti_registry.hpp
+ * @author CYK-Dot
+ * @brief C++17 compile-time VLAN registry, specialized by generated registry headers.
+ * @version 0.1
+ * @date 2026-10-16
+ *
+ * @copyright Copyright (c) 2025 CYK-Dot, MIT License.
+ */
+#pragma once
+
+/* Header import ------------------------------------------------------------------*/
+#include <cstddef>
+#include "rti_vlan.h"
+
+/* Exported typedef --------------------------------------------------------------*/
+
+namespace rti {
+
+/**
+ * @brief Entry of a generated registry table.
+ *
+ */
+struct RegistryEntry {
+    RTI_VlanId id;
+    const char *name;
+};
+
+/**
+ * @brief VLAN known at compile time, specialized once per VLAN ID by generated registries.
+ * @note a VLAN ID specialized twice is a redefinition, an unknown one is an incomplete type.
+ *       specializations provide id, name and Desc(), the descriptor itself.
+ */
+template <RTI_VlanId ID>
+struct Vlan;
+
+/**
+ * @brief Descriptor of a VLAN known at compile time, without searching the VLAN table.
+ */
+template <RTI_VlanId ID>
+constexpr const RTI_VLAN_DESC &VlanDesc() noexcept
+{
+    return Vlan<ID>::Desc();
+}
+
+/**
+ * @brief Compare two names in constant expressions.
+ */
+constexpr bool RegistryNameEqual(const char *lhs, const char *rhs) noexcept
+{
+    while (*lhs != '\0' && *lhs == *rhs) {
+        lhs++;
+        rhs++;
+    }
+    return *lhs == *rhs;
+}
+
+/**
+ * @brief Result of a name not in the registry, not constexpr on purpose.
+ * @note a constant lookup reaching it is a compile error, so a misspelled name can not route to VLAN 0.
+ */
+inline RTI_VlanId RegistryNameUnknown(const char *name) noexcept
+{
+    (void)name;
+    return 0;
+}
+
+/**
+ * @brief Find a VLAN ID by name in a registry table.
+ *
+ * @return RTI_VlanId The VLAN ID, 0 if not found at runtime.
+ * @note an unknown name is not a constant expression, static_assert() and constexpr users fail to compile.
+ */
+template <size_t N>
+constexpr RTI_VlanId RegistryFind(const RegistryEntry (&entries)[N], const char *name) noexcept
+{
+    for (size_t i = 0; i < N; i++) {
+        if (RegistryNameEqual(entries[i].name, name) == true) {
+            return entries[i].id;
+        }
+    }
+    return RegistryNameUnknown(name);
+}
+
+/**
+ * @brief Check IDs and names of a registry table are unique.
+ */
+template <size_t N>
+constexpr bool RegistryIsUnique(const RegistryEntry (&entries)[N]) noexcept
+{
+    for (size_t i = 0; i < N; i++) {
+        for (size_t j = i + 1; j < N; j++) {
+            if (entries[i].id == entries[j].id || RegistryNameEqual(entries[i].name, entries[j].name) == true) {
+                return false;
+            }
+        }
+    }
+    return true;
+}
+
+} // namespace rti
@@ -0,0 +1,87 @@
+/**
+ * @file rti_rpc.h
+ * @author CYK-Dot
+ * @brief Request/reply RPC over a pair of VLANs.
+ * @version 0.1
+ * @date 2026-10-16
+ *
+ * @copyright Copyright (c) 2025 CYK-Dot, MIT License.
+ */
+#pragma once
+
+/* Header import ------------------------------------------------------------------*/
+#include "rti_internal.h"
+#include "rti_vlan.h"
+
+/* Config macros -----------------------------------------------------------------*/
+
+/* Export macros -----------------------------------------------------------------*/
+
+/**
+ * @brief Message size of request and reply VLANs for a payload size.
+ *
+ * @param PAYLOAD_SIZE Maximum payload size in bytes.
+ */
+#define RTI_RPC_MSG_SIZE(PAYLOAD_SIZE) (sizeof(RTI_RPC_HDR) + (PAYLOAD_SIZE))
+
+/* Exported typedef --------------------------------------------------------------*/
+
+/**
+ * @brief Header in front of every request and reply payload.
+ *
+ */
+typedef struct {
+    uint32_t corrId;                    /* correlation ID, echoed by the reply */
+    int32_t status;                     /* RTI_ERR of server handler, only in reply */
+    RTI_VlanId replyVlan;               /* only in request */
+    uint16_t reserved;
+} RTI_RPC_HDR;
+
+/**
+ * @brief RPC client configuration.
+ *
+ */
+typedef struct {
+    RTI_VlanId requestVlan;             /* VLAN the server consumes */
+    RTI_VlanId replyVlan;               /* VLAN only this client consumes */
+    uint32_t pendingMax;                /* calls in flight, must be power of 2 */
+    uint32_t payloadMax;                /* maximum request and reply payload size */
+} RTI_RPC_CFG;
+
+/**
+ * @brief Called once per call, with the reply or with RTI_ERR_TIMEOUT.
+ * @note reply is only valid during the call.
+ */
+typedef void (*RTI_RpcReplyFptr)(RTI_ERR status, const void *reply, size_t size, void *arg);
+
+/**
+ * @brief Server handler, writes at most *replySize bytes to reply and sets *replySize.
+ * @note the returned error is delivered to the client as reply status.
+ */
+typedef RTI_ERR (*RTI_RpcHandleFptr)(const void *req, size_t size, void *reply, size_t *replySize, void *arg);
+
+typedef struct rti_rpc_client RTI_RPC_CLIENT;
+typedef struct rti_rpc_server RTI_RPC_SERVER;
+
+/* C++ ---------------------------------------------------------------------------*/
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Exported function -------------------------------------------------------------*/
+
+/* RTI exported functions */
+RTI_ERR RTI_RpcClientCreate(const RTI_RPC_CFG *cfg, RTI_RPC_CLIENT **clientOut);
+void RTI_RpcClientDelete(RTI_RPC_CLIENT *client);
+RTI_ERR RTI_RpcCall(RTI_RPC_CLIENT *client, const void *req, size_t size, uint32_t timeout,
+                    RTI_RpcReplyFptr replyF, void *arg);
+RTI_ERR RTI_RpcClientPoll(RTI_RPC_CLIENT *client, uint64_t now, size_t *doneOut);
+RTI_ERR RTI_RpcServerCreate(RTI_VlanId requestVlan, uint32_t payloadMax, RTI_RpcHandleFptr handleF, void *arg,
+                            RTI_RPC_SERVER **serverOut);
+void RTI_RpcServerDelete(RTI_RPC_SERVER *server);
+RTI_ERR RTI_RpcServerPoll(RTI_RPC_SERVER *server, size_t *doneOut);
+
+/* C++ ---------------------------------------------------------------------------*/
+#ifdef __cplusplus
+}
+#endif
@@ -0,0 +1,126 @@
+/**
+ * @file rti_shm.h
+ * @author CYK-Dot
+ * @brief Shared-memory cross-process VLAN backend.
+ * @version 0.1
+ * @date 2026-10-16
+ *
+ * @copyright Copyright (c) 2025 CYK-Dot, MIT License.
+ */
+#pragma once
+
+/* Header import ------------------------------------------------------------------*/
+#include "rti_queue.h"
+
+/* Config macros -----------------------------------------------------------------*/
+
+/* Export macros -----------------------------------------------------------------*/
+
+/**
+ * @brief Define a VLAN interface backed by a named shared-memory queue.
+ *
+ * @param IFX_NAME Name of the RTI_SHM_IFX variable to define.
+ * @param SHM_NAME POSIX shared-memory name, like "/my_vlan".
+ * @param DEPTH Slot count of each lane, must be power of 2.
+ * @param MSG_SIZE Maximum message size in bytes.
+ * @param LANE_COUNT Priority lane count, 1 ~ RTI_QUEUE_LANES_MAX.
+ * @param SCHED Dequeue policy between lanes, see RTI_QUEUE_SCHED.
+ * @note createF opens the segment if another process created it,
+ *       otherwise creates it. pass &IFX_NAME.ifx to VLAN register macros.
+ */
+#define RTI_SHM_IFX_DEFINE(IFX_NAME, SHM_NAME, DEPTH, MSG_SIZE, LANE_COUNT, SCHED) \
+    static void *IFX_NAME##_Create(void); \
+    static void IFX_NAME##_Delete(void *vlan); \
+    static void *IFX_NAME##_CreateProducer(void); \
+    static void IFX_NAME##_DeleteProducer(void *producer); \
+    static void *IFX_NAME##_CreateConsumer(void); \
+    static void IFX_NAME##_DeleteConsumer(void *consumer); \
+    static RTI_SHM_IFX IFX_NAME = { \
+        .ifx = { \
+            .createF = IFX_NAME##_Create, \
+            .deleteF = IFX_NAME##_Delete, \
+            .createProducerF = IFX_NAME##_CreateProducer, \
+            .deleteProducerF = IFX_NAME##_DeleteProducer, \
+            .createConsumerF = IFX_NAME##_CreateConsumer, \
+            .deleteConsumerF = IFX_NAME##_DeleteConsumer, \
+            .sendF = RTI_ShmSend, \
+            .recvF = RTI_ShmRecv, \
+            .flowSetF = NULL, \
+            .flowGetF = RTI_ShmFlowGet, \
+            .recvWaitF = RTI_ShmRecvWait, \
+            .consumerFdF = NULL, \
+            .createIsrProducerF = NULL, \
+            .deleteIsrProducerF = NULL, \
+            .sendIsrF = NULL, \
+            .lazy = RTI_VLAN_LAZY_INIT, \
+            .recvArmF = NULL, \
+            .sendArmF = NULL, \
+        }, \
+        .name = SHM_NAME, \
+        .cfg = {DEPTH, MSG_SIZE, LANE_COUNT, SCHED, {0}, RTI_QUEUE_NUMA_NONE, 0}, \
+        .shm = NULL, \
+    }; \
+    static void *IFX_NAME##_Create(void) { return RTI_ShmIfxCreate(&IFX_NAME); } \
+    static void IFX_NAME##_Delete(void *vlan) { RTI_ShmIfxDelete(&IFX_NAME, vlan); } \
+    static void *IFX_NAME##_CreateProducer(void) { return RTI_ShmIfxCreateProducer(&IFX_NAME); } \
+    static void IFX_NAME##_DeleteProducer(void *producer) { RTI_ShmIfxDeleteProducer(&IFX_NAME, producer); } \
+    static void *IFX_NAME##_CreateConsumer(void) { return RTI_ShmIfxCreateConsumer(&IFX_NAME); } \
+    static void IFX_NAME##_DeleteConsumer(void *consumer) { RTI_ShmIfxDeleteConsumer(&IFX_NAME, consumer); }
+
+/* Exported typedef --------------------------------------------------------------*/
+
+typedef struct rti_shm RTI_SHM;
+
+/**
+ * @brief VLAN interface of shared-memory queue, defined by RTI_SHM_IFX_DEFINE.
+ *
+ */
+typedef struct {
+    RTI_VLAN_IFX ifx;
+    const char *name;
+    RTI_QUEUE_CFG cfg;
+    RTI_SHM *shm;
+} RTI_SHM_IFX;
+
+/* C++ ---------------------------------------------------------------------------*/
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Exported function -------------------------------------------------------------*/
+
+#if RTI_ENABLE_SHM == 1
+/* RTI exported functions */
+RTI_ERR RTI_ShmCreate(const char *name, const RTI_QUEUE_CFG *cfg, RTI_SHM **shmOut);
+RTI_ERR RTI_ShmOpen(const char *name, RTI_SHM **shmOut);
+RTI_ERR RTI_ShmOpenFd(int fd, RTI_SHM **shmOut);
+void RTI_ShmClose(RTI_SHM *shm);
+RTI_ERR RTI_ShmUnlink(const char *name);
+int RTI_ShmGetFd(RTI_SHM *shm);
+uint32_t RTI_ShmRecover(RTI_SHM *shm);
+RTI_ERR RTI_ShmProducerCreate(RTI_SHM *shm, void **producerOut);
+void RTI_ShmProducerDelete(void *producer);
+RTI_ERR RTI_ShmConsumerCreate(RTI_SHM *shm, void **consumerOut);
+void RTI_ShmConsumerDelete(void *consumer);
+RTI_ERR RTI_ShmSend(void *producer, const void *msg, size_t size, uint8_t lane);
+RTI_ERR RTI_ShmRecv(void *consumer, void *msg, size_t *size);
+RTI_ERR RTI_ShmRecvWait(void *consumer, void *msg, size_t *size, int32_t timeoutMs);
+RTI_ERR RTI_ShmSendAcquire(void *producer, size_t size, uint8_t lane, RTI_QUEUE_BUF *buf);
+RTI_ERR RTI_ShmSendCommit(void *producer, RTI_QUEUE_BUF *buf);
+RTI_ERR RTI_ShmRecvAcquire(void *consumer, RTI_QUEUE_BUF *buf);
+RTI_ERR RTI_ShmRecvRelease(void *consumer, RTI_QUEUE_BUF *buf);
+RTI_ERR RTI_ShmFlowGet(void *producer, RTI_VLAN_FLOW *flow);
+
+/* RTI private functions */
+void *RTI_ShmIfxCreate(RTI_SHM_IFX *ifx);
+void RTI_ShmIfxDelete(RTI_SHM_IFX *ifx, void *vlan);
+void *RTI_ShmIfxCreateProducer(RTI_SHM_IFX *ifx);
+void RTI_ShmIfxDeleteProducer(RTI_SHM_IFX *ifx, void *producer);
+void *RTI_ShmIfxCreateConsumer(RTI_SHM_IFX *ifx);
+void RTI_ShmIfxDeleteConsumer(RTI_SHM_IFX *ifx, void *consumer);
+#endif
+
+/* C++ ---------------------------------------------------------------------------*/
+#ifdef __cplusplus
+}
+#endif
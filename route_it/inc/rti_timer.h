@@ -0,0 +1,109 @@
+/**
+ * @file rti_timer.h
+ * @author CYK-Dot
+ * @brief Hierarchical timer wheel and timer service posting to VLANs.
+ * @version 0.1
+ * @date 2026-10-16
+ *
+ * @copyright Copyright (c) 2025 CYK-Dot, MIT License.
+ */
+#pragma once
+
+/* Header import ------------------------------------------------------------------*/
+#include <stdbool.h>
+#include "rti_internal.h"
+#include "rti_vlan.h"
+
+/* Config macros -----------------------------------------------------------------*/
+
+/* Export macros -----------------------------------------------------------------*/
+
+/**
+ * @brief Slot count of each timer wheel level.
+ */
+#define RTI_TIMER_WHEEL_SLOTS (1u << RTI_TIMER_WHEEL_BITS)
+
+/* Exported typedef --------------------------------------------------------------*/
+
+typedef struct rti_timer RTI_TIMER;
+typedef void (*RTI_TimerFptr)(RTI_TIMER *timer, void *arg);
+
+/**
+ * @brief Timer, embedded in its owner so start and cancel never allocate.
+ * @note fields are private, set them by RTI_TimerInit().
+ */
+struct rti_timer {
+    RTI_TIMER *next;
+    RTI_TIMER **pprev;                  /* NULL if timer is not pending */
+    uint64_t expire;
+    RTI_TimerFptr expireF;
+    void *arg;
+};
+
+/**
+ * @brief Timer wheel, time is counted in ticks of caller's choice.
+ * @note a wheel is not thread-safe, serialize calls on the same wheel.
+ */
+typedef struct {
+    uint64_t tick;                      /* next tick to process */
+    size_t pending;
+    RTI_TIMER *slots[RTI_TIMER_WHEEL_LEVELS][RTI_TIMER_WHEEL_SLOTS];
+} RTI_TIMER_WHEEL;
+
+/**
+ * @brief Timer service configuration.
+ *
+ */
+typedef struct {
+    uint32_t postMax;                   /* posts pending at the same time, must be power of 2 */
+    uint32_t msgSizeMax;                /* maximum message size of a post */
+    uint32_t tickMs;                    /* tick length of the dedicated thread, unused by RTI_TimerServiceTick */
+} RTI_TIMER_SERVICE_CFG;
+
+/**
+ * @brief Delayed or periodic message to a VLAN.
+ *
+ */
+typedef struct {
+    RTI_VlanId vlanId;
+    uint8_t lane;
+    uint32_t delay;                     /* ticks until the first post */
+    uint32_t period;                    /* ticks between posts, 0 posts once */
+} RTI_TIMER_POST_CFG;
+
+/**
+ * @brief Timer service, posts messages to VLANs at deadlines.
+ * @note driven by either RTI_TimerServiceTick() from an event loop,
+ *       or by the dedicated thread of RTI_TimerServiceStart(), not both.
+ */
+typedef struct rti_timer_service RTI_TIMER_SERVICE;
+
+/* C++ ---------------------------------------------------------------------------*/
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Exported function -------------------------------------------------------------*/
+
+/* RTI exported functions */
+RTI_ERR RTI_TimerWheelInit(RTI_TIMER_WHEEL *wheel, uint64_t now);
+uint64_t RTI_TimerWheelNow(const RTI_TIMER_WHEEL *wheel);
+uint64_t RTI_TimerWheelNext(const RTI_TIMER_WHEEL *wheel);
+RTI_ERR RTI_TimerWheelAdvance(RTI_TIMER_WHEEL *wheel, uint64_t now, size_t *expiredOut);
+void RTI_TimerInit(RTI_TIMER *timer, RTI_TimerFptr expireF, void *arg);
+RTI_ERR RTI_TimerStart(RTI_TIMER_WHEEL *wheel, RTI_TIMER *timer, uint64_t expire);
+void RTI_TimerCancel(RTI_TIMER_WHEEL *wheel, RTI_TIMER *timer);
+bool RTI_TimerIsPending(const RTI_TIMER *timer);
+RTI_ERR RTI_TimerServiceCreate(const RTI_TIMER_SERVICE_CFG *cfg, RTI_TIMER_SERVICE **serviceOut);
+void RTI_TimerServiceDelete(RTI_TIMER_SERVICE *service);
+RTI_ERR RTI_TimerServicePost(RTI_TIMER_SERVICE *service, const RTI_TIMER_POST_CFG *cfg, const void *msg, size_t size,
+                             uint32_t *postIdOut);
+RTI_ERR RTI_TimerServiceCancel(RTI_TIMER_SERVICE *service, uint32_t postId);
+RTI_ERR RTI_TimerServiceTick(RTI_TIMER_SERVICE *service, uint64_t now, size_t *postedOut);
+RTI_ERR RTI_TimerServiceStart(RTI_TIMER_SERVICE *service);
+RTI_ERR RTI_TimerServiceStop(RTI_TIMER_SERVICE *service);
+
+/* C++ ---------------------------------------------------------------------------*/
+#ifdef __cplusplus
+}
+#endif
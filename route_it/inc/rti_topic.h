@@ -0,0 +1,47 @@
+/**
+ * @file rti_topic.h
+ * @author CYK-Dot
+ * @brief Hierarchical topic router with wildcard subscriptions.
+ * @version 0.1
+ * @date 2026-10-16
+ *
+ * @copyright Copyright (c) 2025 CYK-Dot, MIT License.
+ */
+#pragma once
+
+/* Header import ------------------------------------------------------------------*/
+#include "rti_internal.h"
+#include "rti_vlan.h"
+
+/* Config macros -----------------------------------------------------------------*/
+
+/* Export macros -----------------------------------------------------------------*/
+
+/* Exported typedef --------------------------------------------------------------*/
+
+/**
+ * @brief Topic router, topics are levels separated by '/'.
+ * @note in a subscription filter, level "+" matches exactly one level,
+ *       and a last level "#" matches the parent level and any levels below.
+ *       a router is not thread-safe, serialize calls on the same router.
+ */
+typedef struct rti_topic_router RTI_TOPIC_ROUTER;
+
+/* C++ ---------------------------------------------------------------------------*/
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Exported function -------------------------------------------------------------*/
+
+/* RTI exported functions */
+RTI_ERR RTI_TopicCreate(RTI_TOPIC_ROUTER **routerOut);
+void RTI_TopicDelete(RTI_TOPIC_ROUTER *router);
+RTI_ERR RTI_TopicSubscribe(RTI_TOPIC_ROUTER *router, const char *filter, RTI_VlanId vlanId);
+RTI_ERR RTI_TopicUnsubscribe(RTI_TOPIC_ROUTER *router, const char *filter, RTI_VlanId vlanId);
+RTI_ERR RTI_TopicLookup(RTI_TOPIC_ROUTER *router, const char *topic, RTI_VlanId *vlanOut, size_t *count);
+
+/* C++ ---------------------------------------------------------------------------*/
+#ifdef __cplusplus
+}
+#endif
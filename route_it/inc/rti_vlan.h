@@ -1,124 +1,257 @@
-/**
- * @file rti_vlan.h
- * @author CYK-Dot
- * @brief Brief description
- * @version 0.1
- * @date 2025-10-04
- *
- * @copyright Copyright (c) 2025 CYK-Dot, MIT License.
- */
-#pragma once
-
-/* Header import ------------------------------------------------------------------*/
-#include "rti_internal.h"
-
-/* Config macros -----------------------------------------------------------------*/
-
-/* Export macros -----------------------------------------------------------------*/
-
-/**
- * @brief Register a static VLAN with VLAN ID auto destributed by python script.
- * 
- * @param VLAN_IFX_ADDRESS VLAN interface address,should be a pointer
- * @param VLAN_NAME VLAN name.
- */
-#define RTI_VLAN_REGISTER_STATIC(VLAN_IFX_ADDRESS, VLAN_NAME) \
-    const RTI_VLAN_DESC RTI_VLAN_##VLAN_NAME = { \
-        .ifx = VLAN_IFX_ADDRESS, \
-        .name = (char *)#VLAN_NAME, \
-        .id = RTI_VLANID_##VLAN_NAME, \
-    };\
-    RTI_TYPE_SECTION_VLAN_USED const RTI_VLAN_DESC *RTI_VLAN_##VLAN_NAME##_PTR = &RTI_VLAN_##VLAN_NAME
-
-/**
- * @brief Register a static VLAN with specified VLAN ID.
- * 
- * @param VLAN_IFX_ADDRESS VLAN interface address,should be a pointer
- * @param VLAN_NAME VLAN name.
- * @param VLAN_ID VLAN ID.
- */
-#define RTI_VLAN_REGISTER_STATIC_WITH_ID(VLAN_IFX_ADDRESS, VLAN_NAME, VLAN_ID) \
-    const RTI_VLAN_DESC RTI_VLAN_##VLAN_NAME = { \
-        .ifx = VLAN_IFX_ADDRESS, \
-        .name = (char *)#VLAN_NAME, \
-        .id = VLAN_ID, \
-    };\
-    RTI_TYPE_SECTION_VLAN_USED const RTI_VLAN_DESC *RTI_VLAN_##VLAN_NAME##_PTR = &RTI_VLAN_##VLAN_NAME
-
-/**
- * @brief Get the size of VLAN table in bytes.
- * 
- * @param RECORD_COUNT Number of VLAN records in the table.
- * @return size_t Size of VLAN table in bytes.
- */
-#define RTI_VLAN_VLANTABLE_SIZE(RECORD_COUNT) (sizeof(RTI_VLAN_RECORD) * (RECORD_COUNT))
-
-/* Exported typedef --------------------------------------------------------------*/
-
-typedef void* (*RTI_VlanCreateFptr)(void);
-typedef void (*RTI_VlanDeleteFptr)(void* vlan);
-typedef void* (*RTI_VlanCreateProducerFptr)(void);
-typedef void (*RTI_VlanDeleteProducerFptr)(void* producer);
-typedef void* (*RTI_VlanCreateConsumerFptr)(void);
-typedef void (*RTI_VlanDeleteConsumerFptr)(void* consumer);
-typedef uint16_t RTI_VlanId;
-
-/**
- * @brief VLAN interface structure.
- * 
- */
-typedef struct {
-    RTI_VlanCreateFptr createF;
-    RTI_VlanDeleteFptr deleteF;
-    RTI_VlanCreateProducerFptr createProducerF;
-    RTI_VlanDeleteProducerFptr deleteProducerF;
-    RTI_VlanCreateConsumerFptr createConsumerF;
-    RTI_VlanDeleteConsumerFptr deleteConsumerF;
-} RTI_VLAN_IFX;
-
-/**
- * @brief VLAN description structure.
- * 
- */
-typedef struct {
-    RTI_VLAN_IFX *ifx;
-    char *name;
-    RTI_VlanId id;
-} RTI_VLAN_DESC;
-
-/**
- * @brief VLAN record in VLAN-Table
- * @note VLAN table dont records VLAN description directly.
- *       instead, it records pointers to VLAN description.
- */
-typedef RTI_VLAN_DESC* RTI_VLAN_RECORD;
-
-/* C++ ---------------------------------------------------------------------------*/
-#ifdef __cplusplus
-extern "C" {
-#endif
-
-/* Exported function -------------------------------------------------------------*/
-
-/* RTI private functions */
-RTI_ERR RTIPriv_VlanSelect(RTI_VlanId id, RTI_VLAN_DESC *descOut);
-
-/* RTI exported functions */
-#if RTI_ENABLE_DYNAMIC_VLAN == 1
-RTI_ERR RTI_VlanDynamicSetup(void *start, size_t sizeBytes);
-RTI_ERR RTI_VlanDynamicRegister(RTI_VLAN_DESC *vlan);
-RTI_ERR RTI_VlanDynamicIsRegister(const RTI_VLAN_DESC *vlan);
-RTI_ERR RTI_VlanDynamicGetFreeCount(size_t *freeRecordCount);
-RTI_ERR RTI_VlanDynamicGetAllCount(size_t *allRecordCount);
-#endif
-
-/* RTI DFX functions */
-RTI_VLAN_RECORD *RTIDFX_VlanGetTableAddr(void);
-size_t RTIDFX_VlanGetTableRecordMaxCount(void);
-RTI_ERR RTIDFX_VlanTableForceSet(RTI_VLAN_RECORD *start, size_t sizeBytes);
-RTI_ERR RTIDFX_VlanTableUnregister(RTI_VlanId id);
-
-/* C++ ---------------------------------------------------------------------------*/
-#ifdef __cplusplus
-}
+/**
+ * @file rti_vlan.h
+ * @author CYK-Dot
+ * @brief Brief description
+ * @version 0.1
+ * @date 2025-10-04
+ *
+ * @copyright Copyright (c) 2025 CYK-Dot, MIT License.
+ */
+#pragma once
+
+/* Header import ------------------------------------------------------------------*/
+#include "rti_internal.h"
+
+/* Config macros -----------------------------------------------------------------*/
+
+/* Export macros -----------------------------------------------------------------*/
+
+/**
+ * @brief Register a static VLAN with VLAN ID auto destributed by python script.
+ * 
+ * @param VLAN_IFX_ADDRESS VLAN interface address,should be a pointer
+ * @param VLAN_NAME VLAN name.
+ */
+#define RTI_VLAN_REGISTER_STATIC(VLAN_IFX_ADDRESS, VLAN_NAME) \
+    RTI_TYPE_EXTERN_C const RTI_VLAN_DESC RTI_VLAN_##VLAN_NAME = { \
+        .ifx = VLAN_IFX_ADDRESS, \
+        .name = (char *)#VLAN_NAME, \
+        .id = RTI_VLANID_##VLAN_NAME, \
+        .lanes = 0, \
+    };\
+    RTI_TYPE_SECTION_VLAN_USED const RTI_VLAN_DESC *RTI_VLAN_##VLAN_NAME##_PTR = &RTI_VLAN_##VLAN_NAME
+
+/**
+ * @brief Register a static VLAN with specified VLAN ID.
+ * 
+ * @param VLAN_IFX_ADDRESS VLAN interface address,should be a pointer
+ * @param VLAN_NAME VLAN name.
+ * @param VLAN_ID VLAN ID.
+ */
+#define RTI_VLAN_REGISTER_STATIC_WITH_ID(VLAN_IFX_ADDRESS, VLAN_NAME, VLAN_ID) \
+    RTI_TYPE_EXTERN_C const RTI_VLAN_DESC RTI_VLAN_##VLAN_NAME = { \
+        .ifx = VLAN_IFX_ADDRESS, \
+        .name = (char *)#VLAN_NAME, \
+        .id = VLAN_ID, \
+        .lanes = 0, \
+    };\
+    RTI_TYPE_SECTION_VLAN_USED const RTI_VLAN_DESC *RTI_VLAN_##VLAN_NAME##_PTR = &RTI_VLAN_##VLAN_NAME
+
+/**
+ * @brief Get the size of VLAN table in bytes.
+ * 
+ * @param RECORD_COUNT Number of VLAN records in the table.
+ * @return size_t Size of VLAN table in bytes.
+ */
+#define RTI_VLAN_VLANTABLE_SIZE(RECORD_COUNT) (sizeof(RTI_VLAN_RECORD) * (RECORD_COUNT))
+
+/* Exported typedef --------------------------------------------------------------*/
+
+typedef void* (*RTI_VlanCreateFptr)(void);
+typedef void (*RTI_VlanDeleteFptr)(void* vlan);
+typedef void* (*RTI_VlanCreateProducerFptr)(void);
+typedef void (*RTI_VlanDeleteProducerFptr)(void* producer);
+typedef void* (*RTI_VlanCreateConsumerFptr)(void);
+typedef void (*RTI_VlanDeleteConsumerFptr)(void* consumer);
+typedef RTI_ERR (*RTI_VlanSendFptr)(void* producer, const void* msg, size_t size, uint8_t lane);
+typedef RTI_ERR (*RTI_VlanRecvFptr)(void* consumer, void* msg, size_t* size);
+typedef RTI_ERR (*RTI_VlanRecvWaitFptr)(void* consumer, void* msg, size_t* size, int32_t timeoutMs);
+typedef int (*RTI_VlanConsumerFdFptr)(void* consumer);
+typedef void (*RTI_VlanWakeFptr)(void* arg);
+typedef RTI_ERR (*RTI_VlanWaitArmFptr)(void* handle, RTI_VlanWakeFptr wakeF, void* arg);
+typedef void* (*RTI_VlanInstantiateFptr)(void* arg);
+typedef void (*RTI_VlanReleaseFptr)(void* arg, void* vlan);
+typedef uint16_t RTI_VlanId;
+
+/**
+ * @brief Flow state of a producer.
+ *
+ */
+typedef enum {
+    RTI_VLAN_FLOW_OPEN = 0,
+    RTI_VLAN_FLOW_THROTTLED,
+} RTI_VLAN_FLOW_STATE;
+
+/**
+ * @brief What a producer does when it runs out of credits.
+ *
+ */
+typedef enum {
+    RTI_VLAN_FLOW_MODE_NONBLOCK = 0,    /* send returns RTI_ERR_FLOW_THROTTLED */
+    RTI_VLAN_FLOW_MODE_BLOCK,           /* send sleeps until consumer drains to low watermark */
+    RTI_VLAN_FLOW_MODE_CALLBACK,        /* like NONBLOCK, and notifyF is called on state change */
+} RTI_VLAN_FLOW_MODE;
+
+typedef void (*RTI_VlanFlowNotifyFptr)(void* producer, RTI_VLAN_FLOW_STATE state, void* arg);
+
+/**
+ * @brief Flow control configuration of a producer.
+ * @note watermarks count queued messages of the whole VLAN,
+ *       highWatermark 0 means the VLAN capacity.
+ */
+typedef struct {
+    uint32_t highWatermark;
+    uint32_t lowWatermark;
+    uint8_t mode;
+    RTI_VlanFlowNotifyFptr notifyF;
+    void *notifyArg;
+} RTI_VLAN_FLOW_CFG;
+
+/**
+ * @brief Flow control status of a producer.
+ *
+ */
+typedef struct {
+    uint32_t credits;                   /* messages can be sent before throttled */
+    uint32_t capacity;                  /* messages the VLAN can hold */
+    uint8_t state;                      /* see RTI_VLAN_FLOW_STATE */
+} RTI_VLAN_FLOW;
+
+/**
+ * @brief Policy of a rate limited VLAN when its token bucket is empty.
+ *
+ */
+typedef enum {
+    RTI_VLAN_RATE_DROP = 0,             /* send returns RTI_ERR_RATE_LIMITED */
+    RTI_VLAN_RATE_BLOCK,                /* send sleeps until its token is refilled */
+    RTI_VLAN_RATE_DIVERT,               /* send goes to overflowVlan instead */
+} RTI_VLAN_RATE_POLICY;
+
+/**
+ * @brief Rate limit configuration of a VLAN.
+ * @note rate 0 disables the limiter, burst 0 means 1.
+ */
+typedef struct {
+    uint32_t rate;                      /* messages per second */
+    uint32_t burst;                     /* bucket size in messages */
+    uint8_t policy;                     /* see RTI_VLAN_RATE_POLICY */
+    RTI_VlanId overflowVlan;            /* destination of RTI_VLAN_RATE_DIVERT */
+} RTI_VLAN_RATE_CFG;
+
+/**
+ * @brief What a lazily instantiated VLAN does when its last handle detaches.
+ *
+ */
+typedef enum {
+    RTI_VLAN_IDLE_KEEP = 0,             /* keep it until deleteF */
+    RTI_VLAN_IDLE_DELETE,               /* delete it, the next attach creates it again */
+} RTI_VLAN_IDLE_POLICY;
+
+/**
+ * @brief Lazy instantiation state of a VLAN interface, owned by the framework.
+ * @note initialize it as RTI_VLAN_LAZY_INIT in RTI_VLAN_IFX initializers.
+ *       fields are plain to keep this header usable from C++, rti_vlan.c accesses them atomically.
+ */
+typedef struct {
+    void *vlan;                         /* backend VLAN, NULL until instantiated */
+    uint32_t attachCnt;                 /* alive handles */
+    uint8_t lock;                       /* held while the VLAN is created or deleted */
+    uint8_t idle;                       /* see RTI_VLAN_IDLE_POLICY */
+    uint8_t pinned;                     /* created by createF, only deleteF deletes it */
+} RTI_VLAN_LAZY;
+
+/**
+ * @brief Initializer of RTI_VLAN_LAZY, value-initialized in C++ so -Wextra stays quiet as it grows.
+ */
+#ifdef __cplusplus
+#define RTI_VLAN_LAZY_INIT {}
+#else
+#define RTI_VLAN_LAZY_INIT {0}
+#endif
+
+typedef RTI_ERR (*RTI_VlanFlowSetFptr)(void* producer, const RTI_VLAN_FLOW_CFG* cfg);
+typedef RTI_ERR (*RTI_VlanFlowGetFptr)(void* producer, RTI_VLAN_FLOW* flow);
+
+/**
+ * @brief VLAN interface structure.
+ * @note sendIsrF is the only function that may be called from interrupt or signal handlers,
+ *       with producers of createIsrProducerF: it never locks, allocates or loops unbounded.
+ *       built-in backends instantiate the VLAN on the first createXxxF of a handle,
+ *       an explicit createF only pins it until deleteF.
+ *       recvArmF and sendArmF arm a one-shot wakeF, called on the thread which makes
+ *       the handle ready again, they return RTI_ERR_ALREADY_READY instead if it already is.
+ *       members after deleteConsumerF are zero by default, initialize the struct by field name.
+ */
+typedef struct {
+    RTI_VlanCreateFptr createF;
+    RTI_VlanDeleteFptr deleteF;
+    RTI_VlanCreateProducerFptr createProducerF;
+    RTI_VlanDeleteProducerFptr deleteProducerF;
+    RTI_VlanCreateConsumerFptr createConsumerF;
+    RTI_VlanDeleteConsumerFptr deleteConsumerF;
+    RTI_VlanSendFptr sendF RTI_TYPE_DEFAULT(NULL);              /* optional, NULL if backend has no data path */
+    RTI_VlanRecvFptr recvF RTI_TYPE_DEFAULT(NULL);              /* optional, NULL if backend has no data path */
+    RTI_VlanFlowSetFptr flowSetF RTI_TYPE_DEFAULT(NULL);        /* optional, NULL if backend has no flow control */
+    RTI_VlanFlowGetFptr flowGetF RTI_TYPE_DEFAULT(NULL);        /* optional, NULL if backend has no flow control */
+    RTI_VlanRecvWaitFptr recvWaitF RTI_TYPE_DEFAULT(NULL);      /* optional, NULL if backend can not block consumers */
+    RTI_VlanConsumerFdFptr consumerFdF RTI_TYPE_DEFAULT(NULL);  /* optional, NULL if consumers are not pollable */
+    RTI_VlanCreateProducerFptr createIsrProducerF RTI_TYPE_DEFAULT(NULL);   /* optional, NULL if backend has no ISR path */
+    RTI_VlanDeleteProducerFptr deleteIsrProducerF RTI_TYPE_DEFAULT(NULL);   /* optional, NULL if backend has no ISR path */
+    RTI_VlanSendFptr sendIsrF RTI_TYPE_DEFAULT(NULL);           /* optional, must be wait-free and async-signal-safe */
+    RTI_VLAN_LAZY lazy RTI_TYPE_DEFAULT(RTI_VLAN_LAZY_INIT);   /* framework state, see RTIPriv_VlanAttach() */
+    RTI_VlanWaitArmFptr recvArmF RTI_TYPE_DEFAULT(NULL);        /* optional, NULL if producers can not wake consumers */
+    RTI_VlanWaitArmFptr sendArmF RTI_TYPE_DEFAULT(NULL);        /* optional, NULL if consumers can not wake producers */
+} RTI_VLAN_IFX;
+
+/**
+ * @brief VLAN description structure.
+ * 
+ */
+typedef struct {
+    RTI_VLAN_IFX *ifx;
+    char *name;
+    RTI_VlanId id;
+    uint8_t lanes RTI_TYPE_DEFAULT(0);  /* priority lane count, 0 means single lane */
+} RTI_VLAN_DESC;
+
+/**
+ * @brief VLAN record in VLAN-Table
+ * @note VLAN table dont records VLAN description directly.
+ *       instead, it records pointers to VLAN description.
+ */
+typedef RTI_VLAN_DESC* RTI_VLAN_RECORD;
+
+/* C++ ---------------------------------------------------------------------------*/
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Exported function -------------------------------------------------------------*/
+
+/* RTI private functions */
+RTI_ERR RTIPriv_VlanSelect(RTI_VlanId id, RTI_VLAN_DESC *descOut);
+void *RTIPriv_VlanAttach(RTI_VLAN_IFX *ifx, RTI_VlanInstantiateFptr createF, void *arg);
+void RTIPriv_VlanDetach(RTI_VLAN_IFX *ifx, RTI_VlanReleaseFptr deleteF, void *arg);
+void *RTIPriv_VlanPin(RTI_VLAN_IFX *ifx, RTI_VlanInstantiateFptr createF, void *arg);
+void RTIPriv_VlanUnpin(RTI_VLAN_IFX *ifx, void *vlan, RTI_VlanReleaseFptr deleteF, void *arg);
+
+/* RTI exported functions */
+RTI_ERR RTI_VlanIdleSet(RTI_VlanId id, uint8_t policy);
+#if RTI_ENABLE_DYNAMIC_VLAN == 1
+RTI_ERR RTI_VlanDynamicSetup(void *start, size_t sizeBytes);
+RTI_ERR RTI_VlanDynamicRegister(RTI_VLAN_DESC *vlan);
+RTI_ERR RTI_VlanDynamicIsRegister(const RTI_VLAN_DESC *vlan);
+RTI_ERR RTI_VlanDynamicGetFreeCount(size_t *freeRecordCount);
+RTI_ERR RTI_VlanDynamicGetAllCount(size_t *allRecordCount);
+#endif
+
+/* RTI DFX functions */
+RTI_VLAN_RECORD *RTIDFX_VlanGetTableAddr(void);
+size_t RTIDFX_VlanGetTableRecordMaxCount(void);
+RTI_ERR RTIDFX_VlanTableForceSet(RTI_VLAN_RECORD *start, size_t sizeBytes);
+RTI_ERR RTIDFX_VlanTableUnregister(RTI_VlanId id);
+
+/* C++ ---------------------------------------------------------------------------*/
+#ifdef __cplusplus
+}
 #endif
\ No newline at end of file
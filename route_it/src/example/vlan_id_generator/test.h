@@ -1,2 +1,2 @@
-RTI_VLAN_REGISTER_STATIC(0x0, haha);
-RTI_VLAN_REGISTER_STATIC(0x1, haha1);
+RTI_VLAN_REGISTER_STATIC(0x0, haha);
+RTI_VLAN_REGISTER_STATIC(0x1, haha1);
@@ -0,0 +1,324 @@
+/**
+ * @file rti_bridge.c
+ * @author CYK-Dot
+ * @brief VLAN bridge implementation.
+ * @version 0.1
+ * @date 2026-10-16
+ *
+ * @copyright Copyright (c) 2025 CYK-Dot, MIT License.
+ */
+
+/* Header import ------------------------------------------------------------------*/
+#include "rti_bridge.h"
+#include "rti_queue.h"
+#include <stdlib.h>
+#include <string.h>
+
+/* Private typedef ----------------------------------------------------------------*/
+
+/**
+ * @brief VLAN bridge, message buffer follows it in the same allocation.
+ * @note a message that the destination can not take yet is kept pending,
+ *       so a full destination throttles the bridge instead of losing messages.
+ */
+struct rti_bridge {
+    RTI_VLAN_DESC src;
+    RTI_VLAN_DESC dst;
+    void *consumer;
+    void *producer;
+    RTI_BridgeRouteFptr routeF;
+    void *routeArg;
+    uint32_t batch;
+    uint8_t dstLanes;
+    bool isQueue;                       /* both VLANs are built-in queues, move slot to slot */
+    RTI_QUEUE *inlineQueue;             /* source queue forwarding to us, NULL if not inline */
+    bool hasPending;
+    uint8_t pendingLane;
+    RTI_QUEUE_BUF pendingBuf;           /* claimed source slot, only if isQueue */
+    size_t pendingSize;                 /* size of message in buf, only if not isQueue */
+    size_t bufSize;
+    uint8_t buf[];
+};
+
+/* Private defines ----------------------------------------------------------------*/
+
+/* Global variables ---------------------------------------------------------------*/
+
+/* Private function prototypes ---------------------------------------------------*/
+
+/* Exported function prototypes --------------------------------------------------*/
+
+/* Private function definitions --------------------------------------------------*/
+
+/**
+ * @brief Decide destination lane of a message.
+ *
+ * @param bridge The bridge.
+ * @param msg The message.
+ * @param size The message size.
+ * @param lane [in] source lane, [out] destination lane.
+ * @return true Forward the message.
+ * @return false Drop the message.
+ */
+static inline bool RTI_BridgeRoute(RTI_BRIDGE *bridge, const void *msg, size_t size, uint8_t *lane)
+{
+    // destination with fewer lanes takes the rest on its lowest priority lane
+    if (*lane >= bridge->dstLanes) {
+        *lane = bridge->dstLanes - 1;
+    }
+    if (bridge->routeF == NULL) {
+        return true;
+    }
+    return bridge->routeF(msg, size, lane, bridge->routeArg);
+}
+
+/**
+ * @brief Forward function installed on source queue of an inline bridge.
+ *
+ * @param msg The message.
+ * @param size The message size.
+ * @param lane The source lane.
+ * @param arg The bridge.
+ * @return RTI_ERR Error code of the destination VLAN, RTI_OK if routing dropped it.
+ */
+static RTI_ERR RTI_BridgeForward(const void *msg, size_t size, uint8_t lane, void *arg)
+{
+    RTI_BRIDGE *bridge = (RTI_BRIDGE *)arg;
+    if (RTI_BridgeRoute(bridge, msg, size, &lane) == false) {
+        return RTI_OK;
+    }
+    return bridge->dst.ifx->sendF(bridge->producer, msg, size, lane);
+}
+
+/**
+ * @brief Check if sends of the source VLAN can be forwarded in producer context.
+ *
+ * @param bridge The bridge.
+ * @return true Source is a built-in queue, and neither VLAN has flow control or rate limit.
+ * @return false Messages have to be moved by RTI_BridgePoll().
+ * @note inline senders skip flow control of their source producer, and all of them
+ *       send through the one bridge producer, which is not safe for its divert state.
+ */
+static bool RTI_BridgeCanInline(RTI_BRIDGE *bridge)
+{
+    if (bridge->src.ifx->sendF != RTI_QueueSend) {
+        return false;
+    }
+    if (RTIPriv_QueueHasPolicy(RTIPriv_QueueGet(bridge->consumer, false)) == true) {
+        return false;
+    }
+    if (bridge->dst.ifx->sendF == RTI_QueueSend && RTIPriv_QueueHasPolicy(RTIPriv_QueueGet(bridge->producer, true)) == true) {
+        return false;
+    }
+    return true;
+}
+
+/**
+ * @brief Check if an error of destination only means it can not take a message now.
+ *
+ * @param err The error.
+ * @return true Retry the message on next poll.
+ * @return false The message can never be sent.
+ */
+static inline bool RTI_BridgeIsBusy(RTI_ERR err)
+{
+    return (err == RTI_ERR_QUEUE_FULL || err == RTI_ERR_FLOW_THROTTLED || err == RTI_ERR_RATE_LIMITED);
+}
+
+/**
+ * @brief Move one message between built-in queues, in place.
+ *
+ * @param bridge The bridge.
+ * @param moved Incremented if the message is forwarded.
+ * @return RTI_ERR RTI_ERR_QUEUE_EMPTY if nothing left, busy errors if destination is full.
+ */
+static RTI_ERR RTI_BridgeMoveQueue(RTI_BRIDGE *bridge, size_t *moved)
+{
+    RTI_QUEUE_BUF *in = &bridge->pendingBuf;
+    if (bridge->hasPending == false) {
+        RTI_ERR err = RTI_QueueRecvAcquire(bridge->consumer, in);
+        if (err != RTI_OK) {
+            return err;
+        }
+        bridge->pendingLane = in->lane;
+        if (RTI_BridgeRoute(bridge, in->data, in->size, &bridge->pendingLane) == false) {
+            return RTI_QueueRecvRelease(bridge->consumer, in);
+        }
+        bridge->hasPending = true;
+    }
+    RTI_QUEUE_BUF out;
+    RTI_ERR err = RTI_QueueSendAcquire(bridge->producer, in->size, bridge->pendingLane, &out);
+    if (RTI_BridgeIsBusy(err) == true) {
+        return err;
+    }
+    if (err == RTI_OK) {
+        memcpy(out.data, in->data, in->size);
+        err = RTI_QueueSendCommit(bridge->producer, &out);
+        *moved += (err == RTI_OK) ? 1 : 0;
+    }
+    bridge->hasPending = false;
+    RTI_ERR releaseErr = RTI_QueueRecvRelease(bridge->consumer, in);
+    return (err != RTI_OK) ? err : releaseErr;
+}
+
+/**
+ * @brief Move one message through the bridge buffer, for other backends.
+ *
+ * @param bridge The bridge.
+ * @param moved Incremented if the message is forwarded.
+ * @return RTI_ERR RTI_ERR_QUEUE_EMPTY if nothing left, busy errors if destination is full.
+ */
+static RTI_ERR RTI_BridgeMoveCopy(RTI_BRIDGE *bridge, size_t *moved)
+{
+    if (bridge->hasPending == false) {
+        size_t size = bridge->bufSize;
+        uint8_t lane = 0;
+        RTI_ERR err = bridge->src.ifx->recvF(bridge->consumer, bridge->buf, &size);
+        if (err != RTI_OK) {
+            return err;
+        }
+        if (RTI_BridgeRoute(bridge, bridge->buf, size, &lane) == false) {
+            return RTI_OK;
+        }
+        bridge->pendingSize = size;
+        bridge->pendingLane = lane;
+        bridge->hasPending = true;
+    }
+    RTI_ERR err = bridge->dst.ifx->sendF(bridge->producer, bridge->buf, bridge->pendingSize, bridge->pendingLane);
+    if (RTI_BridgeIsBusy(err) == false) {
+        bridge->hasPending = false;
+    }
+    *moved += (err == RTI_OK) ? 1 : 0;
+    return err;
+}
+
+/* Exported function definitions -------------------------------------------------*/
+
+/**
+ * @brief Create a bridge on created source and destination VLANs.
+ *
+ * @param cfg The configuration.
+ * @param bridgeOut Pointer to store the bridge.
+ * @return RTI_ERR Error code indicating success or failure.
+ * @note the bridge should be the only consumer of the source VLAN.
+ *       inline forwarding needs a source of built-in queue in this process,
+ *       and no flow control or rate limit on either VLAN when the bridge is created,
+ *       otherwise the bridge only moves messages in RTI_BridgePoll().
+ */
+RTI_ERR RTI_BridgeCreate(const RTI_BRIDGE_CFG *cfg, RTI_BRIDGE **bridgeOut)
+{
+    if (cfg == NULL || bridgeOut == NULL || cfg->srcVlan == cfg->dstVlan) {
+        return RTI_ERR_INVALID_PARAM;
+    }
+    RTI_VLAN_DESC src;
+    RTI_VLAN_DESC dst;
+    RTI_ERR err = RTIPriv_VlanSelect(cfg->srcVlan, &src);
+    if (err == RTI_OK) {
+        err = RTIPriv_VlanSelect(cfg->dstVlan, &dst);
+    }
+    if (err != RTI_OK) {
+        return err;
+    }
+    if (src.ifx->recvF == NULL || dst.ifx->sendF == NULL) {
+        return RTI_ERR_NOT_SUPPORTED;
+    }
+    bool isQueue = (src.ifx->recvF == RTI_QueueRecv && dst.ifx->sendF == RTI_QueueSend);
+    size_t bufSize = (isQueue == true) ? 0 : cfg->msgSizeMax;
+    if (isQueue == false && bufSize == 0) {
+        return RTI_ERR_INVALID_PARAM;
+    }
+    RTI_BRIDGE *bridge = (RTI_BRIDGE *)calloc(1, sizeof(RTI_BRIDGE) + bufSize);
+    if (bridge == NULL) {
+        return RTI_ERR_NO_MEMORY;
+    }
+    bridge->src = src;
+    bridge->dst = dst;
+    bridge->routeF = cfg->routeF;
+    bridge->routeArg = cfg->routeArg;
+    bridge->batch = (cfg->batch == 0) ? 1 : cfg->batch;
+    bridge->dstLanes = (dst.lanes == 0) ? 1 : dst.lanes;
+    bridge->isQueue = isQueue;
+    bridge->bufSize = bufSize;
+    bridge->consumer = src.ifx->createConsumerF();
+    bridge->producer = dst.ifx->createProducerF();
+    if (bridge->consumer == NULL || bridge->producer == NULL) {
+        RTI_BridgeDelete(bridge);
+        return RTI_ERR_FAILED;
+    }
+    if (cfg->inlineForward == true && RTI_BridgeCanInline(bridge) == true) {
+        RTI_QUEUE *queue = RTIPriv_QueueGet(bridge->consumer, false);
+        if (RTI_QueueForwardSet(queue, RTI_BridgeForward, bridge) == RTI_OK) {
+            bridge->inlineQueue = queue;
+        }
+    }
+    *bridgeOut = bridge;
+    return RTI_OK;
+}
+
+/**
+ * @brief Delete a bridge, a pending message is given back to the source VLAN.
+ *
+ * @param bridge The bridge.
+ * @note stop producers of an inline source before deleting.
+ */
+void RTI_BridgeDelete(RTI_BRIDGE *bridge)
+{
+    if (bridge == NULL) {
+        return;
+    }
+    if (bridge->inlineQueue != NULL) {
+        RTI_QueueForwardSet(bridge->inlineQueue, NULL, NULL);
+    }
+    if (bridge->hasPending == true && bridge->isQueue == true) {
+        RTI_QueueRecvRelease(bridge->consumer, &bridge->pendingBuf);
+    }
+    if (bridge->consumer != NULL) {
+        bridge->src.ifx->deleteConsumerF(bridge->consumer);
+    }
+    if (bridge->producer != NULL) {
+        bridge->dst.ifx->deleteProducerF(bridge->producer);
+    }
+    free(bridge);
+}
+
+/**
+ * @brief Move a batch of messages from source to destination VLAN.
+ *
+ * @param bridge The bridge.
+ * @param movedOut Pointer to store the count of forwarded messages, nullable.
+ * @return RTI_ERR RTI_OK when source is drained or destination is full,
+ *                 or error of a message that can never be forwarded, it is dropped.
+ * @note between built-in queues the message is copied slot to slot once,
+ *       without bridge buffer. a bridge is not thread-safe, poll it from one thread.
+ */
+RTI_ERR RTI_BridgePoll(RTI_BRIDGE *bridge, size_t *movedOut)
+{
+    if (bridge == NULL) {
+        return RTI_ERR_INVALID_PARAM;
+    }
+    size_t moved = 0;
+    RTI_ERR err = RTI_OK;
+    // messages dropped by routing count in the batch, but not as moved
+    for (uint32_t i = 0; i < bridge->batch && err == RTI_OK; i++) {
+        err = (bridge->isQueue == true) ? RTI_BridgeMoveQueue(bridge, &moved) : RTI_BridgeMoveCopy(bridge, &moved);
+    }
+    if (movedOut != NULL) {
+        *movedOut = moved;
+    }
+    if (err == RTI_ERR_QUEUE_EMPTY || RTI_BridgeIsBusy(err) == true) {
+        return RTI_OK;
+    }
+    return err;
+}
+
+/**
+ * @brief Check if a bridge forwards sends of its source VLAN in producer context.
+ *
+ * @param bridge The bridge.
+ * @return true Sends are forwarded inline, only RTI_QueueSendAcquire() messages need polling.
+ * @return false All messages are moved by RTI_BridgePoll().
+ */
+bool RTI_BridgeIsInline(const RTI_BRIDGE *bridge)
+{
+    return (bridge != NULL && bridge->inlineQueue != NULL);
+}
@@ -0,0 +1,521 @@
+/**
+ * @file rti_core.c
+ * @author CYK-Dot
+ * @brief RouteIt-Framework routing decision core implementation.
+ * @version 0.1
+ * @date 2026-10-16
+ *
+ * @copyright Copyright (c) 2025 CYK-Dot, MIT License.
+ */
+
+/* Header import ------------------------------------------------------------------*/
+#include "rti_core.h"
+#include <stdbool.h>
+#include <stdlib.h>
+#include <string.h>
+
+/* Private typedef ----------------------------------------------------------------*/
+
+/**
+ * @brief Count of message attribute fields, same order as RTI_ROUTE_MATCH_xxx bits.
+ */
+#define RTI_ROUTE_FIELD_COUNT 3
+
+typedef uint64_t RTI_ROUTE_MASK;
+
+/**
+ * @brief Rules matching one exact value of a field.
+ *
+ */
+typedef struct {
+    uint32_t value;
+    RTI_ROUTE_MASK rules;               /* includes rules with wildcard on the field */
+} RTI_ROUTE_ENTRY;
+
+/**
+ * @brief Decision table of one field, entries sorted by value.
+ *
+ */
+typedef struct {
+    const RTI_ROUTE_ENTRY *entries;
+    uint32_t count;
+    RTI_ROUTE_MASK anyRules;            /* rules matching values not in entries */
+} RTI_ROUTE_FIELD;
+
+/**
+ * @brief Compiled routing table, field entries follow it in the same allocation.
+ * @note a route is one lookup per field and an AND of their rule masks.
+ */
+struct rti_route_table {
+    RTI_ROUTE_FIELD fields[RTI_ROUTE_FIELD_COUNT];
+    uint32_t ruleCount;
+    RTI_VlanId vlans[RTI_ROUTE_RULES_MAX];
+    RTI_ROUTE_MASK dupRules[RTI_ROUTE_RULES_MAX];  /* later rules sending to the same VLAN */
+};
+
+/**
+ * @brief Filter condition compiled into a range check or a mask check.
+ *
+ */
+typedef struct {
+    uint16_t offset;
+    uint8_t width;
+    bool isMask;                        /* (field & a) == b, else (field - a) <= b */
+    bool invert;
+    uint64_t a;
+    uint64_t b;
+} RTI_FILTER_TERM;
+
+struct rti_filter {
+    size_t span;                        /* bytes of message read by conditions */
+    size_t count;
+    RTI_FILTER_TERM terms[];
+};
+
+/**
+ * @brief Messages evaluated per pass, one bit each in a uint64_t.
+ */
+#define RTI_FILTER_BLOCK 64
+#define RTI_FILTER_LANES 4
+
+typedef uint64_t RTI_FILTER_VEC __attribute__((vector_size(RTI_FILTER_LANES * sizeof(uint64_t))));
+
+/* Private defines ----------------------------------------------------------------*/
+
+/* Global variables ---------------------------------------------------------------*/
+
+/* Private function prototypes ---------------------------------------------------*/
+
+/* Exported function prototypes --------------------------------------------------*/
+
+/* Private function definitions --------------------------------------------------*/
+
+/**
+ * @brief Get a field of message attributes by index.
+ *
+ * @param attr The message attributes.
+ * @param field The field index, same order as RTI_ROUTE_MATCH_xxx bits.
+ * @return uint32_t The field value.
+ */
+static inline uint32_t RTI_RouteAttrGet(const RTI_ROUTE_ATTR *attr, uint8_t field)
+{
+    return (field == 0) ? attr->source : ((field == 1) ? attr->type : attr->key);
+}
+
+static int RTI_RouteValueCompare(const void *a, const void *b)
+{
+    uint32_t x = *(const uint32_t *)a;
+    uint32_t y = *(const uint32_t *)b;
+    return (x > y) - (x < y);
+}
+
+/**
+ * @brief Build sorted entries of one field.
+ *
+ * @param rules The rules.
+ * @param count The rule count.
+ * @param field The field index.
+ * @param entries Memory for at most count entries.
+ * @param fieldOut Pointer to store the field table.
+ */
+static void RTI_RouteFieldBuild(const RTI_ROUTE_RULE *rules, size_t count, uint8_t field,
+                                RTI_ROUTE_ENTRY *entries, RTI_ROUTE_FIELD *fieldOut)
+{
+    uint32_t values[RTI_ROUTE_RULES_MAX];
+    uint32_t valueCnt = 0;
+    RTI_ROUTE_MASK anyRules = 0;
+    for (size_t i = 0; i < count; i++) {
+        if ((rules[i].match & (1u << field)) == 0) {
+            anyRules |= (RTI_ROUTE_MASK)1 << i;
+        }
+        else {
+            values[valueCnt++] = RTI_RouteAttrGet(&rules[i].attr, field);
+        }
+    }
+    qsort(values, valueCnt, sizeof(values[0]), RTI_RouteValueCompare);
+    uint32_t entryCnt = 0;
+    for (uint32_t i = 0; i < valueCnt; i++) {
+        if (entryCnt > 0 && entries[entryCnt - 1].value == values[i]) {
+            continue;
+        }
+        entries[entryCnt].value = values[i];
+        entries[entryCnt].rules = anyRules;
+        entryCnt++;
+    }
+    for (size_t i = 0; i < count; i++) {
+        if ((rules[i].match & (1u << field)) == 0) {
+            continue;
+        }
+        uint32_t value = RTI_RouteAttrGet(&rules[i].attr, field);
+        RTI_ROUTE_ENTRY *entry = (RTI_ROUTE_ENTRY *)bsearch(&value, entries, entryCnt, sizeof(RTI_ROUTE_ENTRY), RTI_RouteValueCompare);
+        entry->rules |= (RTI_ROUTE_MASK)1 << i;
+    }
+    fieldOut->entries = entries;
+    fieldOut->count = entryCnt;
+    fieldOut->anyRules = anyRules;
+}
+
+/**
+ * @brief Get rules matching a field value.
+ *
+ * @param field The field table.
+ * @param value The field value of message.
+ * @return RTI_ROUTE_MASK The matching rules.
+ */
+static inline RTI_ROUTE_MASK RTI_RouteFieldMatch(const RTI_ROUTE_FIELD *field, uint32_t value)
+{
+    uint32_t low = 0;
+    uint32_t high = field->count;
+    while (low < high) {
+        uint32_t mid = (low + high) / 2;
+        if (field->entries[mid].value < value) {
+            low = mid + 1;
+        }
+        else {
+            high = mid;
+        }
+    }
+    if (low < field->count && field->entries[low].value == value) {
+        return field->entries[low].rules;
+    }
+    return field->anyRules;
+}
+
+/**
+ * @brief Compile a filter condition.
+ *
+ * @param cond The condition.
+ * @param term Pointer to store the compiled condition.
+ * @return true The condition is valid.
+ * @return false The condition is invalid.
+ */
+static bool RTI_FilterTermBuild(const RTI_FILTER_COND *cond, RTI_FILTER_TERM *term)
+{
+    if (cond->width != 1 && cond->width != 2 && cond->width != 4 && cond->width != 8) {
+        return false;
+    }
+    term->offset = cond->offset;
+    term->width = cond->width;
+    term->isMask = false;
+    term->invert = false;
+    term->a = 0;
+    switch (cond->op) {
+    case RTI_FILTER_OP_NE:
+        term->invert = true;
+        /* fall through */
+    case RTI_FILTER_OP_EQ:
+        term->a = cond->value;
+        term->b = 0;
+        return true;
+    case RTI_FILTER_OP_GE:
+        term->invert = true;
+        /* fall through */
+    case RTI_FILTER_OP_LT:
+        // field < 0 never matches, a full range inverted
+        term->b = (cond->value == 0) ? UINT64_MAX : cond->value - 1;
+        term->invert = (cond->value == 0) ? !term->invert : term->invert;
+        return true;
+    case RTI_FILTER_OP_GT:
+        term->invert = true;
+        /* fall through */
+    case RTI_FILTER_OP_LE:
+        term->b = cond->value;
+        return true;
+    case RTI_FILTER_OP_RANGE:
+        if (cond->value2 < cond->value) {
+            return false;
+        }
+        term->a = cond->value;
+        term->b = cond->value2 - cond->value;
+        return true;
+    case RTI_FILTER_OP_MASK:
+        term->isMask = true;
+        term->a = cond->value;
+        term->b = cond->value2;
+        return true;
+    default:
+        return false;
+    }
+}
+
+/**
+ * @brief Read an unsigned header field.
+ *
+ * @param field Start of the field, may be unaligned.
+ * @param width Field size in bytes.
+ * @return uint64_t The field value.
+ */
+static inline uint64_t RTI_FilterLoad(const uint8_t *field, uint8_t width)
+{
+    uint8_t value8;
+    uint16_t value16;
+    uint32_t value32;
+    uint64_t value64;
+    switch (width) {
+    case 1:
+        memcpy(&value8, field, 1);
+        return value8;
+    case 2:
+        memcpy(&value16, field, 2);
+        return value16;
+    case 4:
+        memcpy(&value32, field, 4);
+        return value32;
+    default:
+        memcpy(&value64, field, 8);
+        return value64;
+    }
+}
+
+/**
+ * @brief Evaluate a filter over one block of messages.
+ *
+ * @param filter The filter.
+ * @param msgs The first message.
+ * @param stride Bytes between messages.
+ * @param count Message count, at most RTI_FILTER_BLOCK.
+ * @return uint64_t Bit i set if message i passes.
+ * @note each condition gathers its field of all messages into a column,
+ *       then checks the column RTI_FILTER_LANES messages at a time.
+ */
+static uint64_t RTI_FilterBlock(const RTI_FILTER *filter, const uint8_t *msgs, size_t stride, size_t count)
+{
+    RTI_FILTER_VEC column[RTI_FILTER_BLOCK / RTI_FILTER_LANES];
+    size_t vecCnt = (count + RTI_FILTER_LANES - 1) / RTI_FILTER_LANES;
+    uint64_t pass = (count == RTI_FILTER_BLOCK) ? UINT64_MAX : (((uint64_t)1 << count) - 1);
+    for (size_t t = 0; t < filter->count && pass != 0; t++) {
+        const RTI_FILTER_TERM *term = &filter->terms[t];
+        for (size_t i = 0; i < vecCnt * RTI_FILTER_LANES; i++) {
+            column[i / RTI_FILTER_LANES][i % RTI_FILTER_LANES] =
+                (i < count) ? RTI_FilterLoad(msgs + i * stride + term->offset, term->width) : 0;
+        }
+        uint64_t bits = 0;
+        for (size_t v = 0; v < vecCnt; v++) {
+            RTI_FILTER_VEC hit;
+            if (term->isMask == true) {
+                hit = (RTI_FILTER_VEC)((column[v] & term->a) == term->b);
+            }
+            else {
+                hit = (RTI_FILTER_VEC)((column[v] - term->a) <= term->b);
+            }
+            for (size_t j = 0; j < RTI_FILTER_LANES; j++) {
+                bits |= (hit[j] & 1) << (v * RTI_FILTER_LANES + j);
+            }
+        }
+        pass &= (term->invert == true) ? ~bits : bits;
+    }
+    return pass;
+}
+
+/* Exported function definitions -------------------------------------------------*/
+
+/**
+ * @brief Compile routing rules into a routing table.
+ *
+ * @param rules The rules, copied into the table.
+ * @param count The rule count, at most RTI_ROUTE_RULES_MAX.
+ * @param tableOut Pointer to store the routing table.
+ * @return RTI_ERR Error code indicating success or failure.
+ * @note VLAN IDs are not checked here, VLANs may be registered later.
+ */
+RTI_ERR RTI_RouteCreate(const RTI_ROUTE_RULE *rules, size_t count, RTI_ROUTE_TABLE **tableOut)
+{
+    if ((rules == NULL && count > 0) || count > RTI_ROUTE_RULES_MAX || tableOut == NULL) {
+        return RTI_ERR_INVALID_PARAM;
+    }
+    for (size_t i = 0; i < count; i++) {
+        if ((rules[i].match & ~RTI_ROUTE_MATCH_ALL) != 0) {
+            return RTI_ERR_INVALID_PARAM;
+        }
+    }
+    size_t sizeBytes = sizeof(RTI_ROUTE_TABLE) + RTI_ROUTE_FIELD_COUNT * count * sizeof(RTI_ROUTE_ENTRY);
+    RTI_ROUTE_TABLE *table = (RTI_ROUTE_TABLE *)calloc(1, sizeBytes);
+    if (table == NULL) {
+        return RTI_ERR_NO_MEMORY;
+    }
+    RTI_ROUTE_ENTRY *entries = (RTI_ROUTE_ENTRY *)(table + 1);
+    for (uint8_t field = 0; field < RTI_ROUTE_FIELD_COUNT; field++) {
+        RTI_RouteFieldBuild(rules, count, field, entries + field * count, &table->fields[field]);
+    }
+    table->ruleCount = (uint32_t)count;
+    for (size_t i = 0; i < count; i++) {
+        table->vlans[i] = rules[i].vlanId;
+        for (size_t j = i + 1; j < count; j++) {
+            if (rules[j].vlanId == rules[i].vlanId) {
+                table->dupRules[i] |= (RTI_ROUTE_MASK)1 << j;
+            }
+        }
+    }
+    *tableOut = table;
+    return RTI_OK;
+}
+
+/**
+ * @brief Delete a routing table.
+ *
+ * @param table The routing table.
+ */
+void RTI_RouteDelete(RTI_ROUTE_TABLE *table)
+{
+    free(table);
+}
+
+/**
+ * @brief Decide destination VLANs of a message.
+ *
+ * @param table The routing table.
+ * @param attr The message attributes.
+ * @param vlanOut Buffer to store VLAN IDs, in rule order and without duplicates.
+ * @param count [in] buffer length, [out] VLAN count.
+ * @return RTI_ERR RTI_ERR_OBJECT_EMPTY if no rule matches,
+ *                 RTI_ERR_INVALID_PARAM with count set to the VLAN count if buffer is too short.
+ */
+RTI_ERR RTI_RouteLookup(const RTI_ROUTE_TABLE *table, const RTI_ROUTE_ATTR *attr, RTI_VlanId *vlanOut, size_t *count)
+{
+    if (table == NULL || attr == NULL || count == NULL || (vlanOut == NULL && *count > 0)) {
+        return RTI_ERR_INVALID_PARAM;
+    }
+    RTI_ROUTE_MASK match = RTI_RouteFieldMatch(&table->fields[0], attr->source)
+                         & RTI_RouteFieldMatch(&table->fields[1], attr->type)
+                         & RTI_RouteFieldMatch(&table->fields[2], attr->key);
+    return RTIPriv_RouteEmit(table->vlans, table->dupRules, match, vlanOut, count);
+}
+
+/**
+ * @brief Write VLANs of matched rules, shared by compiled and generated routing tables.
+ *
+ * @param vlans VLAN ID of each rule.
+ * @param dupRules Later rules sending to the same VLAN, of each rule.
+ * @param match The matched rules.
+ * @param vlanOut Buffer to store VLAN IDs.
+ * @param count [in] buffer length, [out] VLAN count.
+ * @return RTI_ERR see RTI_RouteLookup().
+ * @note this function is only for RTI internal use.
+ */
+RTI_ERR RTIPriv_RouteEmit(const RTI_VlanId *vlans, const uint64_t *dupRules, uint64_t match,
+                          RTI_VlanId *vlanOut, size_t *count)
+{
+    if (count == NULL || (vlanOut == NULL && *count > 0)) {
+        return RTI_ERR_INVALID_PARAM;
+    }
+    size_t found = 0;
+    while (match != 0) {
+        uint32_t rule = (uint32_t)__builtin_ctzll(match);
+        match &= ~dupRules[rule];
+        match &= match - 1;
+        if (found < *count) {
+            vlanOut[found] = vlans[rule];
+        }
+        found++;
+    }
+    size_t capacity = *count;
+    *count = found;
+    if (found == 0) {
+        return RTI_ERR_OBJECT_EMPTY;
+    }
+    return (found > capacity) ? RTI_ERR_INVALID_PARAM : RTI_OK;
+}
+
+/**
+ * @brief Compile filter conditions of a consumer.
+ *
+ * @param conds The conditions, copied into the filter.
+ * @param count The condition count, 0 makes a filter passing every message.
+ * @param filterOut Pointer to store the filter.
+ * @return RTI_ERR Error code indicating success or failure.
+ */
+RTI_ERR RTI_FilterCreate(const RTI_FILTER_COND *conds, size_t count, RTI_FILTER **filterOut)
+{
+    if ((conds == NULL && count > 0) || filterOut == NULL) {
+        return RTI_ERR_INVALID_PARAM;
+    }
+    RTI_FILTER *filter = (RTI_FILTER *)malloc(sizeof(RTI_FILTER) + count * sizeof(RTI_FILTER_TERM));
+    if (filter == NULL) {
+        return RTI_ERR_NO_MEMORY;
+    }
+    filter->span = 0;
+    filter->count = count;
+    for (size_t i = 0; i < count; i++) {
+        if (RTI_FilterTermBuild(&conds[i], &filter->terms[i]) == false) {
+            free(filter);
+            return RTI_ERR_INVALID_PARAM;
+        }
+        size_t end = (size_t)conds[i].offset + conds[i].width;
+        filter->span = (end > filter->span) ? end : filter->span;
+    }
+    *filterOut = filter;
+    return RTI_OK;
+}
+
+/**
+ * @brief Delete a filter.
+ *
+ * @param filter The filter.
+ */
+void RTI_FilterDelete(RTI_FILTER *filter)
+{
+    free(filter);
+}
+
+/**
+ * @brief Evaluate a filter over a batch of messages.
+ *
+ * @param filter The filter.
+ * @param msgs The messages, stored every stride bytes.
+ * @param stride Bytes between messages, must cover all filtered fields.
+ * @param count Message count.
+ * @param matchOut Bitmap of (count + 63) / 64 words, bit i set if message i passes.
+ * @return RTI_ERR Error code indicating success or failure.
+ */
+RTI_ERR RTI_FilterEval(const RTI_FILTER *filter, const void *msgs, size_t stride, size_t count, uint64_t *matchOut)
+{
+    if (filter == NULL || (count > 0 && (msgs == NULL || matchOut == NULL || stride < filter->span))) {
+        return RTI_ERR_INVALID_PARAM;
+    }
+    for (size_t done = 0; done < count; done += RTI_FILTER_BLOCK) {
+        size_t block = (count - done < RTI_FILTER_BLOCK) ? count - done : RTI_FILTER_BLOCK;
+        matchOut[done / RTI_FILTER_BLOCK] = RTI_FilterBlock(filter, (const uint8_t *)msgs + done * stride, stride, block);
+    }
+    return RTI_OK;
+}
+
+/**
+ * @brief Send messages passing a filter to the VLAN of a consumer, drop the others.
+ *
+ * @param filter The filter of the consumer.
+ * @param ifx The VLAN interface.
+ * @param producer The producer of the VLAN.
+ * @param msgs The messages, stored every stride bytes.
+ * @param stride Bytes between messages, also the size of each sent message.
+ * @param count Message count.
+ * @param lane The priority lane.
+ * @param doneOut Pointer to store count of messages sent or dropped, stops at the first failed send.
+ * @return RTI_ERR Error of the first failed send, or RTI_OK.
+ */
+RTI_ERR RTI_FilterSend(const RTI_FILTER *filter, const RTI_VLAN_IFX *ifx, void *producer,
+                       const void *msgs, size_t stride, size_t count, uint8_t lane, size_t *doneOut)
+{
+    if (filter == NULL || ifx == NULL || doneOut == NULL || (count > 0 && (msgs == NULL || stride < filter->span))) {
+        return RTI_ERR_INVALID_PARAM;
+    }
+    if (ifx->sendF == NULL) {
+        return RTI_ERR_NOT_SUPPORTED;
+    }
+    *doneOut = 0;
+    for (size_t done = 0; done < count; done += RTI_FILTER_BLOCK) {
+        size_t block = (count - done < RTI_FILTER_BLOCK) ? count - done : RTI_FILTER_BLOCK;
+        const uint8_t *base = (const uint8_t *)msgs + done * stride;
+        uint64_t pass = RTI_FilterBlock(filter, base, stride, block);
+        while (pass != 0) {
+            uint32_t i = (uint32_t)__builtin_ctzll(pass);
+            RTI_ERR err = ifx->sendF(producer, base + i * stride, stride, lane);
+            if (err != RTI_OK) {
+                *doneOut = done + i;
+                return err;
+            }
+            pass &= pass - 1;
+        }
+        *doneOut = done + block;
+    }
+    return RTI_OK;
+}
@@ -0,0 +1,714 @@
+/**
+ * @file rti_dispatch.c
+ * @author CYK-Dot
+ * @brief Dispatcher group implementation.
+ * @version 0.1
+ * @date 2026-10-16
+ *
+ * @copyright Copyright (c) 2025 CYK-Dot, MIT License.
+ */
+
+/* Header import ------------------------------------------------------------------*/
+#include "rti_dispatch.h"
+#include "rti_queue.h"
+#include "rti_os.h"
+#include <stdatomic.h>
+#include <stdlib.h>
+#include <string.h>
+
+/* Private typedef ----------------------------------------------------------------*/
+
+/**
+ * @brief VLAN consumed by a group.
+ *
+ */
+typedef struct {
+    RTI_VLAN_DESC desc;
+    RTI_DispatchFptr handlerF;
+    void *arg;
+    bool isQueue;                       /* built-in queue, messages are handed over in place */
+    atomic_uint token;                  /* steal only, 1 while a thread holds the VLAN task */
+    void *consumer;                     /* steal only, used by the token holder */
+} RTI_DISPATCH_ENTRY;
+
+/**
+ * @brief Chase-Lev deque of VLAN tasks, the owner pushes and pops at bottom, thieves take from top.
+ * @note a VLAN task exists once while its token is held, so the deque never overflows.
+ */
+typedef struct {
+    _Alignas(RTI_CACHELINE_SIZE) atomic_int_least64_t top;
+    _Alignas(RTI_CACHELINE_SIZE) atomic_int_least64_t bottom;
+    atomic_uint tasks[RTI_DISPATCH_VLANS_MAX];
+} RTI_DISPATCH_DEQUE;
+
+/**
+ * @brief Consumers of all VLANs in a group, owned by one thread.
+ *
+ */
+typedef struct {
+    RTI_DISPATCH_GROUP *group;
+    uint32_t index;
+    RTI_OS_THREAD thread;
+    int pollFd;                         /* -1 if a consumer is not pollable */
+    uint32_t next;                      /* VLAN served first in next round, or scanned first by steal */
+    uint32_t consumerCnt;
+    void *consumers[RTI_DISPATCH_VLANS_MAX];
+    uint8_t *buf;                       /* msgSizeMax bytes */
+    RTI_DISPATCH_DEQUE deque;           /* steal only */
+} RTI_DISPATCH_WORKER;
+
+/**
+ * @brief Dispatcher group, workers and their buffers follow it in the same allocation.
+ * @note workers[threads] belongs to RTI_DispatchGroupPoll().
+ */
+struct rti_dispatch_group {
+    RTI_DISPATCH_GROUP_CFG cfg;
+    atomic_bool running;
+    atomic_uint readyCnt;
+    atomic_int startErr;
+    int stopFd;                         /* readable while threads should exit */
+    int stealPollFd;                    /* steal only, fds of all VLAN consumers, -1 if not pollable */
+    bool isPollOpen;
+    uint32_t entryCnt;
+    RTI_DISPATCH_ENTRY entries[RTI_DISPATCH_VLANS_MAX];
+    RTI_DISPATCH_WORKER workers[];
+};
+
+/* Private defines ----------------------------------------------------------------*/
+
+#define RTI_DISPATCH_IDLE_US_DEFAULT 100
+
+#define RTI_DISPATCH_TASK_NONE UINT32_MAX
+
+#define RTI_DISPATCH_DEQUE_MASK ((int_least64_t)RTI_DISPATCH_VLANS_MAX - 1)
+
+_Static_assert((RTI_DISPATCH_VLANS_MAX & (RTI_DISPATCH_VLANS_MAX - 1)) == 0, "RTI_DISPATCH_VLANS_MAX must be power of 2");
+
+/* Global variables ---------------------------------------------------------------*/
+
+/* Private function prototypes ---------------------------------------------------*/
+
+/* Exported function prototypes --------------------------------------------------*/
+
+/* Private function definitions --------------------------------------------------*/
+
+/**
+ * @brief Delete consumers of a worker.
+ *
+ * @param worker The worker.
+ */
+static void RTI_DispatchWorkerClose(RTI_DISPATCH_WORKER *worker)
+{
+    RTI_DISPATCH_GROUP *group = worker->group;
+    for (uint32_t i = 0; i < worker->consumerCnt; i++) {
+        group->entries[i].desc.ifx->deleteConsumerF(worker->consumers[i]);
+        worker->consumers[i] = NULL;
+    }
+    worker->consumerCnt = 0;
+    if (worker->pollFd >= 0) {
+        RTIPriv_OsEventClose(worker->pollFd);
+        worker->pollFd = -1;
+    }
+}
+
+/**
+ * @brief Create consumers of a worker in the calling thread.
+ *
+ * @param worker The worker.
+ * @param isPollable Wait for messages on a poll set of consumer fds.
+ * @return RTI_ERR Error code indicating success or failure.
+ * @note if a VLAN has no pollable consumer, the worker sleeps idleUs when idle instead.
+ */
+static RTI_ERR RTI_DispatchWorkerOpen(RTI_DISPATCH_WORKER *worker, bool isPollable)
+{
+    RTI_DISPATCH_GROUP *group = worker->group;
+    worker->next = 0;
+    for (uint32_t i = 0; i < group->entryCnt; i++) {
+        worker->consumers[i] = group->entries[i].desc.ifx->createConsumerF();
+        if (worker->consumers[i] == NULL) {
+            RTI_DispatchWorkerClose(worker);
+            return RTI_ERR_FAILED;
+        }
+        worker->consumerCnt++;
+    }
+    worker->pollFd = (isPollable == true) ? RTIPriv_OsPollCreate() : -1;
+    if (worker->pollFd < 0) {
+        return RTI_OK;
+    }
+    RTI_ERR err = RTIPriv_OsPollAdd(worker->pollFd, group->stopFd);
+    for (uint32_t i = 0; i < worker->consumerCnt && err == RTI_OK; i++) {
+        RTI_VLAN_IFX *ifx = group->entries[i].desc.ifx;
+        int fd = (ifx->consumerFdF != NULL) ? ifx->consumerFdF(worker->consumers[i]) : -1;
+        err = (fd >= 0) ? RTIPriv_OsPollAdd(worker->pollFd, fd) : RTI_ERR_NOT_SUPPORTED;
+    }
+    if (err != RTI_OK) {
+        RTIPriv_OsEventClose(worker->pollFd);
+        worker->pollFd = -1;
+    }
+    return RTI_OK;
+}
+
+/**
+ * @brief Hand one message of a VLAN to its callback.
+ *
+ * @param entry The VLAN.
+ * @param consumer Consumer of the worker.
+ * @param buf Receive buffer of the worker.
+ * @param bufSize Size of buf.
+ * @return RTI_ERR RTI_ERR_QUEUE_EMPTY if nothing left.
+ */
+static RTI_ERR RTI_DispatchOne(RTI_DISPATCH_ENTRY *entry, void *consumer, uint8_t *buf, size_t bufSize)
+{
+    if (entry->isQueue == true) {
+        RTI_QUEUE_BUF in;
+        RTI_ERR err = RTI_QueueRecvAcquire(consumer, &in);
+        if (err != RTI_OK) {
+            return err;
+        }
+        entry->handlerF(entry->desc.id, in.data, in.size, entry->arg);
+        return RTI_QueueRecvRelease(consumer, &in);
+    }
+    size_t size = bufSize;
+    RTI_ERR err = entry->desc.ifx->recvF(consumer, buf, &size);
+    if (err != RTI_OK) {
+        return err;
+    }
+    entry->handlerF(entry->desc.id, buf, size, entry->arg);
+    return RTI_OK;
+}
+
+/**
+ * @brief Serve every VLAN of a worker once, up to a batch each.
+ *
+ * @param worker The worker.
+ * @return size_t Count of dispatched messages, 0 if every VLAN was empty.
+ * @note the VLAN served first rotates, so a busy VLAN can not starve the others.
+ */
+static size_t RTI_DispatchWorkerRound(RTI_DISPATCH_WORKER *worker)
+{
+    RTI_DISPATCH_GROUP *group = worker->group;
+    uint32_t batch = (group->cfg.batch == 0) ? 1 : group->cfg.batch;
+    size_t dispatched = 0;
+    for (uint32_t k = 0; k < worker->consumerCnt; k++) {
+        uint32_t i = (worker->next + k) % worker->consumerCnt;
+        for (uint32_t n = 0; n < batch; n++) {
+            if (RTI_DispatchOne(&group->entries[i], worker->consumers[i], worker->buf, group->cfg.msgSizeMax) != RTI_OK) {
+                break;
+            }
+            dispatched++;
+        }
+    }
+    if (worker->consumerCnt > 0) {
+        worker->next = (worker->next + 1) % worker->consumerCnt;
+    }
+    return dispatched;
+}
+
+/**
+ * @brief Push a task at bottom of the own deque.
+ *
+ * @param deque The deque of the calling worker.
+ * @param task The VLAN index.
+ */
+static void RTI_DispatchDequePush(RTI_DISPATCH_DEQUE *deque, uint32_t task)
+{
+    int_least64_t bottom = atomic_load_explicit(&deque->bottom, memory_order_relaxed);
+    atomic_store_explicit(&deque->tasks[bottom & RTI_DISPATCH_DEQUE_MASK], task, memory_order_relaxed);
+    atomic_thread_fence(memory_order_release);
+    atomic_store_explicit(&deque->bottom, bottom + 1, memory_order_relaxed);
+}
+
+/**
+ * @brief Pop a task from bottom of the own deque.
+ *
+ * @param deque The deque of the calling worker.
+ * @return uint32_t The VLAN index, RTI_DISPATCH_TASK_NONE if empty.
+ */
+static uint32_t RTI_DispatchDequePop(RTI_DISPATCH_DEQUE *deque)
+{
+    int_least64_t bottom = atomic_load_explicit(&deque->bottom, memory_order_relaxed) - 1;
+    atomic_store_explicit(&deque->bottom, bottom, memory_order_relaxed);
+    atomic_thread_fence(memory_order_seq_cst);
+    int_least64_t top = atomic_load_explicit(&deque->top, memory_order_relaxed);
+    if (top > bottom) {
+        atomic_store_explicit(&deque->bottom, bottom + 1, memory_order_relaxed);
+        return RTI_DISPATCH_TASK_NONE;
+    }
+    uint32_t task = atomic_load_explicit(&deque->tasks[bottom & RTI_DISPATCH_DEQUE_MASK], memory_order_relaxed);
+    if (top == bottom) {
+        // the last task, thieves race for it on top
+        if (atomic_compare_exchange_strong_explicit(&deque->top, &top, top + 1,
+                                                    memory_order_seq_cst, memory_order_relaxed) == false) {
+            task = RTI_DISPATCH_TASK_NONE;
+        }
+        atomic_store_explicit(&deque->bottom, bottom + 1, memory_order_relaxed);
+    }
+    return task;
+}
+
+/**
+ * @brief Steal a task from top of another deque.
+ *
+ * @param deque The deque of the victim.
+ * @return uint32_t The VLAN index, RTI_DISPATCH_TASK_NONE if empty or lost the race.
+ */
+static uint32_t RTI_DispatchDequeSteal(RTI_DISPATCH_DEQUE *deque)
+{
+    int_least64_t top = atomic_load_explicit(&deque->top, memory_order_acquire);
+    atomic_thread_fence(memory_order_seq_cst);
+    int_least64_t bottom = atomic_load_explicit(&deque->bottom, memory_order_acquire);
+    if (top >= bottom) {
+        return RTI_DISPATCH_TASK_NONE;
+    }
+    uint32_t task = atomic_load_explicit(&deque->tasks[top & RTI_DISPATCH_DEQUE_MASK], memory_order_relaxed);
+    if (atomic_compare_exchange_strong_explicit(&deque->top, &top, top + 1,
+                                                memory_order_seq_cst, memory_order_relaxed) == false) {
+        return RTI_DISPATCH_TASK_NONE;
+    }
+    return task;
+}
+
+/**
+ * @brief Deliver a batch of a VLAN whose token the worker holds.
+ *
+ * @param worker The worker.
+ * @param task The VLAN index.
+ * @return size_t Count of dispatched messages.
+ * @note a full batch may have more behind it, the task goes back on the own deque
+ *       with the token, where idle workers can steal it. otherwise the token is released.
+ */
+static size_t RTI_DispatchTaskRun(RTI_DISPATCH_WORKER *worker, uint32_t task)
+{
+    RTI_DISPATCH_GROUP *group = worker->group;
+    RTI_DISPATCH_ENTRY *entry = &group->entries[task];
+    uint32_t batch = (group->cfg.batch == 0) ? 1 : group->cfg.batch;
+    size_t dispatched = 0;
+    while (dispatched < batch &&
+           RTI_DispatchOne(entry, entry->consumer, worker->buf, group->cfg.msgSizeMax) == RTI_OK) {
+        dispatched++;
+    }
+    if (dispatched == batch) {
+        RTI_DispatchDequePush(&worker->deque, task);
+    }
+    else {
+        atomic_store_explicit(&entry->token, 0, memory_order_release);
+    }
+    return dispatched;
+}
+
+/**
+ * @brief Take a task of the own deque, or steal one of another worker.
+ *
+ * @param worker The worker.
+ * @return uint32_t The VLAN index, RTI_DISPATCH_TASK_NONE if every deque is empty.
+ */
+static uint32_t RTI_DispatchTaskFind(RTI_DISPATCH_WORKER *worker)
+{
+    RTI_DISPATCH_GROUP *group = worker->group;
+    uint32_t task = RTI_DispatchDequePop(&worker->deque);
+    for (uint32_t k = 1; k < group->cfg.threads && task == RTI_DISPATCH_TASK_NONE; k++) {
+        task = RTI_DispatchDequeSteal(&group->workers[(worker->index + k) % group->cfg.threads].deque);
+    }
+    return task;
+}
+
+/**
+ * @brief Run a batch of every VLAN no worker holds.
+ *
+ * @param worker The worker.
+ * @return size_t Count of dispatched messages, 0 if those VLANs are empty.
+ */
+static size_t RTI_DispatchTaskScan(RTI_DISPATCH_WORKER *worker)
+{
+    RTI_DISPATCH_GROUP *group = worker->group;
+    size_t dispatched = 0;
+    for (uint32_t k = 0; k < group->entryCnt; k++) {
+        uint32_t i = (worker->next + k) % group->entryCnt;
+        unsigned idle = 0;
+        if (atomic_compare_exchange_strong_explicit(&group->entries[i].token, &idle, 1,
+                                                    memory_order_acquire, memory_order_relaxed) == true) {
+            dispatched += RTI_DispatchTaskRun(worker, i);
+        }
+    }
+    worker->next = (worker->next + 1) % group->entryCnt;
+    return dispatched;
+}
+
+/**
+ * @brief Loop of a dispatcher thread with work stealing.
+ *
+ * @param worker The worker.
+ * @param idleNs Sleep between idle rounds while another worker holds a VLAN with messages.
+ */
+static void RTI_DispatchStealLoop(RTI_DISPATCH_WORKER *worker, uint64_t idleNs)
+{
+    RTI_DISPATCH_GROUP *group = worker->group;
+    bool wasIdle = false;
+    while (atomic_load_explicit(&group->running, memory_order_acquire) == true) {
+        uint32_t task = RTI_DispatchTaskFind(worker);
+        if (task != RTI_DISPATCH_TASK_NONE) {
+            RTI_DispatchTaskRun(worker, task);
+            wasIdle = false;
+            continue;
+        }
+        if (RTI_DispatchTaskScan(worker) > 0) {
+            wasIdle = false;
+            continue;
+        }
+        // fd of a VLAN held by another worker stays readable, back off instead of spinning on it
+        if (wasIdle == true || group->stealPollFd < 0) {
+            RTIPriv_OsSleepNs(idleNs);
+        }
+        if (group->stealPollFd >= 0) {
+            RTIPriv_OsPollWait(group->stealPollFd, -1);
+        }
+        wasIdle = true;
+    }
+}
+
+/**
+ * @brief Delete shared consumers of a group with work stealing.
+ *
+ * @param group The group.
+ */
+static void RTI_DispatchStealClose(RTI_DISPATCH_GROUP *group)
+{
+    for (uint32_t i = 0; i < group->entryCnt; i++) {
+        RTI_DISPATCH_ENTRY *entry = &group->entries[i];
+        if (entry->consumer != NULL) {
+            entry->desc.ifx->deleteConsumerF(entry->consumer);
+            entry->consumer = NULL;
+        }
+    }
+    if (group->stealPollFd >= 0) {
+        RTIPriv_OsEventClose(group->stealPollFd);
+        group->stealPollFd = -1;
+    }
+}
+
+/**
+ * @brief Create shared consumers of a group with work stealing, and reset its tasks.
+ *
+ * @param group The group.
+ * @return RTI_ERR Error code indicating success or failure.
+ */
+static RTI_ERR RTI_DispatchStealOpen(RTI_DISPATCH_GROUP *group)
+{
+    for (uint32_t i = 0; i < group->cfg.threads; i++) {
+        atomic_store(&group->workers[i].deque.top, 0);
+        atomic_store(&group->workers[i].deque.bottom, 0);
+        group->workers[i].next = i;
+    }
+    for (uint32_t i = 0; i < group->entryCnt; i++) {
+        RTI_DISPATCH_ENTRY *entry = &group->entries[i];
+        atomic_store(&entry->token, 0);
+        entry->consumer = entry->desc.ifx->createConsumerF();
+        if (entry->consumer == NULL) {
+            RTI_DispatchStealClose(group);
+            return RTI_ERR_FAILED;
+        }
+    }
+    group->stealPollFd = RTIPriv_OsPollCreate();
+    if (group->stealPollFd < 0) {
+        return RTI_OK;
+    }
+    RTI_ERR err = RTIPriv_OsPollAdd(group->stealPollFd, group->stopFd);
+    for (uint32_t i = 0; i < group->entryCnt && err == RTI_OK; i++) {
+        RTI_VLAN_IFX *ifx = group->entries[i].desc.ifx;
+        int fd = (ifx->consumerFdF != NULL) ? ifx->consumerFdF(group->entries[i].consumer) : -1;
+        err = (fd >= 0) ? RTIPriv_OsPollAdd(group->stealPollFd, fd) : RTI_ERR_NOT_SUPPORTED;
+    }
+    if (err != RTI_OK) {
+        RTIPriv_OsEventClose(group->stealPollFd);
+        group->stealPollFd = -1;
+    }
+    return RTI_OK;
+}
+
+/**
+ * @brief Pin the calling thread to CPUs of its worker.
+ *
+ * @param worker The worker.
+ * @return RTI_ERR Error code of RTIPriv_OsThreadPin().
+ */
+static RTI_ERR RTI_DispatchWorkerPin(RTI_DISPATCH_WORKER *worker)
+{
+    const uint64_t *mask = worker->group->cfg.cpuMask;
+    if (worker->group->cfg.pinEach == false) {
+        return RTIPriv_OsThreadPin(mask, RTI_DISPATCH_CPUS_MAX);
+    }
+    uint32_t cpuCnt = 0;
+    for (uint32_t w = 0; w < RTI_DISPATCH_CPU_WORDS; w++) {
+        cpuCnt += (uint32_t)__builtin_popcountll(mask[w]);
+    }
+    if (cpuCnt == 0) {
+        return RTI_OK;
+    }
+    // threads beyond the CPU count wrap around, sharing CPUs in order
+    uint32_t nth = worker->index % cpuCnt;
+    uint64_t one[RTI_DISPATCH_CPU_WORDS] = {0};
+    for (uint32_t cpu = 0; cpu < RTI_DISPATCH_CPUS_MAX; cpu++) {
+        if ((mask[cpu / 64] & ((uint64_t)1 << (cpu % 64))) != 0 && nth-- == 0) {
+            one[cpu / 64] = (uint64_t)1 << (cpu % 64);
+            break;
+        }
+    }
+    return RTIPriv_OsThreadPin(one, RTI_DISPATCH_CPUS_MAX);
+}
+
+/**
+ * @brief Dispatcher thread, sleeps on consumer fds while its VLANs are empty.
+ *
+ * @param arg The worker.
+ * @return void* Always NULL.
+ */
+static void *RTI_DispatchThread(void *arg)
+{
+    RTI_DISPATCH_WORKER *worker = (RTI_DISPATCH_WORKER *)arg;
+    RTI_DISPATCH_GROUP *group = worker->group;
+    // consumers are created after pinning, so first touch and NUMA placement follow the CPUs
+    RTI_ERR err = RTI_DispatchWorkerPin(worker);
+    if (err == RTI_OK && group->cfg.steal == false) {
+        err = RTI_DispatchWorkerOpen(worker, true);
+    }
+    if (err != RTI_OK) {
+        atomic_store(&group->startErr, (int)err);
+    }
+    atomic_fetch_add_explicit(&group->readyCnt, 1, memory_order_release);
+    RTIPriv_OsWake(&group->readyCnt, -1, false);
+    uint64_t idleNs = (uint64_t)((group->cfg.idleUs == 0) ? RTI_DISPATCH_IDLE_US_DEFAULT : group->cfg.idleUs) * 1000u;
+    if (err == RTI_OK && group->cfg.steal == true) {
+        RTI_DispatchStealLoop(worker, idleNs);
+    }
+    while (err == RTI_OK && group->cfg.steal == false && atomic_load_explicit(&group->running, memory_order_acquire) == true) {
+        if (RTI_DispatchWorkerRound(worker) > 0) {
+            continue;
+        }
+        // every consumer found its VLAN empty, which also cleared its fd
+        if (worker->pollFd >= 0) {
+            RTIPriv_OsPollWait(worker->pollFd, -1);
+        }
+        else {
+            RTIPriv_OsSleepNs(idleNs);
+        }
+    }
+    RTI_DispatchWorkerClose(worker);
+    return NULL;
+}
+
+/**
+ * @brief Stop and join the first count threads of a group.
+ *
+ * @param group The group.
+ * @param count Count of created threads.
+ */
+static void RTI_DispatchJoin(RTI_DISPATCH_GROUP *group, uint32_t count)
+{
+    atomic_store(&group->running, false);
+    RTIPriv_OsEventSignal(group->stopFd);
+    for (uint32_t i = 0; i < count; i++) {
+        RTIPriv_OsThreadJoin(group->workers[i].thread);
+    }
+    RTIPriv_OsEventClear(group->stopFd);
+    if (group->cfg.steal == true) {
+        RTI_DispatchStealClose(group);
+    }
+}
+
+/* Exported function definitions -------------------------------------------------*/
+
+/**
+ * @brief Create a dispatcher group.
+ *
+ * @param cfg The configuration.
+ * @param groupOut Pointer to store the group.
+ * @return RTI_ERR RTI_ERR_FAILED if the stop event of threads can not be created.
+ */
+RTI_ERR RTI_DispatchGroupCreate(const RTI_DISPATCH_GROUP_CFG *cfg, RTI_DISPATCH_GROUP **groupOut)
+{
+    if (cfg == NULL || groupOut == NULL) {
+        return RTI_ERR_INVALID_PARAM;
+    }
+    size_t workerCnt = (size_t)cfg->threads + 1;
+    size_t sizeBytes = sizeof(RTI_DISPATCH_GROUP) + workerCnt * (sizeof(RTI_DISPATCH_WORKER) + cfg->msgSizeMax);
+    // deques of workers are cacheline aligned
+    sizeBytes = (sizeBytes + RTI_CACHELINE_SIZE - 1) & ~(size_t)(RTI_CACHELINE_SIZE - 1);
+    RTI_DISPATCH_GROUP *group = (RTI_DISPATCH_GROUP *)aligned_alloc(RTI_CACHELINE_SIZE, sizeBytes);
+    if (group == NULL) {
+        return RTI_ERR_NO_MEMORY;
+    }
+    memset(group, 0, sizeBytes);
+    group->cfg = *cfg;
+    group->stealPollFd = -1;
+    atomic_init(&group->running, false);
+    atomic_init(&group->readyCnt, 0);
+    atomic_init(&group->startErr, RTI_OK);
+    group->stopFd = RTIPriv_OsEventCreate();
+    // without OS wait no thread is started, RTI_DispatchGroupPoll() needs no stop event
+    if (group->stopFd < 0 && RTI_ENABLE_OS_WAIT == 1) {
+        free(group);
+        return RTI_ERR_FAILED;
+    }
+    uint8_t *bufs = (uint8_t *)&group->workers[workerCnt];
+    for (size_t i = 0; i < workerCnt; i++) {
+        group->workers[i].group = group;
+        group->workers[i].index = (uint32_t)i;
+        group->workers[i].pollFd = -1;
+        group->workers[i].buf = bufs + i * cfg->msgSizeMax;
+    }
+    *groupOut = group;
+    return RTI_OK;
+}
+
+/**
+ * @brief Delete a dispatcher group, its threads are stopped first.
+ *
+ * @param group The group.
+ */
+void RTI_DispatchGroupDelete(RTI_DISPATCH_GROUP *group)
+{
+    if (group == NULL) {
+        return;
+    }
+    RTI_DispatchGroupStop(group);
+    RTI_DispatchWorkerClose(&group->workers[group->cfg.threads]);
+    RTIPriv_OsEventClose(group->stopFd);
+    free(group);
+}
+
+/**
+ * @brief Add a created VLAN to a dispatcher group.
+ *
+ * @param group The group.
+ * @param vlanId The VLAN.
+ * @param handlerF Callback of each message of the VLAN.
+ * @param arg Argument of handlerF.
+ * @return RTI_ERR RTI_ERR_NOT_SUPPORTED while the group is running,
+ *                 RTI_ERR_NO_MEMORY if the group has RTI_DISPATCH_VLANS_MAX VLANs.
+ */
+RTI_ERR RTI_DispatchGroupAdd(RTI_DISPATCH_GROUP *group, RTI_VlanId vlanId, RTI_DispatchFptr handlerF, void *arg)
+{
+    if (group == NULL || handlerF == NULL) {
+        return RTI_ERR_INVALID_PARAM;
+    }
+    if (atomic_load(&group->running) == true) {
+        return RTI_ERR_NOT_SUPPORTED;
+    }
+    for (uint32_t i = 0; i < group->entryCnt; i++) {
+        if (group->entries[i].desc.id == vlanId) {
+            return RTI_ERR_INVALID_PARAM;
+        }
+    }
+    if (group->entryCnt == RTI_DISPATCH_VLANS_MAX) {
+        return RTI_ERR_NO_MEMORY;
+    }
+    RTI_DISPATCH_ENTRY *entry = &group->entries[group->entryCnt];
+    RTI_ERR err = RTIPriv_VlanSelect(vlanId, &entry->desc);
+    if (err != RTI_OK) {
+        return err;
+    }
+    if (entry->desc.ifx->recvF == NULL) {
+        return RTI_ERR_NOT_SUPPORTED;
+    }
+    entry->isQueue = (entry->desc.ifx->recvF == RTI_QueueRecv);
+    if (entry->isQueue == false && group->cfg.msgSizeMax == 0) {
+        return RTI_ERR_INVALID_PARAM;
+    }
+    entry->handlerF = handlerF;
+    entry->arg = arg;
+    // consumers of RTI_DispatchGroupPoll() are created again with the new VLAN
+    RTI_DispatchWorkerClose(&group->workers[group->cfg.threads]);
+    group->isPollOpen = false;
+    group->entryCnt++;
+    return RTI_OK;
+}
+
+/**
+ * @brief Start dispatcher threads of a group.
+ *
+ * @param group The group.
+ * @return RTI_ERR RTI_ERR_NOT_SUPPORTED if OS wait is disabled,
+ *                 error of a thread failing to pin or create its consumers.
+ * @note returns after every thread has its consumers, so messages sent after it are dispatched.
+ */
+RTI_ERR RTI_DispatchGroupStart(RTI_DISPATCH_GROUP *group)
+{
+    if (group == NULL || group->cfg.threads == 0 || group->entryCnt == 0 || atomic_load(&group->running) == true) {
+        return RTI_ERR_INVALID_PARAM;
+    }
+    RTI_ERR err = (group->cfg.steal == true) ? RTI_DispatchStealOpen(group) : RTI_OK;
+    if (err != RTI_OK) {
+        return err;
+    }
+    atomic_store(&group->readyCnt, 0);
+    atomic_store(&group->startErr, RTI_OK);
+    atomic_store(&group->running, true);
+    uint32_t created = 0;
+    for (; created < group->cfg.threads; created++) {
+        RTI_DISPATCH_WORKER *worker = &group->workers[created];
+        err = RTIPriv_OsThreadCreate(&worker->thread, RTI_DispatchThread, worker);
+        if (err != RTI_OK) {
+            break;
+        }
+    }
+    unsigned ready = atomic_load_explicit(&group->readyCnt, memory_order_acquire);
+    while (ready < created) {
+        RTIPriv_OsWait(&group->readyCnt, ready, false, -1);
+        ready = atomic_load_explicit(&group->readyCnt, memory_order_acquire);
+    }
+    if (err == RTI_OK) {
+        err = (RTI_ERR)atomic_load(&group->startErr);
+    }
+    if (err != RTI_OK) {
+        RTI_DispatchJoin(group, created);
+    }
+    return err;
+}
+
+/**
+ * @brief Stop dispatcher threads of a group, messages left stay in their VLANs.
+ *
+ * @param group The group.
+ * @return RTI_ERR RTI_ERR_INVALID_PARAM if the threads are not running.
+ * @note a callback running when it is called finishes first.
+ */
+RTI_ERR RTI_DispatchGroupStop(RTI_DISPATCH_GROUP *group)
+{
+    if (group == NULL || atomic_load(&group->running) == false) {
+        return RTI_ERR_INVALID_PARAM;
+    }
+    RTI_DispatchJoin(group, group->cfg.threads);
+    return RTI_OK;
+}
+
+/**
+ * @brief Dispatch one round of a group from an event loop.
+ *
+ * @param group The group.
+ * @param dispatchedOut Pointer to store the count of dispatched messages, nullable.
+ * @return RTI_ERR RTI_ERR_NOT_SUPPORTED while dispatcher threads are running.
+ * @note it serves every VLAN once, up to a batch each. its consumers are created
+ *       by the first call, call it from the same thread each time.
+ */
+RTI_ERR RTI_DispatchGroupPoll(RTI_DISPATCH_GROUP *group, size_t *dispatchedOut)
+{
+    if (group == NULL) {
+        return RTI_ERR_INVALID_PARAM;
+    }
+    if (atomic_load(&group->running) == true) {
+        return RTI_ERR_NOT_SUPPORTED;
+    }
+    RTI_DISPATCH_WORKER *worker = &group->workers[group->cfg.threads];
+    if (group->isPollOpen == false) {
+        RTI_ERR err = RTI_DispatchWorkerOpen(worker, false);
+        if (err != RTI_OK) {
+            return err;
+        }
+        group->isPollOpen = true;
+    }
+    size_t dispatched = RTI_DispatchWorkerRound(worker);
+    if (dispatchedOut != NULL) {
+        *dispatchedOut = dispatched;
+    }
+    return RTI_OK;
+}
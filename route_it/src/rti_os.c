@@ -0,0 +1,525 @@
+/**
+ * @file rti_os.c
+ * @author CYK-Dot
+ * @brief OS wait primitives implementation.
+ * @version 0.1
+ * @date 2026-10-16
+ *
+ * @copyright Copyright (c) 2025 CYK-Dot, MIT License.
+ */
+
+/* Header import ------------------------------------------------------------------*/
+#ifndef _GNU_SOURCE
+#define _GNU_SOURCE
+#endif
+#include "rti_os.h"
+#if RTI_ENABLE_OS_WAIT == 1
+#include <errno.h>
+#include <limits.h>
+#include <linux/futex.h>
+#include <pthread.h>
+#include <sched.h>
+#include <sys/epoll.h>
+#include <sys/eventfd.h>
+#include <sys/syscall.h>
+#include <time.h>
+#include <unistd.h>
+#endif
+#if RTI_ENABLE_NUMA == 1
+#include <errno.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+#if RTI_ENABLE_HUGE_PAGES == 1
+#include <sys/mman.h>
+#endif
+
+/* Private typedef ----------------------------------------------------------------*/
+
+/* Private defines ----------------------------------------------------------------*/
+
+/* mbind(2) constants, numaif.h belongs to libnuma and is not always installed */
+#define RTI_OS_MPOL_PREFERRED 1
+#define RTI_OS_MPOL_MF_MOVE (1 << 1)
+#define RTI_OS_NUMA_NODES_MAX 256
+
+/* Global variables ---------------------------------------------------------------*/
+
+/* Private function prototypes ---------------------------------------------------*/
+
+/* Exported function prototypes --------------------------------------------------*/
+
+/* Private function definitions --------------------------------------------------*/
+
+/* Exported function definitions -------------------------------------------------*/
+
+/**
+ * @brief Sleep while *addr equals expect.
+ *
+ * @param addr The address to wait on.
+ * @param expect The value read by caller before checking its condition.
+ * @param isShared true if addr is in memory shared between processes.
+ * @param timeoutMs Max time to sleep in milliseconds, negative means forever.
+ * @return RTI_ERR RTI_OK when woken up, value changed or timed out,
+ *                 RTI_ERR_NOT_SUPPORTED if OS wait is disabled.
+ * @note may return spuriously, caller should recheck its condition and deadline.
+ */
+RTI_ERR RTIPriv_OsWait(atomic_uint *addr, unsigned expect, bool isShared, int32_t timeoutMs)
+{
+#if RTI_ENABLE_OS_WAIT == 1
+    struct timespec ts = {timeoutMs / 1000, (long)(timeoutMs % 1000) * 1000000};
+    int op = (isShared == true) ? FUTEX_WAIT : FUTEX_WAIT_PRIVATE;
+    long ret = syscall(SYS_futex, (unsigned *)addr, op, expect, (timeoutMs < 0) ? NULL : &ts, NULL, 0);
+    if (ret != 0 && errno != EAGAIN && errno != EINTR && errno != ETIMEDOUT) {
+        return RTI_ERR_FAILED;
+    }
+    return RTI_OK;
+#else
+    (void)addr;
+    (void)expect;
+    (void)isShared;
+    (void)timeoutMs;
+    return RTI_ERR_NOT_SUPPORTED;
+#endif
+}
+
+/**
+ * @brief Wake threads sleeping on addr.
+ *
+ * @param addr The address to wake.
+ * @param count Max count of threads to wake, negative means all.
+ * @param isShared true if addr is in memory shared between processes.
+ */
+void RTIPriv_OsWake(atomic_uint *addr, int count, bool isShared)
+{
+#if RTI_ENABLE_OS_WAIT == 1
+    int op = (isShared == true) ? FUTEX_WAKE : FUTEX_WAKE_PRIVATE;
+    syscall(SYS_futex, (unsigned *)addr, op, count < 0 ? INT_MAX : count, NULL, NULL, 0);
+#else
+    (void)addr;
+    (void)count;
+    (void)isShared;
+#endif
+}
+
+/**
+ * @brief Get monotonic time in milliseconds.
+ *
+ * @return int64_t The time, always 0 if OS wait is disabled.
+ */
+int64_t RTIPriv_OsNowMs(void)
+{
+#if RTI_ENABLE_OS_WAIT == 1
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (int64_t)ts.tv_sec * 1000 + ts.tv_nsec / 1000000;
+#else
+    return 0;
+#endif
+}
+
+/**
+ * @brief Get monotonic time in nanoseconds.
+ *
+ * @return uint64_t Monotonic time, 0 if OS wait is disabled.
+ */
+uint64_t RTIPriv_OsNowNs(void)
+{
+#if RTI_ENABLE_OS_WAIT == 1
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000u + (uint64_t)ts.tv_nsec;
+#else
+    return 0;
+#endif
+}
+
+/**
+ * @brief Sleep the calling thread.
+ *
+ * @param ns Sleep time in nanoseconds.
+ */
+void RTIPriv_OsSleepNs(uint64_t ns)
+{
+#if RTI_ENABLE_OS_WAIT == 1
+    struct timespec ts = {(time_t)(ns / 1000000000u), (long)(ns % 1000000000u)};
+    while (nanosleep(&ts, &ts) != 0 && errno == EINTR) {
+    }
+#else
+    (void)ns;
+#endif
+}
+
+/**
+ * @brief Create a non-blocking event file descriptor.
+ *
+ * @return int The file descriptor, -1 if failed or OS wait is disabled.
+ */
+int RTIPriv_OsEventCreate(void)
+{
+#if RTI_ENABLE_OS_WAIT == 1
+    return eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+#else
+    return -1;
+#endif
+}
+
+/**
+ * @brief Make an event file descriptor readable.
+ *
+ * @param fd The file descriptor.
+ */
+void RTIPriv_OsEventSignal(int fd)
+{
+#if RTI_ENABLE_OS_WAIT == 1
+    eventfd_write(fd, 1);
+#else
+    (void)fd;
+#endif
+}
+
+/**
+ * @brief Make an event file descriptor not readable.
+ *
+ * @param fd The file descriptor.
+ */
+void RTIPriv_OsEventClear(int fd)
+{
+#if RTI_ENABLE_OS_WAIT == 1
+    eventfd_t value;
+    eventfd_read(fd, &value);
+#else
+    (void)fd;
+#endif
+}
+
+/**
+ * @brief Close an event file descriptor.
+ *
+ * @param fd The file descriptor, ignored if negative.
+ */
+void RTIPriv_OsEventClose(int fd)
+{
+#if RTI_ENABLE_OS_WAIT == 1
+    if (fd >= 0) {
+        close(fd);
+    }
+#else
+    (void)fd;
+#endif
+}
+
+/**
+ * @brief Create a thread.
+ *
+ * @param threadOut Pointer to store the thread.
+ * @param entryF Thread function.
+ * @param arg Argument of entryF.
+ * @return RTI_ERR RTI_ERR_NOT_SUPPORTED if OS wait is disabled.
+ */
+RTI_ERR RTIPriv_OsThreadCreate(RTI_OS_THREAD *threadOut, RTI_OsThreadFptr entryF, void *arg)
+{
+#if RTI_ENABLE_OS_WAIT == 1
+    pthread_t thread;
+    if (pthread_create(&thread, NULL, entryF, arg) != 0) {
+        return RTI_ERR_FAILED;
+    }
+    *threadOut = (RTI_OS_THREAD)thread;
+    return RTI_OK;
+#else
+    (void)threadOut;
+    (void)entryF;
+    (void)arg;
+    return RTI_ERR_NOT_SUPPORTED;
+#endif
+}
+
+/**
+ * @brief Wait for a thread to exit.
+ *
+ * @param thread The thread.
+ */
+void RTIPriv_OsThreadJoin(RTI_OS_THREAD thread)
+{
+#if RTI_ENABLE_OS_WAIT == 1
+    pthread_join((pthread_t)thread, NULL);
+#else
+    (void)thread;
+#endif
+}
+
+/**
+ * @brief Get page size of the OS.
+ *
+ * @return size_t Page size in bytes, RTI_CACHELINE_SIZE if NUMA placement is disabled.
+ */
+size_t RTIPriv_OsPageSize(void)
+{
+#if RTI_ENABLE_NUMA == 1
+    long pageSize = sysconf(_SC_PAGESIZE);
+    return (pageSize > 0) ? (size_t)pageSize : 4096;
+#else
+    return RTI_CACHELINE_SIZE;
+#endif
+}
+
+/**
+ * @brief Get NUMA node of the CPU running the calling thread.
+ *
+ * @return int The node, -1 if unknown or NUMA placement is disabled.
+ */
+int RTIPriv_OsCpuNode(void)
+{
+#if RTI_ENABLE_NUMA == 1
+    unsigned cpu = 0;
+    unsigned node = 0;
+    if (syscall(SYS_getcpu, &cpu, &node, NULL) != 0) {
+        return -1;
+    }
+    return (int)node;
+#else
+    return -1;
+#endif
+}
+
+/**
+ * @brief Prefer a NUMA node for pages of a memory range, moving pages already touched.
+ *
+ * @param addr Start of the range.
+ * @param sizeBytes Size of the range.
+ * @param node The node.
+ * @return RTI_ERR RTI_ERR_INVALID_PARAM if node does not exist,
+ *                 RTI_ERR_NOT_SUPPORTED if kernel or config has no NUMA policy.
+ * @note only pages entirely inside the range are bound, pages shared with
+ *       other objects keep their policy. the policy is preferred, not strict,
+ *       so a full node falls back to others instead of failing allocations.
+ */
+RTI_ERR RTIPriv_OsMemBind(void *addr, size_t sizeBytes, int node)
+{
+#if RTI_ENABLE_NUMA == 1
+    if (node < 0 || node >= RTI_OS_NUMA_NODES_MAX) {
+        return RTI_ERR_INVALID_PARAM;
+    }
+    uintptr_t pageMask = (uintptr_t)RTIPriv_OsPageSize() - 1;
+    uintptr_t start = ((uintptr_t)addr + pageMask) & ~pageMask;
+    uintptr_t end = ((uintptr_t)addr + sizeBytes) & ~pageMask;
+    if (end <= start) {
+        return RTI_OK;
+    }
+    unsigned long mask[RTI_OS_NUMA_NODES_MAX / (8 * sizeof(unsigned long))] = {0};
+    mask[node / (8 * sizeof(unsigned long))] = 1UL << (node % (8 * sizeof(unsigned long)));
+    long ret = syscall(SYS_mbind, (void *)start, end - start, RTI_OS_MPOL_PREFERRED,
+                       mask, (unsigned long)RTI_OS_NUMA_NODES_MAX, RTI_OS_MPOL_MF_MOVE);
+    if (ret == 0) {
+        return RTI_OK;
+    }
+    if (errno == EINVAL) {
+        return RTI_ERR_INVALID_PARAM;
+    }
+    return (errno == ENOSYS || errno == EPERM) ? RTI_ERR_NOT_SUPPORTED : RTI_ERR_FAILED;
+#else
+    (void)addr;
+    (void)sizeBytes;
+    (void)node;
+    return RTI_ERR_NOT_SUPPORTED;
+#endif
+}
+
+/**
+ * @brief Map anonymous memory aligned to RTI_HUGE_PAGE_SIZE, backed by huge pages if possible.
+ *
+ * @param sizeBytes Size of the memory, multiple of RTI_HUGE_PAGE_SIZE.
+ * @param isHugetlbOut Pointer to store true if reserved huge pages back the memory.
+ * @return void* The memory, NULL if failed or huge pages are disabled.
+ * @note without reserved huge pages it falls back to normal pages aligned for
+ *       transparent huge pages, see RTIPriv_OsHugeAdvise().
+ */
+void *RTIPriv_OsHugeMap(size_t sizeBytes, bool *isHugetlbOut)
+{
+#if RTI_ENABLE_HUGE_PAGES == 1
+    *isHugetlbOut = false;
+    if (sizeBytes == 0 || (sizeBytes % RTI_HUGE_PAGE_SIZE) != 0) {
+        return NULL;
+    }
+    void *mem = mmap(NULL, sizeBytes, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_HUGETLB, -1, 0);
+    if (mem != MAP_FAILED) {
+        *isHugetlbOut = true;
+        return mem;
+    }
+    // over-map and trim, so the memory starts on a huge page boundary
+    size_t mapSize = sizeBytes + RTI_HUGE_PAGE_SIZE;
+    uint8_t *map = (uint8_t *)mmap(NULL, mapSize, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    if ((void *)map == MAP_FAILED) {
+        return NULL;
+    }
+    uint8_t *start = (uint8_t *)(((uintptr_t)map + RTI_HUGE_PAGE_SIZE - 1) & ~(uintptr_t)(RTI_HUGE_PAGE_SIZE - 1));
+    if (start != map) {
+        munmap(map, (size_t)(start - map));
+    }
+    size_t tail = mapSize - (size_t)(start - map) - sizeBytes;
+    if (tail != 0) {
+        munmap(start + sizeBytes, tail);
+    }
+    return start;
+#else
+    (void)sizeBytes;
+    *isHugetlbOut = false;
+    return NULL;
+#endif
+}
+
+/**
+ * @brief Unmap memory of RTIPriv_OsHugeMap().
+ *
+ * @param addr The memory.
+ * @param sizeBytes Size passed to RTIPriv_OsHugeMap().
+ */
+void RTIPriv_OsHugeUnmap(void *addr, size_t sizeBytes)
+{
+#if RTI_ENABLE_HUGE_PAGES == 1
+    munmap(addr, sizeBytes);
+#else
+    (void)addr;
+    (void)sizeBytes;
+#endif
+}
+
+/**
+ * @brief Ask for transparent huge pages on a memory range.
+ *
+ * @param addr Start of the range.
+ * @param sizeBytes Size of the range.
+ * @return RTI_ERR RTI_ERR_NOT_SUPPORTED if the range holds no whole huge page,
+ *                 or kernel or config has no transparent huge pages.
+ * @note only huge pages entirely inside the range are advised.
+ */
+RTI_ERR RTIPriv_OsHugeAdvise(void *addr, size_t sizeBytes)
+{
+#if RTI_ENABLE_HUGE_PAGES == 1
+    uintptr_t hugeMask = (uintptr_t)RTI_HUGE_PAGE_SIZE - 1;
+    uintptr_t start = ((uintptr_t)addr + hugeMask) & ~hugeMask;
+    uintptr_t end = ((uintptr_t)addr + sizeBytes) & ~hugeMask;
+    if (end <= start || madvise((void *)start, end - start, MADV_HUGEPAGE) != 0) {
+        return RTI_ERR_NOT_SUPPORTED;
+    }
+    return RTI_OK;
+#else
+    (void)addr;
+    (void)sizeBytes;
+    return RTI_ERR_NOT_SUPPORTED;
+#endif
+}
+
+/**
+ * @brief Fault in every page of a memory range for writing, keeping its content.
+ *
+ * @param addr Start of the range.
+ * @param sizeBytes Size of the range.
+ */
+void RTIPriv_OsMemPrefault(void *addr, size_t sizeBytes)
+{
+#if RTI_ENABLE_HUGE_PAGES == 1 && defined(MADV_POPULATE_WRITE)
+    uintptr_t pageMask = (uintptr_t)RTIPriv_OsPageSize() - 1;
+    uintptr_t start = (uintptr_t)addr & ~pageMask;
+    if (madvise((void *)start, (uintptr_t)addr + sizeBytes - start, MADV_POPULATE_WRITE) == 0) {
+        return;
+    }
+#endif
+    // kernels before 5.14 have no MADV_POPULATE_WRITE, touch each page instead
+    volatile uint8_t *mem = (volatile uint8_t *)addr;
+    size_t pageSize = RTIPriv_OsPageSize();
+    for (size_t offset = 0; offset < sizeBytes; offset += pageSize) {
+        mem[offset] = mem[offset];
+    }
+    if (sizeBytes != 0) {
+        mem[sizeBytes - 1] = mem[sizeBytes - 1];
+    }
+}
+
+/**
+ * @brief Set CPU affinity of the calling thread.
+ *
+ * @param cpuMask CPU bitmask, 64 CPUs in each word.
+ * @param cpuMax Bits in cpuMask.
+ * @return RTI_ERR RTI_ERR_INVALID_PARAM if no CPU of the mask is usable,
+ *                 RTI_ERR_NOT_SUPPORTED if OS wait is disabled.
+ * @note an empty mask keeps the affinity inherited from the creator.
+ */
+RTI_ERR RTIPriv_OsThreadPin(const uint64_t *cpuMask, size_t cpuMax)
+{
+#if RTI_ENABLE_OS_WAIT == 1
+    cpu_set_t set;
+    CPU_ZERO(&set);
+    size_t cpuCnt = 0;
+    for (size_t cpu = 0; cpu < cpuMax && cpu < CPU_SETSIZE; cpu++) {
+        if ((cpuMask[cpu / 64] & ((uint64_t)1 << (cpu % 64))) != 0) {
+            CPU_SET(cpu, &set);
+            cpuCnt++;
+        }
+    }
+    if (cpuCnt == 0) {
+        return RTI_OK;
+    }
+    if (pthread_setaffinity_np(pthread_self(), sizeof(set), &set) != 0) {
+        return RTI_ERR_INVALID_PARAM;
+    }
+    return RTI_OK;
+#else
+    (void)cpuMask;
+    (void)cpuMax;
+    return RTI_ERR_NOT_SUPPORTED;
+#endif
+}
+
+/**
+ * @brief Create a poll set waiting on readability of file descriptors.
+ *
+ * @return int The poll set, -1 if failed or OS wait is disabled.
+ */
+int RTIPriv_OsPollCreate(void)
+{
+#if RTI_ENABLE_OS_WAIT == 1
+    return epoll_create1(EPOLL_CLOEXEC);
+#else
+    return -1;
+#endif
+}
+
+/**
+ * @brief Add a file descriptor to a poll set.
+ *
+ * @param pollFd The poll set.
+ * @param fd The file descriptor, level triggered.
+ * @return RTI_ERR Error code indicating success or failure.
+ */
+RTI_ERR RTIPriv_OsPollAdd(int pollFd, int fd)
+{
+#if RTI_ENABLE_OS_WAIT == 1
+    struct epoll_event event = {0};
+    event.events = EPOLLIN;
+    event.data.fd = fd;
+    return (epoll_ctl(pollFd, EPOLL_CTL_ADD, fd, &event) == 0) ? RTI_OK : RTI_ERR_FAILED;
+#else
+    (void)pollFd;
+    (void)fd;
+    return RTI_ERR_NOT_SUPPORTED;
+#endif
+}
+
+/**
+ * @brief Sleep until a file descriptor of a poll set is readable.
+ *
+ * @param pollFd The poll set, close it by RTIPriv_OsEventClose().
+ * @param timeoutMs Max time to sleep in milliseconds, negative means forever.
+ * @note may return spuriously, caller should recheck its condition.
+ */
+void RTIPriv_OsPollWait(int pollFd, int32_t timeoutMs)
+{
+#if RTI_ENABLE_OS_WAIT == 1
+    struct epoll_event events[8];
+    epoll_wait(pollFd, events, 8, timeoutMs);
+#else
+    (void)pollFd;
+    (void)timeoutMs;
+#endif
+}
@@ -0,0 +1,60 @@
+/**
+ * @file rti_os.h
+ * @author CYK-Dot
+ * @brief OS wait primitives for RTI internal use.
+ * @version 0.1
+ * @date 2026-10-16
+ *
+ * @copyright Copyright (c) 2025 CYK-Dot, MIT License.
+ */
+#pragma once
+
+/* Header import ------------------------------------------------------------------*/
+#include <stdatomic.h>
+#include <stdbool.h>
+#include "rti_internal.h"
+
+/* Config macros -----------------------------------------------------------------*/
+
+/* Export macros -----------------------------------------------------------------*/
+
+/**
+ * @brief Hint CPU that caller is spinning.
+ */
+#if defined(__x86_64__) || defined(__i386__)
+#define RTI_OS_CPU_RELAX() __builtin_ia32_pause()
+#elif defined(__aarch64__) || defined(__arm__)
+#define RTI_OS_CPU_RELAX() __asm__ __volatile__("yield")
+#else
+#define RTI_OS_CPU_RELAX() ((void)0)
+#endif
+
+/* Exported typedef --------------------------------------------------------------*/
+
+typedef uintptr_t RTI_OS_THREAD;
+typedef void *(*RTI_OsThreadFptr)(void *arg);
+
+/* Exported function -------------------------------------------------------------*/
+
+RTI_ERR RTIPriv_OsWait(atomic_uint *addr, unsigned expect, bool isShared, int32_t timeoutMs);
+void RTIPriv_OsWake(atomic_uint *addr, int count, bool isShared);
+int64_t RTIPriv_OsNowMs(void);
+uint64_t RTIPriv_OsNowNs(void);
+void RTIPriv_OsSleepNs(uint64_t ns);
+int RTIPriv_OsEventCreate(void);
+void RTIPriv_OsEventSignal(int fd);
+void RTIPriv_OsEventClear(int fd);
+void RTIPriv_OsEventClose(int fd);
+RTI_ERR RTIPriv_OsThreadCreate(RTI_OS_THREAD *threadOut, RTI_OsThreadFptr entryF, void *arg);
+void RTIPriv_OsThreadJoin(RTI_OS_THREAD thread);
+size_t RTIPriv_OsPageSize(void);
+int RTIPriv_OsCpuNode(void);
+RTI_ERR RTIPriv_OsMemBind(void *addr, size_t sizeBytes, int node);
+void *RTIPriv_OsHugeMap(size_t sizeBytes, bool *isHugetlbOut);
+void RTIPriv_OsHugeUnmap(void *addr, size_t sizeBytes);
+RTI_ERR RTIPriv_OsHugeAdvise(void *addr, size_t sizeBytes);
+void RTIPriv_OsMemPrefault(void *addr, size_t sizeBytes);
+RTI_ERR RTIPriv_OsThreadPin(const uint64_t *cpuMask, size_t cpuMax);
+int RTIPriv_OsPollCreate(void);
+RTI_ERR RTIPriv_OsPollAdd(int pollFd, int fd);
+void RTIPriv_OsPollWait(int pollFd, int32_t timeoutMs);
@@ -0,0 +1,2470 @@
+/**
+ * @file rti_queue.c
+ * @author CYK-Dot
+ * @brief Built-in lock-free ring queue VLAN backend implementation.
+ * @version 0.1
+ * @date 2026-10-16
+ *
+ * @copyright Copyright (c) 2025 CYK-Dot, MIT License.
+ */
+
+/* Header import ------------------------------------------------------------------*/
+#include "rti_queue.h"
+#include "rti_os.h"
+#include <errno.h>
+#include <stdatomic.h>
+#include <stdbool.h>
+#include <stdlib.h>
+#include <string.h>
+
+/* Private typedef ----------------------------------------------------------------*/
+
+/**
+ * @brief Slot header, message payload follows it directly.
+ * @note seq is the bounded MPMC sequence number:
+ *       seq == pos       slot is free for the producer at pos
+ *       seq == pos + 1   slot holds the message of pos
+ *       owner is the handle owner holding the slot, 0 when nobody holds it.
+ */
+typedef struct {
+    atomic_size_t seq;
+    uint32_t size;
+    uint32_t owner;
+} RTI_QUEUE_SLOT;
+
+/**
+ * @brief One priority lane, a bounded MPMC ring.
+ * @note slots are addressed by offset from the queue,
+ *       so the queue can be mapped at different addresses by processes.
+ */
+typedef struct {
+    _Alignas(RTI_CACHELINE_SIZE) atomic_size_t enqPos;
+    _Alignas(RTI_CACHELINE_SIZE) atomic_size_t deqPos;
+    size_t slotsOffset;
+} RTI_QUEUE_LANE;
+
+/**
+ * @brief Cell of the handle cache ring, same bounded MPMC sequence as a lane slot.
+ *
+ */
+typedef struct {
+    atomic_size_t seq;
+    void *handle;
+    uint8_t kind;                       /* see RTI_QUEUE_HANDLE_xxx, how the handle was reset */
+} RTI_QUEUE_CACHE_CELL;
+
+typedef struct rti_queue_producer {
+    RTI_QUEUE *queue;
+    uint32_t owner;
+    struct rti_queue_producer *flowNext;
+    RTI_VLAN_FLOW_CFG flow;
+    bool flowEnabled;
+    atomic_bool throttled;
+    uint8_t flowLane;                   /* lane found full when throttled, RTI_QUEUE_FLOW_LANE_ANY if by watermark */
+    RTI_VlanWakeFptr wakeF;             /* one-shot, called when the producer is resumed, see RTI_QueueProducerWaitArm() */
+    void *wakeArg;
+    struct rti_queue_producer *wakeNext;
+#if RTI_ENABLE_RATE_LIMIT == 1
+    RTI_VLAN_IFX *divertIfx;            /* interface of the overflow VLAN, NULL until first divert */
+    void *divertProducer;
+    RTI_VlanId divertVlan;
+    uint8_t divertLanes;                /* lane count of the overflow VLAN, at least 1 */
+#endif
+} RTI_QUEUE_PRODUCER;
+
+struct rti_queue {
+    RTI_QUEUE_CFG cfg;
+    size_t posMask;
+    size_t slotStride;
+    bool isHeap;
+    bool isShared;
+    bool isMapped;                      /* heap queue mapped by RTIPriv_OsHugeMap() */
+    uint8_t pageKind;                   /* RTI_QUEUE_PAGE_xxx */
+    size_t memSize;                     /* bytes of queue memory, bound to a NUMA node as a whole */
+    atomic_int numaNode;                /* bound node, or RTI_QUEUE_NUMA_UNBOUND / RTI_QUEUE_NUMA_TRIED */
+#if RTI_ENABLE_RATE_LIMIT == 1
+    uint64_t rateInterval;              /* ns of one token, 0 if not rate limited */
+    uint64_t rateBurst;                 /* ns of a full bucket */
+    uint8_t ratePolicy;
+    RTI_VlanId rateOverflow;
+    _Alignas(RTI_CACHELINE_SIZE) atomic_uint_least64_t rateTat;
+#endif
+    RTI_QueueForwardFptr forwardF;      /* process local, NULL if sends are enqueued */
+    void *forwardArg;
+    uint8_t *pool;                      /* process local handle pool, NULL if handles are on heap */
+    uint32_t poolCnt;
+    _Alignas(RTI_CACHELINE_SIZE) atomic_size_t cacheEnq;
+    _Alignas(RTI_CACHELINE_SIZE) atomic_size_t cacheDeq;
+    RTI_QUEUE_CACHE_CELL cache[RTI_QUEUE_HANDLE_CACHE];     /* recycled handles, process local */
+    _Alignas(RTI_CACHELINE_SIZE) atomic_uint readyMask;
+    _Alignas(RTI_CACHELINE_SIZE) atomic_uint parkedCnt;
+    atomic_uint wakeSeq;
+    _Alignas(RTI_CACHELINE_SIZE) atomic_uint throttledCnt;
+    atomic_uint flowSeq;
+    atomic_flag flowLock;
+    RTI_QUEUE_PRODUCER *flowList;
+    _Alignas(RTI_CACHELINE_SIZE) atomic_uint pollArmedCnt;
+    atomic_flag pollLock;
+    struct rti_queue_consumer *pollList;
+    _Alignas(RTI_CACHELINE_SIZE) atomic_flag isrLock;
+    struct rti_queue_isr *isrList;
+    RTI_QUEUE_LANE lanes[RTI_QUEUE_LANES_MAX];
+};
+
+/**
+ * @brief Mailbox slot of an ISR producer, message payload follows it directly.
+ *
+ */
+typedef struct {
+    uint32_t size;
+    uint8_t lane;
+} RTI_QUEUE_ISR_SLOT;
+
+/**
+ * @brief ISR producer, a preallocated SPSC mailbox drained into lanes by consumers.
+ * @note tail is only written by the ISR, head only by the consumer holding isrLock.
+ */
+typedef struct rti_queue_isr {
+    RTI_QUEUE *queue;
+    struct rti_queue_isr *next;
+    size_t posMask;
+    size_t slotStride;
+    _Alignas(RTI_CACHELINE_SIZE) atomic_size_t tail;
+    _Alignas(RTI_CACHELINE_SIZE) atomic_size_t head;
+    _Alignas(RTI_CACHELINE_SIZE) uint8_t slots[];
+} RTI_QUEUE_ISR;
+
+typedef struct rti_queue_consumer {
+    RTI_QUEUE *queue;
+    uint32_t owner;
+    uint8_t wrrLane;
+    uint8_t wrrCredit;
+    int pollFd;                         /* eventfd, -1 until RTI_QueueConsumerGetFd() */
+    atomic_bool pollArmed;
+    struct rti_queue_consumer *pollNext;
+    RTI_VlanWakeFptr wakeF;             /* called instead of signaling pollFd, see RTI_QueueConsumerWaitArm() */
+    void *wakeArg;
+    struct rti_queue_consumer *wakeNext;
+    RTI_QUEUE_PRODUCER *flowWake;       /* resumed producers to wake once the claimed slot is released */
+} RTI_QUEUE_CONSUMER;
+
+/* Private defines ----------------------------------------------------------------*/
+
+/**
+ * @brief Round up SIZE to multiple of ALIGN, ALIGN must be power of 2.
+ */
+#define RTI_QUEUE_ALIGN_UP(SIZE, ALIGN) (((SIZE) + (ALIGN) - 1) & ~((size_t)(ALIGN) - 1))
+
+/**
+ * @brief Get slot of a lane by ring position.
+ *
+ * @param QUEUE[RTI_QUEUE*] The queue.
+ * @param LANE[RTI_QUEUE_LANE*] The lane.
+ * @param POS[size_t] The ring position, wrapped by posMask.
+ * @return RTI_QUEUE_SLOT* The slot.
+ */
+#define RTI_QUEUE_GET_SLOT(QUEUE, LANE, POS) \
+    ((RTI_QUEUE_SLOT *)((uint8_t *)(QUEUE) + (LANE)->slotsOffset + ((POS) & (QUEUE)->posMask) * (QUEUE)->slotStride))
+
+/**
+ * @brief Slot size marking a message dropped by peer recovery.
+ */
+#define RTI_QUEUE_SLOT_DROPPED UINT32_MAX
+
+/**
+ * @brief Kinds of recycled handles in the handle cache, a raw one is an unused pool node.
+ */
+#define RTI_QUEUE_HANDLE_RAW 0
+#define RTI_QUEUE_HANDLE_PRODUCER 1
+#define RTI_QUEUE_HANDLE_CONSUMER 2
+
+/**
+ * @brief NUMA node states of a queue not bound to a node, the second one never retries AUTO.
+ */
+#define RTI_QUEUE_NUMA_UNBOUND (-1)
+#define RTI_QUEUE_NUMA_TRIED (-2)
+
+/**
+ * @brief Ready mask bit telling consumers that ISR mailboxes have messages.
+ */
+#define RTI_QUEUE_READY_ISR (1u << 31)
+
+/**
+ * @brief Flow lane of a producer throttled by the high watermark, not by a full lane.
+ */
+#define RTI_QUEUE_FLOW_LANE_ANY UINT8_MAX
+
+/**
+ * @brief Get mailbox slot of an ISR producer by position.
+ */
+#define RTI_QUEUE_GET_ISR_SLOT(ISR, POS) \
+    ((RTI_QUEUE_ISR_SLOT *)((ISR)->slots + ((POS) & (ISR)->posMask) * (ISR)->slotStride))
+
+#if RTI_ENABLE_RATE_LIMIT == 1 && RTI_ENABLE_OS_WAIT == 0
+#error "RTI_ENABLE_RATE_LIMIT needs the monotonic clock of RTI_ENABLE_OS_WAIT"
+#endif
+
+// compile time sizes of rti_queue.h must cover the real layout
+_Static_assert(sizeof(RTI_QUEUE) <= RTI_QUEUE_HDR_SIZE, "RTI_QUEUE_HDR_SIZE is too small");
+_Static_assert(RTI_QUEUE_SLOT_STRIDE(1) == RTI_QUEUE_ALIGN_UP(sizeof(RTI_QUEUE_SLOT) + 1, sizeof(RTI_QUEUE_SLOT)),
+               "RTI_QUEUE_SLOT_STRIDE does not match RTI_QUEUE_SLOT");
+_Static_assert(sizeof(RTI_QUEUE_PRODUCER) <= RTI_QUEUE_HANDLE_SIZE, "RTI_QUEUE_HANDLE_SIZE is too small for a producer");
+_Static_assert(sizeof(RTI_QUEUE_CONSUMER) <= RTI_QUEUE_HANDLE_SIZE, "RTI_QUEUE_HANDLE_SIZE is too small for a consumer");
+_Static_assert((RTI_QUEUE_HANDLE_CACHE & (RTI_QUEUE_HANDLE_CACHE - 1)) == 0, "RTI_QUEUE_HANDLE_CACHE must be power of 2");
+
+/* Global variables ---------------------------------------------------------------*/
+
+/* Private function prototypes ---------------------------------------------------*/
+
+/* Exported function prototypes --------------------------------------------------*/
+
+/* Private function definitions --------------------------------------------------*/
+
+/**
+ * @brief Check if the queue configuration is valid.
+ *
+ * @param cfg The queue configuration.
+ * @return true The configuration is valid.
+ * @return false The configuration is invalid.
+ */
+static bool RTI_QueueCfgIsValid(const RTI_QUEUE_CFG *cfg)
+{
+    if (cfg == NULL) {
+        return false;
+    }
+    if (cfg->depth == 0 || (cfg->depth & (cfg->depth - 1)) != 0) {
+        return false;
+    }
+    if (cfg->msgSize == 0 || cfg->lanes == 0 || cfg->lanes > RTI_QUEUE_LANES_MAX) {
+        return false;
+    }
+    return (cfg->sched == RTI_QUEUE_SCHED_STRICT || cfg->sched == RTI_QUEUE_SCHED_WRR);
+}
+
+/**
+ * @brief Get slot stride of the queue configuration.
+ *
+ * @param cfg The queue configuration.
+ * @return size_t Slot stride in bytes.
+ */
+static inline size_t RTI_QueueSlotStride(const RTI_QUEUE_CFG *cfg)
+{
+    return RTI_QUEUE_ALIGN_UP(sizeof(RTI_QUEUE_SLOT) + cfg->msgSize, sizeof(RTI_QUEUE_SLOT));
+}
+
+/**
+ * @brief Check if a handle lives in the handle pool of the queue.
+ *
+ * @param queue The queue.
+ * @param handle The producer or consumer.
+ * @return true The handle is a pool node.
+ * @return false The handle is on heap.
+ */
+static inline bool RTI_QueueHandleInPool(RTI_QUEUE *queue, void *handle)
+{
+    uint8_t *addr = (uint8_t *)handle;
+    return (queue->pool != NULL && addr >= queue->pool && addr < queue->pool + RTI_QUEUE_POOL_SIZE(queue->poolCnt));
+}
+
+/**
+ * @brief Push a recycled handle to the handle cache.
+ *
+ * @param queue The queue.
+ * @param handle The producer or consumer.
+ * @param kind Kind of the handle reset hook already applied.
+ * @return true The handle is cached.
+ * @return false The cache is full.
+ */
+static bool RTI_QueueCachePush(RTI_QUEUE *queue, void *handle, uint8_t kind)
+{
+    size_t pos = atomic_load_explicit(&queue->cacheEnq, memory_order_relaxed);
+    while (1) {
+        RTI_QUEUE_CACHE_CELL *cell = &queue->cache[pos & (RTI_QUEUE_HANDLE_CACHE - 1)];
+        size_t seq = atomic_load_explicit(&cell->seq, memory_order_acquire);
+        intptr_t diff = (intptr_t)seq - (intptr_t)pos;
+        if (diff == 0) {
+            if (atomic_compare_exchange_weak_explicit(&queue->cacheEnq, &pos, pos + 1,
+                                                      memory_order_relaxed, memory_order_relaxed)) {
+                cell->handle = handle;
+                cell->kind = kind;
+                atomic_store_explicit(&cell->seq, pos + 1, memory_order_release);
+                return true;
+            }
+        }
+        else if (diff < 0) {
+            return false;
+        }
+        else {
+            pos = atomic_load_explicit(&queue->cacheEnq, memory_order_relaxed);
+        }
+    }
+}
+
+/**
+ * @brief Pop a recycled handle from the handle cache.
+ *
+ * @param queue The queue.
+ * @param kind Pointer to store kind of the handle.
+ * @return void* The handle, NULL if the cache is empty.
+ */
+static void *RTI_QueueCachePop(RTI_QUEUE *queue, uint8_t *kind)
+{
+    size_t pos = atomic_load_explicit(&queue->cacheDeq, memory_order_relaxed);
+    while (1) {
+        RTI_QUEUE_CACHE_CELL *cell = &queue->cache[pos & (RTI_QUEUE_HANDLE_CACHE - 1)];
+        size_t seq = atomic_load_explicit(&cell->seq, memory_order_acquire);
+        intptr_t diff = (intptr_t)seq - (intptr_t)(pos + 1);
+        if (diff == 0) {
+            if (atomic_compare_exchange_weak_explicit(&queue->cacheDeq, &pos, pos + 1,
+                                                      memory_order_relaxed, memory_order_relaxed)) {
+                void *handle = cell->handle;
+                *kind = cell->kind;
+                atomic_store_explicit(&cell->seq, pos + RTI_QUEUE_HANDLE_CACHE, memory_order_release);
+                return handle;
+            }
+        }
+        else if (diff < 0) {
+            return NULL;
+        }
+        else {
+            pos = atomic_load_explicit(&queue->cacheDeq, memory_order_relaxed);
+        }
+    }
+}
+
+/**
+ * @brief Drop all recycled handles, heap ones are freed.
+ *
+ * @param queue The queue.
+ * @return uint32_t Count of pool handles dropped.
+ */
+static uint32_t RTI_QueueCacheFlush(RTI_QUEUE *queue)
+{
+    uint32_t poolCnt = 0;
+    uint8_t kind = RTI_QUEUE_HANDLE_RAW;
+    void *handle = NULL;
+    while ((handle = RTI_QueueCachePop(queue, &kind)) != NULL) {
+        if (RTI_QueueHandleInPool(queue, handle) == true) {
+            poolCnt++;
+        }
+        else {
+            free(handle);
+        }
+    }
+    return poolCnt;
+}
+
+/**
+ * @brief Get a handle, a recycled one is popped without allocating.
+ *
+ * @param queue The queue.
+ * @param kind Kind of the handle to create.
+ * @param isReady Set to true if the reset hook of kind is already applied on the handle.
+ * @return void* The handle, NULL if heap or pool is exhausted.
+ */
+static void *RTI_QueueHandleAlloc(RTI_QUEUE *queue, uint8_t kind, bool *isReady)
+{
+    *isReady = false;
+    // handle cache is process local, peers of a shared queue cannot see it
+    if (queue->isShared == false) {
+        uint8_t cachedKind = RTI_QUEUE_HANDLE_RAW;
+        void *handle = RTI_QueueCachePop(queue, &cachedKind);
+        if (handle != NULL) {
+            *isReady = (cachedKind == kind);
+            return handle;
+        }
+    }
+    if (queue->pool != NULL) {
+        return NULL;
+    }
+    return malloc(RTI_QUEUE_HANDLE_SIZE);
+}
+
+/**
+ * @brief Give back a reset handle, it is cached for the next create if possible.
+ *
+ * @param queue The queue of the handle.
+ * @param handle The handle.
+ * @param kind Kind of the handle.
+ */
+static void RTI_QueueHandleRecycle(RTI_QUEUE *queue, void *handle, uint8_t kind)
+{
+    bool inPool = RTI_QueueHandleInPool(queue, handle);
+    // heap handles created before the pool are not cached, so the cache only holds pool nodes
+    if (queue->isShared == false && (inPool == true || queue->pool == NULL)) {
+        if (RTI_QueueCachePush(queue, handle, kind) == true || inPool == true) {
+            return;
+        }
+    }
+    free(handle);
+}
+
+/**
+ * @brief Reset hook of producers, puts a producer into the state of a created one.
+ *
+ * @param queue The queue.
+ * @param producer The producer.
+ */
+static void RTI_QueueProducerReset(RTI_QUEUE *queue, RTI_QUEUE_PRODUCER *producer)
+{
+    memset(producer, 0, sizeof(RTI_QUEUE_PRODUCER));
+    producer->queue = queue;
+    atomic_init(&producer->throttled, false);
+}
+
+/**
+ * @brief Reset hook of consumers, puts a consumer into the state of a created one.
+ *
+ * @param queue The queue.
+ * @param consumer The consumer.
+ */
+static void RTI_QueueConsumerReset(RTI_QUEUE *queue, RTI_QUEUE_CONSUMER *consumer)
+{
+    memset(consumer, 0, sizeof(RTI_QUEUE_CONSUMER));
+    consumer->queue = queue;
+    // start from the last lane, so the first round-robin pick wraps to lane 0
+    consumer->wrrLane = queue->cfg.lanes - 1;
+    consumer->pollFd = -1;
+    atomic_init(&consumer->pollArmed, false);
+}
+
+/**
+ * @brief Check if a lane has no message for consumers.
+ *
+ * @param queue The queue.
+ * @param lane The lane.
+ * @return true The lane is empty.
+ * @return false The lane is not empty.
+ */
+static inline bool RTI_QueueLaneIsEmpty(RTI_QUEUE *queue, RTI_QUEUE_LANE *lane)
+{
+    size_t pos = atomic_load_explicit(&lane->deqPos, memory_order_relaxed);
+    RTI_QUEUE_SLOT *slot = RTI_QUEUE_GET_SLOT(queue, lane, pos);
+    return atomic_load_explicit(&slot->seq, memory_order_acquire) != pos + 1;
+}
+
+/**
+ * @brief Check if the next slot of a lane is free for producers.
+ *
+ * @param queue The queue.
+ * @param lane The lane.
+ * @return true A producer can claim a slot.
+ * @return false The lane is full, or its oldest slot is still held by a consumer.
+ */
+static inline bool RTI_QueueLaneHasSpace(RTI_QUEUE *queue, RTI_QUEUE_LANE *lane)
+{
+    size_t pos = atomic_load_explicit(&lane->enqPos, memory_order_relaxed);
+    RTI_QUEUE_SLOT *slot = RTI_QUEUE_GET_SLOT(queue, lane, pos);
+    return (intptr_t)atomic_load_explicit(&slot->seq, memory_order_acquire) - (intptr_t)pos >= 0;
+}
+
+/**
+ * @brief Claim a free slot of a lane for producer.
+ *
+ * @param queue The queue.
+ * @param lane The lane.
+ * @param posOut Pointer to store the claimed ring position.
+ * @return RTI_ERR Error code indicating success or failure.
+ */
+static RTI_ERR RTI_QueueLaneClaimEnq(RTI_QUEUE *queue, RTI_QUEUE_LANE *lane, size_t *posOut)
+{
+    size_t pos = atomic_load_explicit(&lane->enqPos, memory_order_relaxed);
+    for (;;) {
+        RTI_QUEUE_SLOT *slot = RTI_QUEUE_GET_SLOT(queue, lane, pos);
+        size_t seq = atomic_load_explicit(&slot->seq, memory_order_acquire);
+        intptr_t diff = (intptr_t)seq - (intptr_t)pos;
+        if (diff == 0) {
+            if (atomic_compare_exchange_weak_explicit(&lane->enqPos, &pos, pos + 1,
+                    memory_order_relaxed, memory_order_relaxed)) {
+                *posOut = pos;
+                return RTI_OK;
+            }
+        }
+        else if (diff < 0) {
+            return RTI_ERR_QUEUE_FULL;
+        }
+        else {
+            pos = atomic_load_explicit(&lane->enqPos, memory_order_relaxed);
+        }
+    }
+}
+
+/**
+ * @brief Claim a filled slot of a lane for consumer.
+ *
+ * @param queue The queue.
+ * @param lane The lane.
+ * @param capacity [in] buffer size of consumer, [out] message size if it is larger.
+ * @param posOut Pointer to store the claimed ring position.
+ * @return RTI_ERR Error code indicating success or failure.
+ * @note the message stays in lane if it is larger than capacity.
+ */
+static RTI_ERR RTI_QueueLaneClaimDeq(RTI_QUEUE *queue, RTI_QUEUE_LANE *lane, size_t *capacity, size_t *posOut)
+{
+    size_t pos = atomic_load_explicit(&lane->deqPos, memory_order_relaxed);
+    for (;;) {
+        RTI_QUEUE_SLOT *slot = RTI_QUEUE_GET_SLOT(queue, lane, pos);
+        size_t seq = atomic_load_explicit(&slot->seq, memory_order_acquire);
+        intptr_t diff = (intptr_t)seq - (intptr_t)(pos + 1);
+        if (diff == 0) {
+            if (slot->size > *capacity && slot->size != RTI_QUEUE_SLOT_DROPPED) {
+                *capacity = slot->size;
+                return RTI_ERR_INVALID_PARAM;
+            }
+            // seq_cst pairs with throttledCnt, so flow control never misses a resume
+            if (atomic_compare_exchange_weak_explicit(&lane->deqPos, &pos, pos + 1,
+                    memory_order_seq_cst, memory_order_relaxed)) {
+                *posOut = pos;
+                return RTI_OK;
+            }
+        }
+        else if (diff < 0) {
+            return RTI_ERR_QUEUE_EMPTY;
+        }
+        else {
+            pos = atomic_load_explicit(&lane->deqPos, memory_order_relaxed);
+        }
+    }
+}
+
+/**
+ * @brief Hand a slot over by moving its sequence number.
+ *
+ * @param queue The queue.
+ * @param slot The slot held by caller.
+ * @param from The sequence number caller saw when claiming.
+ * @param to The next sequence number.
+ * @return RTI_ERR RTI_ERR_FAILED if the slot was taken over by peer recovery.
+ * @note shared queues use CAS, so a peer recovering the slot and
+ *       a late owner can never both win.
+ */
+static inline RTI_ERR RTI_QueueSlotHandOver(RTI_QUEUE *queue, RTI_QUEUE_SLOT *slot, size_t from, size_t to)
+{
+    if (queue->isShared == false) {
+        atomic_store_explicit(&slot->seq, to, memory_order_release);
+        return RTI_OK;
+    }
+    if (atomic_compare_exchange_strong_explicit(&slot->seq, &from, to,
+            memory_order_release, memory_order_relaxed) == false) {
+        return RTI_ERR_FAILED;
+    }
+    return RTI_OK;
+}
+
+/**
+ * @brief Pick the lane to dequeue from, O(1) on the ready mask.
+ *
+ * @param consumer The consumer.
+ * @param ready The ready mask, must not be zero.
+ * @return uint8_t The lane index.
+ */
+static inline uint8_t RTI_QueuePickLane(RTI_QUEUE_CONSUMER *consumer, unsigned ready)
+{
+    RTI_QUEUE *queue = consumer->queue;
+    if (queue->cfg.sched == RTI_QUEUE_SCHED_STRICT) {
+        return (uint8_t)__builtin_ctz(ready);
+    }
+    // keep serving current lane until its credit runs out
+    if (consumer->wrrCredit == 0 || (ready & (1u << consumer->wrrLane)) == 0) {
+        unsigned after = ready & ~((2u << consumer->wrrLane) - 1);
+        consumer->wrrLane = (uint8_t)__builtin_ctz(after != 0 ? after : ready);
+        consumer->wrrCredit = queue->cfg.weights[consumer->wrrLane];
+    }
+    return consumer->wrrLane;
+}
+
+/**
+ * @brief Get the message capacity of the queue.
+ *
+ * @param queue The queue.
+ * @return uint32_t Message count the queue can hold.
+ */
+static inline uint32_t RTI_QueueCapacity(RTI_QUEUE *queue)
+{
+    return queue->cfg.depth * queue->cfg.lanes;
+}
+
+/**
+ * @brief Move queue memory and handle pool to a NUMA node.
+ *
+ * @param queue The queue.
+ * @param node The node.
+ * @return RTI_ERR Error code of RTIPriv_OsMemBind().
+ */
+static RTI_ERR RTI_QueueNumaMove(RTI_QUEUE *queue, int node)
+{
+    RTI_ERR err = RTIPriv_OsMemBind(queue, queue->memSize, node);
+    if (err == RTI_OK && queue->pool != NULL) {
+        err = RTIPriv_OsMemBind(queue->pool, RTI_QUEUE_POOL_SIZE(queue->poolCnt), node);
+    }
+    return err;
+}
+
+/**
+ * @brief Move a queue of RTI_QUEUE_NUMA_AUTO to the node of the calling consumer, once.
+ *
+ * @param queue The queue.
+ * @note the first consumer decides, a failed move is not retried by later consumers.
+ */
+static void RTI_QueueNumaAuto(RTI_QUEUE *queue)
+{
+    if (queue->cfg.numaNode != RTI_QUEUE_NUMA_AUTO) {
+        return;
+    }
+    int expect = RTI_QUEUE_NUMA_UNBOUND;
+    if (atomic_load_explicit(&queue->numaNode, memory_order_relaxed) != expect) {
+        return;
+    }
+    if (atomic_compare_exchange_strong_explicit(&queue->numaNode, &expect, RTI_QUEUE_NUMA_TRIED,
+                                                memory_order_relaxed, memory_order_relaxed) == false) {
+        return;
+    }
+    int node = RTIPriv_OsCpuNode();
+    if (node >= 0 && RTI_QueueNumaMove(queue, node) == RTI_OK) {
+        atomic_store_explicit(&queue->numaNode, node, memory_order_relaxed);
+    }
+}
+
+/**
+ * @brief Get the count of queued messages, may be a little stale.
+ *
+ * @param queue The queue.
+ * @return uint32_t Queued message count of all lanes, including claimed slots.
+ * @note this function is only for RTI internal use.
+ */
+uint32_t RTIPriv_QueueUsed(RTI_QUEUE *queue)
+{
+    size_t used = 0;
+    for (uint8_t i = 0; i < queue->cfg.lanes; i++) {
+        size_t deq = atomic_load_explicit(&queue->lanes[i].deqPos, memory_order_seq_cst);
+        size_t enq = atomic_load_explicit(&queue->lanes[i].enqPos, memory_order_relaxed);
+        used += (enq > deq) ? (enq - deq) : 0;
+    }
+    return (uint32_t)used;
+}
+
+static inline void RTI_QueueFlowLock(RTI_QUEUE *queue)
+{
+    while (atomic_flag_test_and_set_explicit(&queue->flowLock, memory_order_acquire)) {
+    }
+}
+
+static inline void RTI_QueueFlowUnlock(RTI_QUEUE *queue)
+{
+    atomic_flag_clear_explicit(&queue->flowLock, memory_order_release);
+}
+
+/**
+ * @brief Call wakeF of resumed producers, see RTI_QueueProducerWaitArm().
+ *
+ * @param wakeList Producers collected by RTI_QueueFlowResume().
+ */
+static void RTI_QueueFlowWake(RTI_QUEUE_PRODUCER *wakeList)
+{
+    // waiters may send again right in wakeF, so take their fields first
+    while (wakeList != NULL) {
+        RTI_QUEUE_PRODUCER *next = wakeList->wakeNext;
+        RTI_VlanWakeFptr wakeF = wakeList->wakeF;
+        wakeList->wakeF = NULL;
+        wakeF(wakeList->wakeArg);
+        wakeList = next;
+    }
+}
+
+/**
+ * @brief Resume throttled producers whose low watermark is reached.
+ *
+ * @param queue The queue.
+ * @param wakeList [in,out] Resumed producers with a wakeF are pushed here, for RTI_QueueFlowWake().
+ * @note notifyF is called with flow lock held,
+ *       it must not set flow config or delete producers of the same queue.
+ *       wakeF is left to the caller, a consumer calls it once its slot is released,
+ *       so the resumed producer finds the space.
+ */
+static void RTI_QueueFlowResume(RTI_QUEUE *queue, RTI_QUEUE_PRODUCER **wakeList)
+{
+    uint32_t used = RTIPriv_QueueUsed(queue);
+    bool resumed = false;
+    RTI_QueueFlowLock(queue);
+    for (RTI_QUEUE_PRODUCER *itr = queue->flowList; itr != NULL; itr = itr->flowNext) {
+        if (atomic_load_explicit(&itr->throttled, memory_order_relaxed) == false || used > itr->flow.lowWatermark) {
+            continue;
+        }
+        // the queue may be nearly empty while the lane is still full
+        if (itr->flowLane != RTI_QUEUE_FLOW_LANE_ANY && RTI_QueueLaneHasSpace(queue, &queue->lanes[itr->flowLane]) == false) {
+            continue;
+        }
+        atomic_store_explicit(&itr->throttled, false, memory_order_relaxed);
+        atomic_fetch_sub_explicit(&queue->throttledCnt, 1, memory_order_relaxed);
+        resumed = true;
+        if (itr->flow.mode == RTI_VLAN_FLOW_MODE_CALLBACK && itr->flow.notifyF != NULL) {
+            itr->flow.notifyF(itr, RTI_VLAN_FLOW_OPEN, itr->flow.notifyArg);
+        }
+        if (itr->wakeF != NULL) {
+            itr->wakeNext = *wakeList;
+            *wakeList = itr;
+        }
+    }
+    RTI_QueueFlowUnlock(queue);
+    if (resumed == true) {
+        atomic_fetch_add_explicit(&queue->flowSeq, 1, memory_order_release);
+        RTIPriv_OsWake(&queue->flowSeq, -1, false);
+    }
+}
+
+/**
+ * @brief Mark a producer throttled.
+ *
+ * @param producer The producer.
+ * @param lane The lane found full, RTI_QUEUE_FLOW_LANE_ANY if throttled by the high watermark.
+ * @note a producer throttled by a full lane is only resumed once that lane has space,
+ *       by the consumer which releases a slot of it.
+ */
+static void RTI_QueueFlowThrottle(RTI_QUEUE_PRODUCER *producer, uint8_t lane)
+{
+    RTI_QUEUE *queue = producer->queue;
+    if (atomic_load_explicit(&producer->throttled, memory_order_relaxed) == true) {
+        return;
+    }
+    RTI_QueueFlowLock(queue);
+    producer->flowLane = lane;
+    atomic_store_explicit(&producer->throttled, true, memory_order_relaxed);
+    atomic_fetch_add_explicit(&queue->throttledCnt, 1, memory_order_seq_cst);
+    if (producer->flow.mode == RTI_VLAN_FLOW_MODE_CALLBACK && producer->flow.notifyF != NULL) {
+        producer->flow.notifyF(producer, RTI_VLAN_FLOW_THROTTLED, producer->flow.notifyArg);
+    }
+    RTI_QueueFlowUnlock(queue);
+    // consumer may drain everything before it could see us throttled
+    RTI_QUEUE_PRODUCER *wakeList = NULL;
+    RTI_QueueFlowResume(queue, &wakeList);
+    RTI_QueueFlowWake(wakeList);
+}
+
+/**
+ * @brief Resume producers throttled by a full lane, after a consumer gave a slot back.
+ *
+ * @param queue The queue.
+ * @param wakeList [in,out] See RTI_QueueFlowResume().
+ */
+static inline void RTI_QueueFlowRelease(RTI_QUEUE *queue, RTI_QUEUE_PRODUCER **wakeList)
+{
+    // pairs with the self-resume of a producer throttling itself, so one of us sees the other
+    atomic_thread_fence(memory_order_seq_cst);
+    if (atomic_load_explicit(&queue->throttledCnt, memory_order_relaxed) != 0) {
+        RTI_QueueFlowResume(queue, wakeList);
+    }
+}
+
+/**
+ * @brief Wait until a producer is not throttled.
+ *
+ * @param producer The producer.
+ * @return RTI_ERR Error code indicating success or failure.
+ */
+static RTI_ERR RTI_QueueFlowWait(RTI_QUEUE_PRODUCER *producer)
+{
+    RTI_QUEUE *queue = producer->queue;
+    for (;;) {
+        unsigned seq = atomic_load_explicit(&queue->flowSeq, memory_order_acquire);
+        if (atomic_load_explicit(&producer->throttled, memory_order_acquire) == false) {
+            return RTI_OK;
+        }
+        RTI_ERR err = RTIPriv_OsWait(&queue->flowSeq, seq, false, -1);
+        if (err != RTI_OK) {
+            return err;
+        }
+    }
+}
+
+/**
+ * @brief Take a credit before sending, by producer flow mode.
+ *
+ * @param producer The producer.
+ * @return RTI_ERR RTI_OK if producer can send.
+ */
+static RTI_ERR RTI_QueueFlowAcquire(RTI_QUEUE_PRODUCER *producer)
+{
+    for (;;) {
+        if (atomic_load_explicit(&producer->throttled, memory_order_relaxed) == false) {
+            if (RTIPriv_QueueUsed(producer->queue) < producer->flow.highWatermark) {
+                return RTI_OK;
+            }
+            RTI_QueueFlowThrottle(producer, RTI_QUEUE_FLOW_LANE_ANY);
+        }
+        if (producer->flow.mode != RTI_VLAN_FLOW_MODE_BLOCK) {
+            return RTI_ERR_FLOW_THROTTLED;
+        }
+        RTI_ERR err = RTI_QueueFlowWait(producer);
+        if (err != RTI_OK) {
+            return err;
+        }
+    }
+}
+
+/**
+ * @brief Remove a producer from flow list of its queue.
+ *
+ * @param producer The producer.
+ */
+static void RTI_QueueFlowDetach(RTI_QUEUE_PRODUCER *producer)
+{
+    RTI_QUEUE *queue = producer->queue;
+    RTI_QueueFlowLock(queue);
+    RTI_QUEUE_PRODUCER **itr = &queue->flowList;
+    while (*itr != NULL && *itr != producer) {
+        itr = &(*itr)->flowNext;
+    }
+    if (*itr == producer) {
+        *itr = producer->flowNext;
+    }
+    if (atomic_load_explicit(&producer->throttled, memory_order_relaxed) == true) {
+        atomic_store_explicit(&producer->throttled, false, memory_order_relaxed);
+        atomic_fetch_sub_explicit(&queue->throttledCnt, 1, memory_order_relaxed);
+    }
+    producer->flowNext = NULL;
+    producer->flowEnabled = false;
+    producer->wakeF = NULL;
+    RTI_QueueFlowUnlock(queue);
+}
+
+#if RTI_ENABLE_RATE_LIMIT == 1
+/**
+ * @brief Take a token from the rate limiter of a queue.
+ *
+ * @param queue The queue, must be rate limited.
+ * @return RTI_ERR RTI_OK if a token is taken, RTI_ERR_RATE_LIMITED if the bucket is empty.
+ * @note the bucket is kept as the time it would be full again (GCRA),
+ *       so one CAS both refills it lazily and takes a token.
+ *       BLOCK policy takes the token ahead of time and sleeps until it is due.
+ */
+static RTI_ERR RTI_QueueRateAcquire(RTI_QUEUE *queue)
+{
+    uint64_t now = RTIPriv_OsNowNs();
+    uint64_t tat = atomic_load_explicit(&queue->rateTat, memory_order_relaxed);
+    uint64_t next = 0;
+    do {
+        next = ((tat > now) ? tat : now) + queue->rateInterval;
+        if (next - now > queue->rateBurst && queue->ratePolicy != RTI_VLAN_RATE_BLOCK) {
+            return RTI_ERR_RATE_LIMITED;
+        }
+    } while (atomic_compare_exchange_weak_explicit(&queue->rateTat, &tat, next,
+                                                   memory_order_relaxed, memory_order_relaxed) == false);
+    if (next - now > queue->rateBurst) {
+        RTIPriv_OsSleepNs(next - now - queue->rateBurst);
+    }
+    return RTI_OK;
+}
+
+/**
+ * @brief Send a message refused by the rate limiter to the overflow VLAN.
+ *
+ * @param producer The producer.
+ * @param msg The message.
+ * @param size The message size in bytes.
+ * @param lane The lane index.
+ * @return RTI_ERR Error code of the overflow VLAN.
+ * @note the overflow producer is created on first divert and owned by the producer.
+ */
+static RTI_ERR RTI_QueueRateDivert(RTI_QUEUE_PRODUCER *producer, const void *msg, size_t size, uint8_t lane)
+{
+    RTI_VlanId vlan = producer->queue->rateOverflow;
+    if (producer->divertIfx != NULL && producer->divertVlan != vlan) {
+        producer->divertIfx->deleteProducerF(producer->divertProducer);
+        producer->divertIfx = NULL;
+    }
+    if (producer->divertIfx == NULL) {
+        RTI_VLAN_DESC desc;
+        RTI_ERR err = RTIPriv_VlanSelect(vlan, &desc);
+        if (err != RTI_OK) {
+            return err;
+        }
+        if (desc.ifx->sendF == NULL) {
+            return RTI_ERR_NOT_SUPPORTED;
+        }
+        producer->divertProducer = desc.ifx->createProducerF();
+        if (producer->divertProducer == NULL) {
+            return RTI_ERR_FAILED;
+        }
+        producer->divertIfx = desc.ifx;
+        producer->divertVlan = vlan;
+        producer->divertLanes = (desc.lanes == 0) ? 1 : desc.lanes;
+    }
+    // overflow VLAN with fewer lanes takes the rest on its lowest priority lane
+    if (lane >= producer->divertLanes) {
+        lane = producer->divertLanes - 1;
+    }
+    return producer->divertIfx->sendF(producer->divertProducer, msg, size, lane);
+}
+#endif
+
+static inline void RTI_QueuePollLock(RTI_QUEUE *queue)
+{
+    while (atomic_flag_test_and_set_explicit(&queue->pollLock, memory_order_acquire)) {
+    }
+}
+
+static inline void RTI_QueuePollUnlock(RTI_QUEUE *queue)
+{
+    atomic_flag_clear_explicit(&queue->pollLock, memory_order_release);
+}
+
+/**
+ * @brief Make fd of armed consumers readable, called by producers.
+ *
+ * @param queue The queue.
+ */
+static void RTI_QueuePollSignal(RTI_QUEUE *queue)
+{
+    RTI_QUEUE_CONSUMER *wakeList = NULL;
+    RTI_QueuePollLock(queue);
+    for (RTI_QUEUE_CONSUMER *itr = queue->pollList; itr != NULL; itr = itr->pollNext) {
+        if (atomic_exchange_explicit(&itr->pollArmed, false, memory_order_relaxed) == true) {
+            atomic_fetch_sub_explicit(&queue->pollArmedCnt, 1, memory_order_relaxed);
+            if (itr->wakeF != NULL) {
+                itr->wakeNext = wakeList;
+                wakeList = itr;
+            }
+            else {
+                RTIPriv_OsEventSignal(itr->pollFd);
+            }
+        }
+    }
+    RTI_QueuePollUnlock(queue);
+    // waiters may receive and arm again right in wakeF, so take their fields first
+    while (wakeList != NULL) {
+        RTI_QUEUE_CONSUMER *next = wakeList->wakeNext;
+        wakeList->wakeF(wakeList->wakeArg);
+        wakeList = next;
+    }
+}
+
+/**
+ * @brief Arm fd of a consumer which found the queue empty.
+ *
+ * @param consumer The consumer.
+ * @note fd stays readable while the queue may have messages,
+ *       it is only cleared here, after the consumer drained the queue.
+ */
+static void RTI_QueuePollArm(RTI_QUEUE_CONSUMER *consumer)
+{
+    RTI_QUEUE *queue = consumer->queue;
+    if (atomic_load_explicit(&consumer->pollArmed, memory_order_relaxed) == true) {
+        return;
+    }
+    RTIPriv_OsEventClear(consumer->pollFd);
+    atomic_store_explicit(&consumer->pollArmed, true, memory_order_relaxed);
+    atomic_fetch_add_explicit(&queue->pollArmedCnt, 1, memory_order_relaxed);
+    // arm before the last check, pairs with the fence in RTI_QueueSendCommit()
+    atomic_thread_fence(memory_order_seq_cst);
+    if (atomic_load_explicit(&queue->readyMask, memory_order_relaxed) == 0) {
+        return;
+    }
+    // a producer raced us, signal on its behalf unless it already did
+    if (atomic_exchange_explicit(&consumer->pollArmed, false, memory_order_relaxed) == true) {
+        atomic_fetch_sub_explicit(&queue->pollArmedCnt, 1, memory_order_relaxed);
+        RTIPriv_OsEventSignal(consumer->pollFd);
+    }
+}
+
+/**
+ * @brief Remove a consumer from poll list of its queue.
+ *
+ * @param consumer The consumer.
+ */
+static void RTI_QueuePollDetach(RTI_QUEUE_CONSUMER *consumer)
+{
+    RTI_QUEUE *queue = consumer->queue;
+    RTI_QueuePollLock(queue);
+    RTI_QUEUE_CONSUMER **itr = &queue->pollList;
+    while (*itr != NULL && *itr != consumer) {
+        itr = &(*itr)->pollNext;
+    }
+    if (*itr == consumer) {
+        *itr = consumer->pollNext;
+    }
+    if (atomic_exchange_explicit(&consumer->pollArmed, false, memory_order_relaxed) == true) {
+        atomic_fetch_sub_explicit(&queue->pollArmedCnt, 1, memory_order_relaxed);
+    }
+    RTI_QueuePollUnlock(queue);
+    if (consumer->pollFd >= 0) {
+        RTIPriv_OsEventClose(consumer->pollFd);
+        consumer->pollFd = -1;
+    }
+    consumer->wakeF = NULL;
+}
+
+/**
+ * @brief Mark lanes ready and wake consumers waiting for them.
+ *
+ * @param queue The queue.
+ * @param bits Ready bits of lanes with new messages.
+ */
+static void RTI_QueuePublish(RTI_QUEUE *queue, unsigned bits)
+{
+    // publish lane before reading mask, pairs with the fence in RTI_QueueRecvClaim()
+    atomic_thread_fence(memory_order_seq_cst);
+    if ((atomic_load_explicit(&queue->readyMask, memory_order_relaxed) & bits) != bits) {
+        atomic_fetch_or_explicit(&queue->readyMask, bits, memory_order_release);
+    }
+    // only pay for a syscall when some consumer is parked, pairs with RTI_QueueRecvPark()
+    if (atomic_load_explicit(&queue->parkedCnt, memory_order_relaxed) != 0) {
+        atomic_fetch_add_explicit(&queue->wakeSeq, 1, memory_order_release);
+        RTIPriv_OsWake(&queue->wakeSeq, 1, queue->isShared);
+    }
+    if (atomic_load_explicit(&queue->pollArmedCnt, memory_order_relaxed) != 0) {
+        RTI_QueuePollSignal(queue);
+    }
+}
+
+/**
+ * @brief RTI_QueuePublish() for ISR mailboxes, async-signal-safe.
+ *
+ * @param queue The queue.
+ * @note poll lock is only tried, whoever holds it re-checks the ready mask
+ *       after arming, so a busy lock never loses the signal.
+ *       wakeF of consumers is not signal-safe, they stay armed for the next publish.
+ *       futex wake and eventfd write may set errno, it is restored for the interrupted code.
+ */
+static void RTI_QueuePublishIsr(RTI_QUEUE *queue)
+{
+    int savedErrno = errno;
+    atomic_fetch_or_explicit(&queue->readyMask, RTI_QUEUE_READY_ISR, memory_order_seq_cst);
+    if (atomic_load_explicit(&queue->parkedCnt, memory_order_relaxed) != 0) {
+        atomic_fetch_add_explicit(&queue->wakeSeq, 1, memory_order_release);
+        RTIPriv_OsWake(&queue->wakeSeq, 1, queue->isShared);
+    }
+    if (atomic_load_explicit(&queue->pollArmedCnt, memory_order_relaxed) == 0
+        || atomic_flag_test_and_set_explicit(&queue->pollLock, memory_order_acquire) == true) {
+        errno = savedErrno;
+        return;
+    }
+    for (RTI_QUEUE_CONSUMER *itr = queue->pollList; itr != NULL; itr = itr->pollNext) {
+        if (itr->wakeF == NULL && atomic_exchange_explicit(&itr->pollArmed, false, memory_order_relaxed) == true) {
+            atomic_fetch_sub_explicit(&queue->pollArmedCnt, 1, memory_order_relaxed);
+            RTIPriv_OsEventSignal(itr->pollFd);
+        }
+    }
+    RTI_QueuePollUnlock(queue);
+    errno = savedErrno;
+}
+
+/**
+ * @brief Move messages of ISR mailboxes into their lanes, called by consumers.
+ *
+ * @param queue The queue.
+ * @note only one consumer drains at a time, others go on with the lanes.
+ *       messages stay in mailbox while their lane is full.
+ */
+static void RTI_QueueIsrDrain(RTI_QUEUE *queue)
+{
+    if (atomic_flag_test_and_set_explicit(&queue->isrLock, memory_order_acquire) == true) {
+        return;
+    }
+    // clear before reading tails, pairs with RTI_QueuePublishIsr()
+    atomic_fetch_and_explicit(&queue->readyMask, ~RTI_QUEUE_READY_ISR, memory_order_seq_cst);
+    unsigned bits = 0;
+    bool left = false;
+    for (RTI_QUEUE_ISR *isr = queue->isrList; isr != NULL; isr = isr->next) {
+        size_t head = atomic_load_explicit(&isr->head, memory_order_relaxed);
+        size_t tail = atomic_load_explicit(&isr->tail, memory_order_acquire);
+        for (; head != tail; head++) {
+            RTI_QUEUE_ISR_SLOT *from = RTI_QUEUE_GET_ISR_SLOT(isr, head);
+            RTI_QUEUE_LANE *lane = &queue->lanes[from->lane];
+            size_t pos = 0;
+            if (RTI_QueueLaneClaimEnq(queue, lane, &pos) != RTI_OK) {
+                left = true;
+                break;
+            }
+            RTI_QUEUE_SLOT *to = RTI_QUEUE_GET_SLOT(queue, lane, pos);
+            memcpy(to + 1, from + 1, from->size);
+            to->size = from->size;
+            to->owner = 0;
+            RTI_QueueSlotHandOver(queue, to, pos, pos + 1);
+            bits |= 1u << from->lane;
+        }
+        atomic_store_explicit(&isr->head, head, memory_order_release);
+    }
+    if (left == true) {
+        atomic_fetch_or_explicit(&queue->readyMask, RTI_QUEUE_READY_ISR, memory_order_release);
+    }
+    atomic_flag_clear_explicit(&queue->isrLock, memory_order_release);
+    if (bits != 0) {
+        RTI_QueuePublish(queue, bits);
+    }
+}
+
+/* Exported function definitions -------------------------------------------------*/
+
+/**
+ * @brief Get the memory size needed by a queue.
+ *
+ * @param cfg The queue configuration.
+ * @return size_t Memory size in bytes, 0 if configuration is invalid.
+ */
+size_t RTI_QueueMemSize(const RTI_QUEUE_CFG *cfg)
+{
+    if (RTI_QueueCfgIsValid(cfg) == false) {
+        return 0;
+    }
+    return sizeof(RTI_QUEUE) + (size_t)cfg->lanes * cfg->depth * RTI_QueueSlotStride(cfg);
+}
+
+/**
+ * @brief Init a queue on caller provided memory.
+ *
+ * @param mem Memory to hold the queue, aligned to RTI_CACHELINE_SIZE is recommended.
+ * @param sizeBytes Memory size in bytes, see RTI_QueueMemSize().
+ * @param cfg The queue configuration.
+ * @param queueOut Pointer to store the queue.
+ * @return RTI_ERR Error code indicating success or failure.
+ */
+RTI_ERR RTI_QueueInit(void *mem, size_t sizeBytes, const RTI_QUEUE_CFG *cfg, RTI_QUEUE **queueOut)
+{
+    if (mem == NULL || queueOut == NULL || RTI_QueueCfgIsValid(cfg) == false) {
+        return RTI_ERR_INVALID_PARAM;
+    }
+    if (sizeBytes < RTI_QueueMemSize(cfg)) {
+        return RTI_ERR_NO_MEMORY;
+    }
+    // bind before the first touch below, so pages are allocated on the node
+    int node = RTI_QUEUE_NUMA_UNBOUND;
+    if (cfg->numaNode != RTI_QUEUE_NUMA_AUTO && cfg->numaNode != RTI_QUEUE_NUMA_NONE &&
+        RTIPriv_OsMemBind(mem, sizeBytes, cfg->numaNode - 1) == RTI_OK) {
+        node = cfg->numaNode - 1;
+    }
+    // advise and fault in after binding, so the pages follow both
+    uint8_t pageKind = RTI_QUEUE_PAGE_NORMAL;
+    if ((cfg->memFlags & RTI_QUEUE_MEM_HUGE) != 0 && RTIPriv_OsHugeAdvise(mem, sizeBytes) == RTI_OK) {
+        pageKind = RTI_QUEUE_PAGE_THP;
+    }
+    if ((cfg->memFlags & RTI_QUEUE_MEM_PREFAULT) != 0) {
+        RTIPriv_OsMemPrefault(mem, sizeBytes);
+    }
+    RTI_QUEUE *queue = (RTI_QUEUE *)mem;
+    memset(queue, 0, sizeof(RTI_QUEUE));
+    queue->cfg = *cfg;
+    queue->memSize = sizeBytes;
+    queue->pageKind = pageKind;
+    atomic_init(&queue->numaNode, node);
+    queue->posMask = cfg->depth - 1;
+    queue->slotStride = RTI_QueueSlotStride(cfg);
+    atomic_init(&queue->readyMask, 0);
+    atomic_init(&queue->parkedCnt, 0);
+    atomic_init(&queue->wakeSeq, 0);
+    atomic_init(&queue->throttledCnt, 0);
+    atomic_init(&queue->flowSeq, 0);
+    atomic_flag_clear(&queue->flowLock);
+    atomic_init(&queue->pollArmedCnt, 0);
+    atomic_flag_clear(&queue->pollLock);
+    atomic_flag_clear(&queue->isrLock);
+#if RTI_ENABLE_RATE_LIMIT == 1
+    atomic_init(&queue->rateTat, 0);
+#endif
+    atomic_init(&queue->cacheEnq, 0);
+    atomic_init(&queue->cacheDeq, 0);
+    for (size_t pos = 0; pos < RTI_QUEUE_HANDLE_CACHE; pos++) {
+        atomic_init(&queue->cache[pos].seq, pos);
+    }
+
+    size_t slotsOffset = sizeof(RTI_QUEUE);
+    for (uint8_t i = 0; i < cfg->lanes; i++) {
+        RTI_QUEUE_LANE *lane = &queue->lanes[i];
+        atomic_init(&lane->enqPos, 0);
+        atomic_init(&lane->deqPos, 0);
+        lane->slotsOffset = slotsOffset;
+        for (size_t pos = 0; pos < cfg->depth; pos++) {
+            RTI_QUEUE_SLOT *slot = RTI_QUEUE_GET_SLOT(queue, lane, pos);
+            atomic_init(&slot->seq, pos);
+            slot->owner = 0;
+        }
+        slotsOffset += cfg->depth * queue->slotStride;
+        // default weights favour higher priority lanes
+        if (queue->cfg.weights[i] == 0) {
+            queue->cfg.weights[i] = (uint8_t)(1u << (cfg->lanes - 1 - i));
+        }
+    }
+    *queueOut = queue;
+    return RTI_OK;
+}
+
+/**
+ * @brief Create a queue on heap.
+ *
+ * @param cfg The queue configuration.
+ * @param queueOut Pointer to store the queue.
+ * @return RTI_ERR Error code indicating success or failure.
+ * @note RTI_QUEUE_MEM_HUGE rounds the queue up to RTI_HUGE_PAGE_SIZE and maps it,
+ *       it never fails for lack of huge pages, see RTIPriv_QueuePageKind().
+ */
+RTI_ERR RTI_QueueCreate(const RTI_QUEUE_CFG *cfg, RTI_QUEUE **queueOut)
+{
+    size_t sizeBytes = RTI_QueueMemSize(cfg);
+    if (sizeBytes == 0 || queueOut == NULL) {
+        return RTI_ERR_INVALID_PARAM;
+    }
+    void *mem = NULL;
+    bool isHugetlb = false;
+    if ((cfg->memFlags & RTI_QUEUE_MEM_HUGE) != 0) {
+        mem = RTIPriv_OsHugeMap(RTI_QUEUE_ALIGN_UP(sizeBytes, RTI_HUGE_PAGE_SIZE), &isHugetlb);
+    }
+    bool isMapped = (mem != NULL);
+    if (isMapped == true) {
+        sizeBytes = RTI_QUEUE_ALIGN_UP(sizeBytes, RTI_HUGE_PAGE_SIZE);
+    }
+    else {
+        // page aligned memory is bound to a NUMA node entirely, without touching neighbours
+        size_t align = (cfg->numaNode == RTI_QUEUE_NUMA_NONE) ? RTI_CACHELINE_SIZE : RTIPriv_OsPageSize();
+        sizeBytes = RTI_QUEUE_ALIGN_UP(sizeBytes, align);
+        mem = aligned_alloc(align, sizeBytes);
+        if (mem == NULL) {
+            return RTI_ERR_NO_MEMORY;
+        }
+    }
+    RTI_ERR err = RTI_QueueInit(mem, sizeBytes, cfg, queueOut);
+    if (err != RTI_OK) {
+        if (isMapped == true) {
+            RTIPriv_OsHugeUnmap(mem, sizeBytes);
+        }
+        else {
+            free(mem);
+        }
+        return err;
+    }
+    (*queueOut)->isHeap = true;
+    (*queueOut)->isMapped = isMapped;
+    if (isHugetlb == true) {
+        (*queueOut)->pageKind = RTI_QUEUE_PAGE_HUGETLB;
+    }
+    return RTI_OK;
+}
+
+/**
+ * @brief Delete a queue, recycled handles in its handle cache are freed.
+ *
+ * @param queue The queue.
+ * @note queue created by RTI_QueueInit() is only reset, memory is owned by caller.
+ *       delete producers and consumers of the queue first.
+ */
+void RTI_QueueDelete(RTI_QUEUE *queue)
+{
+    if (queue == NULL) {
+        return;
+    }
+    if (queue->isShared == false) {
+        RTI_QueueCacheFlush(queue);
+    }
+    if (queue->isHeap == true && queue->isMapped == true) {
+        RTIPriv_OsHugeUnmap(queue, queue->memSize);
+    }
+    else if (queue->isHeap == true) {
+        free(queue);
+    }
+}
+
+/**
+ * @brief Create a producer of the queue.
+ *
+ * @param queue The queue.
+ * @param producerOut Pointer to store the producer.
+ * @return RTI_ERR Error code indicating success or failure.
+ * @note a producer deleted before is reused from the handle cache without allocating.
+ */
+RTI_ERR RTI_QueueProducerCreate(RTI_QUEUE *queue, void **producerOut)
+{
+    if (queue == NULL || producerOut == NULL) {
+        return RTI_ERR_INVALID_PARAM;
+    }
+    bool isReady = false;
+    RTI_QUEUE_PRODUCER *producer = (RTI_QUEUE_PRODUCER *)RTI_QueueHandleAlloc(queue, RTI_QUEUE_HANDLE_PRODUCER, &isReady);
+    if (producer == NULL) {
+        return RTI_ERR_NO_MEMORY;
+    }
+    if (isReady == false) {
+        RTI_QueueProducerReset(queue, producer);
+    }
+    *producerOut = producer;
+    return RTI_OK;
+}
+
+/**
+ * @brief Delete a producer.
+ *
+ * @param producer The producer.
+ */
+void RTI_QueueProducerDelete(void *producer)
+{
+    if (producer == NULL) {
+        return;
+    }
+    RTI_QUEUE_PRODUCER *self = (RTI_QUEUE_PRODUCER *)producer;
+    if (self->flowEnabled == true) {
+        RTI_QueueFlowDetach(self);
+    }
+#if RTI_ENABLE_RATE_LIMIT == 1
+    if (self->divertIfx != NULL) {
+        self->divertIfx->deleteProducerF(self->divertProducer);
+    }
+#endif
+    RTI_QUEUE *queue = self->queue;
+    RTI_QueueProducerReset(queue, self);
+    RTI_QueueHandleRecycle(queue, self, RTI_QUEUE_HANDLE_PRODUCER);
+}
+
+/**
+ * @brief Create a consumer of the queue.
+ *
+ * @param queue The queue.
+ * @param consumerOut Pointer to store the consumer.
+ * @return RTI_ERR Error code indicating success or failure.
+ * @note a consumer deleted before is reused from the handle cache without allocating.
+ */
+RTI_ERR RTI_QueueConsumerCreate(RTI_QUEUE *queue, void **consumerOut)
+{
+    if (queue == NULL || consumerOut == NULL) {
+        return RTI_ERR_INVALID_PARAM;
+    }
+    bool isReady = false;
+    RTI_QUEUE_CONSUMER *consumer = (RTI_QUEUE_CONSUMER *)RTI_QueueHandleAlloc(queue, RTI_QUEUE_HANDLE_CONSUMER, &isReady);
+    if (consumer == NULL) {
+        return RTI_ERR_NO_MEMORY;
+    }
+    if (isReady == false) {
+        RTI_QueueConsumerReset(queue, consumer);
+    }
+    RTI_QueueNumaAuto(queue);
+    *consumerOut = consumer;
+    return RTI_OK;
+}
+
+/**
+ * @brief Delete a consumer.
+ *
+ * @param consumer The consumer.
+ */
+void RTI_QueueConsumerDelete(void *consumer)
+{
+    if (consumer == NULL) {
+        return;
+    }
+    RTI_QUEUE_CONSUMER *self = (RTI_QUEUE_CONSUMER *)consumer;
+    if (self->pollFd >= 0 || self->wakeF != NULL) {
+        RTI_QueuePollDetach(self);
+    }
+    RTI_QUEUE *queue = self->queue;
+    RTI_QueueConsumerReset(queue, self);
+    RTI_QueueHandleRecycle(queue, self, RTI_QUEUE_HANDLE_CONSUMER);
+}
+
+/**
+ * @brief Get a pollable file descriptor of a consumer, for epoll or io_uring.
+ *
+ * @param consumer The consumer.
+ * @return int The file descriptor, -1 if not supported.
+ * @note fd is readable while the queue may have messages, and is cleared
+ *       when a receive of this consumer finds the queue empty,
+ *       so receive until RTI_ERR_QUEUE_EMPTY after each readiness.
+ *       fd is created on first call and owned by the consumer.
+ */
+int RTI_QueueConsumerGetFd(void *consumer)
+{
+    if (consumer == NULL) {
+        return -1;
+    }
+    RTI_QUEUE_CONSUMER *self = (RTI_QUEUE_CONSUMER *)consumer;
+    RTI_QUEUE *queue = self->queue;
+    // poll list lives in process memory, peers of a shared queue cannot see it
+    if (self->pollFd >= 0 || queue->isShared == true || self->wakeF != NULL) {
+        return self->pollFd;
+    }
+    self->pollFd = RTIPriv_OsEventCreate();
+    if (self->pollFd < 0) {
+        return -1;
+    }
+    RTI_QueuePollLock(queue);
+    self->pollNext = queue->pollList;
+    queue->pollList = self;
+    RTI_QueuePollUnlock(queue);
+    RTI_QueuePollArm(self);
+    return self->pollFd;
+}
+
+/**
+ * @brief Arm a one-shot wake of a consumer, called by the next producer publishing a message.
+ *
+ * @param consumer The consumer.
+ * @param wakeF Called once on the producer thread, after the message is published and no lock is held.
+ * @param arg Argument of wakeF.
+ * @return RTI_ERR RTI_OK if armed, RTI_ERR_ALREADY_READY if the queue may have messages now.
+ * @note wakeF may receive right away, so a suspended coroutine is resumed without a thread hop.
+ *       another consumer may take the message first, receive and arm again if it is empty.
+ *       messages of ISR producers do not call wakeF, they are seen on the next one.
+ *       a consumer is either polled by fd or waited by wakeF, not both.
+ */
+RTI_ERR RTI_QueueConsumerWaitArm(void *consumer, RTI_VlanWakeFptr wakeF, void *arg)
+{
+    if (consumer == NULL || wakeF == NULL) {
+        return RTI_ERR_INVALID_PARAM;
+    }
+    RTI_QUEUE_CONSUMER *self = (RTI_QUEUE_CONSUMER *)consumer;
+    RTI_QUEUE *queue = self->queue;
+    if (self->pollFd >= 0 || queue->isShared == true) {
+        return RTI_ERR_NOT_SUPPORTED;
+    }
+    if (atomic_load_explicit(&self->pollArmed, memory_order_relaxed) == true) {
+        return RTI_ERR_INVALID_PARAM;
+    }
+    RTI_QueuePollLock(queue);
+    if (self->wakeF == NULL) {
+        self->pollNext = queue->pollList;
+        queue->pollList = self;
+    }
+    self->wakeF = wakeF;
+    self->wakeArg = arg;
+    RTI_QueuePollUnlock(queue);
+    atomic_store_explicit(&self->pollArmed, true, memory_order_relaxed);
+    atomic_fetch_add_explicit(&queue->pollArmedCnt, 1, memory_order_relaxed);
+    // arm before the last check, pairs with the fence in RTI_QueuePublish()
+    atomic_thread_fence(memory_order_seq_cst);
+    if (atomic_load_explicit(&queue->readyMask, memory_order_relaxed) == 0) {
+        return RTI_OK;
+    }
+    // a producer raced us, unless it already took the wake
+    if (atomic_exchange_explicit(&self->pollArmed, false, memory_order_relaxed) == true) {
+        atomic_fetch_sub_explicit(&queue->pollArmedCnt, 1, memory_order_relaxed);
+        return RTI_ERR_ALREADY_READY;
+    }
+    return RTI_OK;
+}
+
+/**
+ * @brief Arm a one-shot wake of a throttled producer, called by the consumer which resumes it.
+ *
+ * @param producer The producer.
+ * @param wakeF Called once on the consumer thread, after flow lock is released.
+ * @param arg Argument of wakeF.
+ * @return RTI_ERR RTI_OK if armed, RTI_ERR_ALREADY_READY if the producer is not throttled.
+ * @note only producers with flow control can wait, a full lane throttles them too.
+ *       use RTI_VLAN_FLOW_MODE_NONBLOCK, so send returns RTI_ERR_FLOW_THROTTLED instead of sleeping.
+ */
+RTI_ERR RTI_QueueProducerWaitArm(void *producer, RTI_VlanWakeFptr wakeF, void *arg)
+{
+    if (producer == NULL || wakeF == NULL) {
+        return RTI_ERR_INVALID_PARAM;
+    }
+    RTI_QUEUE_PRODUCER *self = (RTI_QUEUE_PRODUCER *)producer;
+    RTI_QUEUE *queue = self->queue;
+    if (self->flowEnabled == false) {
+        return RTI_ERR_NOT_SUPPORTED;
+    }
+    // resume also runs under flow lock, so it either sees the wake or we see it resumed
+    RTI_QueueFlowLock(queue);
+    bool isThrottled = atomic_load_explicit(&self->throttled, memory_order_relaxed);
+    if (isThrottled == true) {
+        self->wakeF = wakeF;
+        self->wakeArg = arg;
+    }
+    RTI_QueueFlowUnlock(queue);
+    return (isThrottled == true) ? RTI_OK : RTI_ERR_ALREADY_READY;
+}
+
+/**
+ * @brief Claim a slot of a lane, by producer flow mode.
+ *
+ * @param producer The producer.
+ * @param size The message size in bytes.
+ * @param lane The lane index, must be valid.
+ * @param buf Pointer to store the claimed buffer.
+ * @return RTI_ERR Error code indicating success or failure.
+ */
+static RTI_ERR RTI_QueueSendClaim(RTI_QUEUE_PRODUCER *producer, size_t size, uint8_t lane, RTI_QUEUE_BUF *buf)
+{
+    RTI_QUEUE *queue = producer->queue;
+    RTI_ERR err;
+    size_t pos = 0;
+    for (;;) {
+        if (producer->flowEnabled == true) {
+            err = RTI_QueueFlowAcquire(producer);
+            if (err != RTI_OK) {
+                return err;
+            }
+        }
+        err = RTI_QueueLaneClaimEnq(queue, &queue->lanes[lane], &pos);
+        if (err != RTI_ERR_QUEUE_FULL || producer->flowEnabled == false) {
+            break;
+        }
+        // a full lane throttles the producer too, so it can wait instead of dropping
+        RTI_QueueFlowThrottle(producer, lane);
+    }
+    if (err != RTI_OK) {
+        return err;
+    }
+    RTI_QUEUE_SLOT *slot = RTI_QUEUE_GET_SLOT(queue, &queue->lanes[lane], pos);
+    slot->owner = producer->owner;
+    buf->data = slot + 1;
+    buf->size = size;
+    buf->lane = lane;
+    buf->pos = pos;
+    return RTI_OK;
+}
+
+/**
+ * @brief Claim a slot in a priority lane to write message in place.
+ *
+ * @param producer The producer.
+ * @param size The message size in bytes.
+ * @param lane The lane index, 0 has the highest priority.
+ * @param buf Pointer to store the claimed buffer.
+ * @return RTI_ERR Error code indicating success or failure.
+ * @note the lane is blocked for consumers until RTI_QueueSendCommit(),
+ *       so write the message and commit it as soon as possible.
+ *       a rate limited queue with DIVERT policy returns RTI_ERR_RATE_LIMITED here,
+ *       a claimed slot can not move to the overflow VLAN, use RTI_QueueSend() to divert.
+ */
+RTI_ERR RTI_QueueSendAcquire(void *producer, size_t size, uint8_t lane, RTI_QUEUE_BUF *buf)
+{
+    if (producer == NULL || buf == NULL) {
+        return RTI_ERR_INVALID_PARAM;
+    }
+    RTI_QUEUE_PRODUCER *self = (RTI_QUEUE_PRODUCER *)producer;
+    RTI_QUEUE *queue = self->queue;
+    if (lane >= queue->cfg.lanes || size > queue->cfg.msgSize) {
+        return RTI_ERR_INVALID_PARAM;
+    }
+#if RTI_ENABLE_RATE_LIMIT == 1
+    if (queue->rateInterval != 0 && RTI_QueueRateAcquire(queue) != RTI_OK) {
+        return RTI_ERR_RATE_LIMITED;
+    }
+#endif
+    return RTI_QueueSendClaim(self, size, lane, buf);
+}
+
+/**
+ * @brief Publish a slot claimed by RTI_QueueSendAcquire() to consumers.
+ *
+ * @param producer The producer.
+ * @param buf The claimed buffer, buf->size may be shrunk before commit.
+ * @return RTI_ERR Error code indicating success or failure.
+ */
+RTI_ERR RTI_QueueSendCommit(void *producer, RTI_QUEUE_BUF *buf)
+{
+    if (producer == NULL || buf == NULL) {
+        return RTI_ERR_INVALID_PARAM;
+    }
+    RTI_QUEUE *queue = ((RTI_QUEUE_PRODUCER *)producer)->queue;
+    RTI_QUEUE_SLOT *slot = RTI_QUEUE_GET_SLOT(queue, &queue->lanes[buf->lane], buf->pos);
+    slot->size = (uint32_t)buf->size;
+    slot->owner = 0;
+    RTI_ERR err = RTI_QueueSlotHandOver(queue, slot, buf->pos, buf->pos + 1);
+    if (err != RTI_OK) {
+        return err;
+    }
+    RTI_QueuePublish(queue, 1u << buf->lane);
+    return RTI_OK;
+}
+
+/**
+ * @brief Send a message to a priority lane.
+ *
+ * @param producer The producer.
+ * @param msg The message.
+ * @param size The message size in bytes.
+ * @param lane The lane index, 0 has the highest priority.
+ * @return RTI_ERR Error code indicating success or failure.
+ */
+RTI_ERR RTI_QueueSend(void *producer, const void *msg, size_t size, uint8_t lane)
+{
+    if (producer == NULL || msg == NULL) {
+        return RTI_ERR_INVALID_PARAM;
+    }
+    RTI_QUEUE_PRODUCER *self = (RTI_QUEUE_PRODUCER *)producer;
+    RTI_QUEUE *queue = self->queue;
+    if (lane >= queue->cfg.lanes || size > queue->cfg.msgSize) {
+        return RTI_ERR_INVALID_PARAM;
+    }
+#if RTI_ENABLE_RATE_LIMIT == 1
+    if (queue->rateInterval != 0 && RTI_QueueRateAcquire(queue) != RTI_OK) {
+        if (queue->ratePolicy == RTI_VLAN_RATE_DIVERT) {
+            return RTI_QueueRateDivert(self, msg, size, lane);
+        }
+        return RTI_ERR_RATE_LIMITED;
+    }
+#endif
+    if (queue->forwardF != NULL) {
+        return queue->forwardF(msg, size, lane, queue->forwardArg);
+    }
+    RTI_QUEUE_BUF buf;
+    RTI_ERR err = RTI_QueueSendClaim(self, size, lane, &buf);
+    if (err != RTI_OK) {
+        return err;
+    }
+    memcpy(buf.data, msg, size);
+    return RTI_QueueSendCommit(producer, &buf);
+}
+
+/**
+ * @brief Create an ISR producer of the queue, with a preallocated mailbox.
+ *
+ * @param queue The queue.
+ * @param depth Mailbox slot count, must be power of 2.
+ * @param producerOut Pointer to store the producer.
+ * @return RTI_ERR Error code indicating success or failure.
+ * @note create and delete it in thread context. one ISR producer is used by
+ *       one interrupt or signal handler only, nesting handlers need their own.
+ */
+RTI_ERR RTI_QueueIsrProducerCreate(RTI_QUEUE *queue, uint32_t depth, void **producerOut)
+{
+    if (queue == NULL || producerOut == NULL || depth == 0 || (depth & (depth - 1)) != 0) {
+        return RTI_ERR_INVALID_PARAM;
+    }
+    // mailbox list lives in process memory, peers of a shared queue cannot see it
+    if (queue->isShared == true) {
+        return RTI_ERR_NOT_SUPPORTED;
+    }
+    size_t stride = RTI_QUEUE_ALIGN_UP(sizeof(RTI_QUEUE_ISR_SLOT) + queue->cfg.msgSize, sizeof(RTI_QUEUE_ISR_SLOT));
+    size_t sizeBytes = RTI_QUEUE_ALIGN_UP(sizeof(RTI_QUEUE_ISR) + depth * stride, RTI_CACHELINE_SIZE);
+    RTI_QUEUE_ISR *isr = (RTI_QUEUE_ISR *)aligned_alloc(RTI_CACHELINE_SIZE, sizeBytes);
+    if (isr == NULL) {
+        return RTI_ERR_NO_MEMORY;
+    }
+    // an interrupt should not be the first to touch a mailbox page
+    if ((queue->cfg.memFlags & RTI_QUEUE_MEM_PREFAULT) != 0) {
+        RTIPriv_OsMemPrefault(isr, sizeBytes);
+    }
+    isr->queue = queue;
+    isr->posMask = depth - 1;
+    isr->slotStride = stride;
+    atomic_init(&isr->tail, 0);
+    atomic_init(&isr->head, 0);
+    while (atomic_flag_test_and_set_explicit(&queue->isrLock, memory_order_acquire)) {
+        RTI_OS_CPU_RELAX();
+    }
+    isr->next = queue->isrList;
+    queue->isrList = isr;
+    atomic_flag_clear_explicit(&queue->isrLock, memory_order_release);
+    *producerOut = isr;
+    return RTI_OK;
+}
+
+/**
+ * @brief Delete an ISR producer, messages left in its mailbox are dropped.
+ *
+ * @param producer The ISR producer.
+ * @note disable its interrupt or signal handler first.
+ */
+void RTI_QueueIsrProducerDelete(void *producer)
+{
+    if (producer == NULL) {
+        return;
+    }
+    RTI_QUEUE_ISR *isr = (RTI_QUEUE_ISR *)producer;
+    RTI_QUEUE *queue = isr->queue;
+    while (atomic_flag_test_and_set_explicit(&queue->isrLock, memory_order_acquire)) {
+        RTI_OS_CPU_RELAX();
+    }
+    RTI_QUEUE_ISR **itr = &queue->isrList;
+    while (*itr != NULL && *itr != isr) {
+        itr = &(*itr)->next;
+    }
+    if (*itr == isr) {
+        *itr = isr->next;
+    }
+    atomic_flag_clear_explicit(&queue->isrLock, memory_order_release);
+    free(isr);
+}
+
+/**
+ * @brief Send a message from interrupt or signal handler, wait-free and async-signal-safe.
+ *
+ * @param producer The ISR producer.
+ * @param msg The message.
+ * @param size The message size in bytes.
+ * @param lane The lane index, 0 has the highest priority.
+ * @return RTI_ERR RTI_ERR_QUEUE_FULL if the mailbox is full.
+ * @note it never locks, allocates or retries: one copy into a preallocated mailbox slot,
+ *       one release store and one atomic OR, plus a futex wake when a consumer is parked.
+ *       flow control, rate limit and forwarding do not apply, and messages are ordered
+ *       with other producers only after consumers move them into their lane.
+ *       errno is left as the interrupted code had it.
+ */
+RTI_ERR RTI_QueueSendIsr(void *producer, const void *msg, size_t size, uint8_t lane)
+{
+    int savedErrno = errno;
+    if (producer == NULL || msg == NULL) {
+        errno = savedErrno;
+        return RTI_ERR_INVALID_PARAM;
+    }
+    RTI_QUEUE_ISR *isr = (RTI_QUEUE_ISR *)producer;
+    RTI_QUEUE *queue = isr->queue;
+    if (lane >= queue->cfg.lanes || size > queue->cfg.msgSize) {
+        errno = savedErrno;
+        return RTI_ERR_INVALID_PARAM;
+    }
+    size_t tail = atomic_load_explicit(&isr->tail, memory_order_relaxed);
+    if (tail - atomic_load_explicit(&isr->head, memory_order_acquire) > isr->posMask) {
+        errno = savedErrno;
+        return RTI_ERR_QUEUE_FULL;
+    }
+    RTI_QUEUE_ISR_SLOT *slot = RTI_QUEUE_GET_ISR_SLOT(isr, tail);
+    memcpy(slot + 1, msg, size);
+    slot->size = (uint32_t)size;
+    slot->lane = lane;
+    atomic_store_explicit(&isr->tail, tail + 1, memory_order_release);
+    RTI_QueuePublishIsr(queue);
+    errno = savedErrno;
+    return RTI_OK;
+}
+
+/**
+ * @brief Claim the next message by the queue dequeue policy.
+ *
+ * @param consumer The consumer.
+ * @param capacity [in] buffer size of consumer, [out] message size if it is larger.
+ * @param buf Pointer to store the claimed buffer.
+ * @return RTI_ERR Error code indicating success or failure.
+ */
+static RTI_ERR RTI_QueueRecvClaim(RTI_QUEUE_CONSUMER *consumer, size_t *capacity, RTI_QUEUE_BUF *buf)
+{
+    RTI_QUEUE *queue = consumer->queue;
+    for (;;) {
+        unsigned ready = atomic_load_explicit(&queue->readyMask, memory_order_acquire);
+        if ((ready & RTI_QUEUE_READY_ISR) != 0) {
+            RTI_QueueIsrDrain(queue);
+            ready = atomic_load_explicit(&queue->readyMask, memory_order_acquire) & ~RTI_QUEUE_READY_ISR;
+        }
+        if (ready == 0) {
+            if (consumer->pollFd >= 0) {
+                RTI_QueuePollArm(consumer);
+            }
+            RTI_QueueFlowWake(consumer->flowWake);
+            consumer->flowWake = NULL;
+            return RTI_ERR_QUEUE_EMPTY;
+        }
+        uint8_t laneIdx = RTI_QueuePickLane(consumer, ready);
+        RTI_QUEUE_LANE *lane = &queue->lanes[laneIdx];
+        size_t pos = 0;
+        RTI_ERR err = RTI_QueueLaneClaimDeq(queue, lane, capacity, &pos);
+        if (err == RTI_OK) {
+            RTI_QUEUE_SLOT *slot = RTI_QUEUE_GET_SLOT(queue, lane, pos);
+            if (atomic_load_explicit(&queue->throttledCnt, memory_order_seq_cst) != 0) {
+                RTI_QueueFlowResume(queue, &consumer->flowWake);
+            }
+            // message of a dead producer, skip it
+            if (slot->size == RTI_QUEUE_SLOT_DROPPED) {
+                RTI_QueueSlotHandOver(queue, slot, pos + 1, pos + queue->posMask + 1);
+                RTI_QueueFlowRelease(queue, &consumer->flowWake);
+                continue;
+            }
+            if (consumer->wrrCredit > 0) {
+                consumer->wrrCredit--;
+            }
+            slot->owner = consumer->owner;
+            buf->data = slot + 1;
+            buf->size = slot->size;
+            buf->lane = laneIdx;
+            buf->pos = pos;
+            return RTI_OK;
+        }
+        if (err != RTI_ERR_QUEUE_EMPTY) {
+            RTI_QueueFlowWake(consumer->flowWake);
+            consumer->flowWake = NULL;
+            return err;
+        }
+        // lane drained, clear its bit and re-arm if a producer raced us
+        unsigned bit = 1u << laneIdx;
+        atomic_fetch_and_explicit(&queue->readyMask, ~bit, memory_order_seq_cst);
+        atomic_thread_fence(memory_order_seq_cst);
+        if (RTI_QueueLaneIsEmpty(queue, lane) == false) {
+            atomic_fetch_or_explicit(&queue->readyMask, bit, memory_order_release);
+        }
+    }
+}
+
+/**
+ * @brief Claim the next message, spin and then park if the queue is empty.
+ *
+ * @param consumer The consumer.
+ * @param capacity [in] buffer size of consumer, [out] message size if it is larger.
+ * @param buf Pointer to store the claimed buffer.
+ * @param timeoutMs Max time to wait in milliseconds, negative means forever.
+ * @return RTI_ERR RTI_ERR_QUEUE_EMPTY if timed out.
+ */
+static RTI_ERR RTI_QueueRecvPark(RTI_QUEUE_CONSUMER *consumer, size_t *capacity, RTI_QUEUE_BUF *buf, int32_t timeoutMs)
+{
+    RTI_QUEUE *queue = consumer->queue;
+    RTI_ERR err = RTI_QueueRecvClaim(consumer, capacity, buf);
+    if (err != RTI_ERR_QUEUE_EMPTY || timeoutMs == 0) {
+        return err;
+    }
+    // producer is often right behind, a short spin saves the syscalls
+    for (uint32_t i = 0; i < RTI_QUEUE_WAIT_SPIN; i++) {
+        RTI_OS_CPU_RELAX();
+        if (atomic_load_explicit(&queue->readyMask, memory_order_relaxed) != 0) {
+            err = RTI_QueueRecvClaim(consumer, capacity, buf);
+            if (err != RTI_ERR_QUEUE_EMPTY) {
+                return err;
+            }
+        }
+    }
+    int64_t deadline = RTIPriv_OsNowMs() + timeoutMs;
+    for (;;) {
+        int32_t remain = -1;
+        if (timeoutMs > 0) {
+            int64_t left = deadline - RTIPriv_OsNowMs();
+            if (left <= 0) {
+                return RTI_ERR_QUEUE_EMPTY;
+            }
+            remain = (int32_t)left;
+        }
+        unsigned seq = atomic_load_explicit(&queue->wakeSeq, memory_order_acquire);
+        atomic_fetch_add_explicit(&queue->parkedCnt, 1, memory_order_relaxed);
+        // announce parking before the last check, pairs with the fence in RTI_QueueSendCommit()
+        atomic_thread_fence(memory_order_seq_cst);
+        err = RTI_QueueRecvClaim(consumer, capacity, buf);
+        if (err == RTI_ERR_QUEUE_EMPTY) {
+            err = RTIPriv_OsWait(&queue->wakeSeq, seq, queue->isShared, remain);
+            err = (err == RTI_OK) ? RTI_ERR_QUEUE_EMPTY : err;
+        }
+        atomic_fetch_sub_explicit(&queue->parkedCnt, 1, memory_order_relaxed);
+        if (err != RTI_ERR_QUEUE_EMPTY) {
+            return err;
+        }
+    }
+}
+
+/**
+ * @brief Claim the next message to read it in place.
+ *
+ * @param consumer The consumer.
+ * @param buf Pointer to store the claimed buffer.
+ * @return RTI_ERR Error code indicating success or failure.
+ * @note the slot is not reusable by producers until RTI_QueueRecvRelease().
+ */
+RTI_ERR RTI_QueueRecvAcquire(void *consumer, RTI_QUEUE_BUF *buf)
+{
+    if (consumer == NULL || buf == NULL) {
+        return RTI_ERR_INVALID_PARAM;
+    }
+    size_t capacity = SIZE_MAX;
+    return RTI_QueueRecvClaim((RTI_QUEUE_CONSUMER *)consumer, &capacity, buf);
+}
+
+/**
+ * @brief Give a slot claimed by RTI_QueueRecvAcquire() back to producers.
+ *
+ * @param consumer The consumer.
+ * @param buf The claimed buffer.
+ * @return RTI_ERR Error code indicating success or failure.
+ */
+RTI_ERR RTI_QueueRecvRelease(void *consumer, RTI_QUEUE_BUF *buf)
+{
+    if (consumer == NULL || buf == NULL) {
+        return RTI_ERR_INVALID_PARAM;
+    }
+    RTI_QUEUE_CONSUMER *self = (RTI_QUEUE_CONSUMER *)consumer;
+    RTI_QUEUE *queue = self->queue;
+    RTI_QUEUE_SLOT *slot = RTI_QUEUE_GET_SLOT(queue, &queue->lanes[buf->lane], buf->pos);
+    slot->owner = 0;
+    RTI_ERR err = RTI_QueueSlotHandOver(queue, slot, buf->pos + 1, buf->pos + queue->posMask + 1);
+    RTI_QueueFlowRelease(queue, &self->flowWake);
+    if (self->flowWake != NULL) {
+        RTI_QUEUE_PRODUCER *wakeList = self->flowWake;
+        self->flowWake = NULL;
+        RTI_QueueFlowWake(wakeList);
+    }
+    return err;
+}
+
+/**
+ * @brief Receive a message by the queue dequeue policy.
+ *
+ * @param consumer The consumer.
+ * @param msg Buffer to store the message.
+ * @param size [in] buffer size, [out] message size.
+ * @return RTI_ERR Error code indicating success or failure.
+ * @note the message stays in the queue if buffer is too small,
+ *       and size is set to the message size.
+ */
+RTI_ERR RTI_QueueRecv(void *consumer, void *msg, size_t *size)
+{
+    if (consumer == NULL || msg == NULL || size == NULL) {
+        return RTI_ERR_INVALID_PARAM;
+    }
+    RTI_QUEUE_BUF buf;
+    RTI_ERR err = RTI_QueueRecvClaim((RTI_QUEUE_CONSUMER *)consumer, size, &buf);
+    if (err != RTI_OK) {
+        return err;
+    }
+    memcpy(msg, buf.data, buf.size);
+    *size = buf.size;
+    return RTI_QueueRecvRelease(consumer, &buf);
+}
+
+/**
+ * @brief Claim the next message to read it in place, wait if the queue is empty.
+ *
+ * @param consumer The consumer.
+ * @param buf Pointer to store the claimed buffer.
+ * @param timeoutMs Max time to wait in milliseconds, 0 never waits, negative waits forever.
+ * @return RTI_ERR RTI_ERR_QUEUE_EMPTY if timed out.
+ * @note the slot is not reusable by producers until RTI_QueueRecvRelease().
+ */
+RTI_ERR RTI_QueueRecvAcquireWait(void *consumer, RTI_QUEUE_BUF *buf, int32_t timeoutMs)
+{
+    if (consumer == NULL || buf == NULL) {
+        return RTI_ERR_INVALID_PARAM;
+    }
+    if (timeoutMs != 0 && RTI_ENABLE_OS_WAIT == 0) {
+        return RTI_ERR_NOT_SUPPORTED;
+    }
+    size_t capacity = SIZE_MAX;
+    return RTI_QueueRecvPark((RTI_QUEUE_CONSUMER *)consumer, &capacity, buf, timeoutMs);
+}
+
+/**
+ * @brief Receive a message, wait if the queue is empty.
+ *
+ * @param consumer The consumer.
+ * @param msg Buffer to store the message.
+ * @param size [in] buffer size, [out] message size.
+ * @param timeoutMs Max time to wait in milliseconds, 0 never waits, negative waits forever.
+ * @return RTI_ERR RTI_ERR_QUEUE_EMPTY if timed out.
+ * @note consumer spins RTI_QUEUE_WAIT_SPIN polls before parking,
+ *       producers only wake the OS when some consumer is parked.
+ */
+RTI_ERR RTI_QueueRecvWait(void *consumer, void *msg, size_t *size, int32_t timeoutMs)
+{
+    if (consumer == NULL || msg == NULL || size == NULL) {
+        return RTI_ERR_INVALID_PARAM;
+    }
+    if (timeoutMs != 0 && RTI_ENABLE_OS_WAIT == 0) {
+        return RTI_ERR_NOT_SUPPORTED;
+    }
+    RTI_QUEUE_BUF buf;
+    RTI_ERR err = RTI_QueueRecvPark((RTI_QUEUE_CONSUMER *)consumer, size, &buf, timeoutMs);
+    if (err != RTI_OK) {
+        return err;
+    }
+    memcpy(msg, buf.data, buf.size);
+    *size = buf.size;
+    return RTI_QueueRecvRelease(consumer, &buf);
+}
+
+/**
+ * @brief Set flow control of a producer.
+ *
+ * @param producer The producer.
+ * @param cfg The flow control configuration, NULL to disable flow control.
+ * @return RTI_ERR Error code indicating success or failure.
+ */
+RTI_ERR RTI_QueueFlowSet(void *producer, const RTI_VLAN_FLOW_CFG *cfg)
+{
+    if (producer == NULL) {
+        return RTI_ERR_INVALID_PARAM;
+    }
+    RTI_QUEUE_PRODUCER *self = (RTI_QUEUE_PRODUCER *)producer;
+    RTI_QUEUE *queue = self->queue;
+    // flow list lives in process memory, peers of a shared queue cannot see it,
+    // and forwarded sends never pass the flow check
+    if (queue->isShared == true || (cfg != NULL && queue->forwardF != NULL)) {
+        return RTI_ERR_NOT_SUPPORTED;
+    }
+    if (self->flowEnabled == true) {
+        RTI_QueueFlowDetach(self);
+    }
+    if (cfg == NULL) {
+        return RTI_OK;
+    }
+    RTI_VLAN_FLOW_CFG flow = *cfg;
+    if (flow.highWatermark == 0 || flow.highWatermark > RTI_QueueCapacity(queue)) {
+        flow.highWatermark = RTI_QueueCapacity(queue);
+    }
+    if (flow.lowWatermark >= flow.highWatermark || flow.mode > RTI_VLAN_FLOW_MODE_CALLBACK) {
+        return RTI_ERR_INVALID_PARAM;
+    }
+    if (flow.mode == RTI_VLAN_FLOW_MODE_BLOCK && RTI_ENABLE_OS_WAIT == 0) {
+        return RTI_ERR_NOT_SUPPORTED;
+    }
+    self->flow = flow;
+    RTI_QueueFlowLock(queue);
+    self->flowNext = queue->flowList;
+    queue->flowList = self;
+    self->flowEnabled = true;
+    RTI_QueueFlowUnlock(queue);
+    return RTI_OK;
+}
+
+/**
+ * @brief Get flow control status of a producer.
+ *
+ * @param producer The producer.
+ * @param flow Pointer to store the flow status.
+ * @return RTI_ERR Error code indicating success or failure.
+ */
+RTI_ERR RTI_QueueFlowGet(void *producer, RTI_VLAN_FLOW *flow)
+{
+    if (producer == NULL || flow == NULL) {
+        return RTI_ERR_INVALID_PARAM;
+    }
+    RTI_QUEUE_PRODUCER *self = (RTI_QUEUE_PRODUCER *)producer;
+    uint32_t capacity = RTI_QueueCapacity(self->queue);
+    uint32_t high = (self->flowEnabled == true) ? self->flow.highWatermark : capacity;
+    uint32_t used = RTIPriv_QueueUsed(self->queue);
+    flow->capacity = capacity;
+    if (atomic_load_explicit(&self->throttled, memory_order_relaxed) == true) {
+        flow->state = RTI_VLAN_FLOW_THROTTLED;
+        flow->credits = 0;
+    }
+    else {
+        flow->state = RTI_VLAN_FLOW_OPEN;
+        flow->credits = (used < high) ? (high - used) : 0;
+    }
+    return RTI_OK;
+}
+
+/**
+ * @brief Set rate limit of a queue, shared by all producers of the queue.
+ *
+ * @param queue The queue.
+ * @param cfg The rate limit configuration, NULL or rate 0 to remove the limit.
+ * @return RTI_ERR Error code indicating success or failure.
+ * @note the bucket starts full. set it before producers start sending,
+ *       the limiter state is kept in the queue so peers of a shared queue share it.
+ */
+RTI_ERR RTI_QueueRateSet(RTI_QUEUE *queue, const RTI_VLAN_RATE_CFG *cfg)
+{
+    if (queue == NULL) {
+        return RTI_ERR_INVALID_PARAM;
+    }
+#if RTI_ENABLE_RATE_LIMIT == 1
+    if (cfg == NULL || cfg->rate == 0) {
+        queue->rateInterval = 0;
+        return RTI_OK;
+    }
+    if (cfg->rate > 1000000000u || cfg->policy > RTI_VLAN_RATE_DIVERT) {
+        return RTI_ERR_INVALID_PARAM;
+    }
+    uint64_t burst = (cfg->burst == 0) ? 1 : cfg->burst;
+    queue->ratePolicy = cfg->policy;
+    queue->rateOverflow = cfg->overflowVlan;
+    queue->rateBurst = (1000000000u / cfg->rate) * burst;
+    atomic_store_explicit(&queue->rateTat, 0, memory_order_relaxed);
+    queue->rateInterval = 1000000000u / cfg->rate;
+    return RTI_OK;
+#else
+    return (cfg == NULL || cfg->rate == 0) ? RTI_OK : RTI_ERR_NOT_SUPPORTED;
+#endif
+}
+
+/**
+ * @brief Forward sends of a queue to a function instead of enqueuing them.
+ *
+ * @param queue The queue.
+ * @param forwardF Called by RTI_QueueSend() in producer context, NULL to enqueue again.
+ * @param arg Argument of forwardF.
+ * @return RTI_ERR Error code indicating success or failure.
+ * @note only RTI_QueueSend() is forwarded, slots claimed by RTI_QueueSendAcquire()
+ *       are still enqueued. set it while no producer of the queue is sending.
+ */
+RTI_ERR RTI_QueueForwardSet(RTI_QUEUE *queue, RTI_QueueForwardFptr forwardF, void *arg)
+{
+    if (queue == NULL) {
+        return RTI_ERR_INVALID_PARAM;
+    }
+    // function pointers are only valid in this process
+    if (queue->isShared == true) {
+        return RTI_ERR_NOT_SUPPORTED;
+    }
+    queue->forwardArg = arg;
+    queue->forwardF = forwardF;
+    return RTI_OK;
+}
+
+/**
+ * @brief Allocate producers and consumers of a queue from caller provided memory.
+ *
+ * @param queue The queue.
+ * @param mem Pool memory, NULL to allocate handles on heap again.
+ * @param sizeBytes Pool memory size in bytes, see RTI_QUEUE_POOL_SIZE().
+ * @return RTI_ERR RTI_ERR_FAILED if handles of the current pool are alive.
+ * @note handles created before keep their memory. with a pool,
+ *       creating a handle returns RTI_ERR_NO_MEMORY when the pool is exhausted.
+ */
+RTI_ERR RTI_QueuePoolSet(RTI_QUEUE *queue, void *mem, size_t sizeBytes)
+{
+    if (queue == NULL || (mem != NULL && sizeBytes < RTI_QUEUE_HANDLE_SIZE)) {
+        return RTI_ERR_INVALID_PARAM;
+    }
+    // every pool node has to fit in the handle cache
+    if (mem != NULL && sizeBytes / RTI_QUEUE_HANDLE_SIZE > RTI_QUEUE_HANDLE_CACHE) {
+        return RTI_ERR_INVALID_PARAM;
+    }
+    // pool lives in process memory, peers of a shared queue cannot see it
+    if (queue->isShared == true) {
+        return RTI_ERR_NOT_SUPPORTED;
+    }
+    // a pool node missing from the cache is an alive handle
+    size_t cached = atomic_load_explicit(&queue->cacheEnq, memory_order_acquire) -
+                    atomic_load_explicit(&queue->cacheDeq, memory_order_acquire);
+    if (queue->pool != NULL && cached != queue->poolCnt) {
+        return RTI_ERR_FAILED;
+    }
+    RTI_QueueCacheFlush(queue);
+    queue->pool = (uint8_t *)mem;
+    queue->poolCnt = (mem == NULL) ? 0 : (uint32_t)(sizeBytes / RTI_QUEUE_HANDLE_SIZE);
+    for (uint32_t i = 0; i < queue->poolCnt; i++) {
+        RTI_QueueCachePush(queue, queue->pool + RTI_QUEUE_POOL_SIZE(i), RTI_QUEUE_HANDLE_RAW);
+    }
+    int node = atomic_load_explicit(&queue->numaNode, memory_order_relaxed);
+    if (queue->pool != NULL && node >= 0) {
+        RTIPriv_OsMemBind(queue->pool, RTI_QUEUE_POOL_SIZE(queue->poolCnt), node);
+    }
+    if (queue->pool != NULL && (queue->cfg.memFlags & RTI_QUEUE_MEM_PREFAULT) != 0) {
+        RTIPriv_OsMemPrefault(queue->pool, RTI_QUEUE_POOL_SIZE(queue->poolCnt));
+    }
+    return RTI_OK;
+}
+
+/**
+ * @brief Move ring and handle pool of a queue to a NUMA node.
+ *
+ * @param queue The queue.
+ * @param node The node.
+ * @return RTI_ERR RTI_ERR_NOT_SUPPORTED if kernel or config has no NUMA policy.
+ * @note pages already touched are migrated, messages in the queue stay valid.
+ *       producers and consumers on heap are placed by first touch of their creator.
+ */
+RTI_ERR RTI_QueueNumaBind(RTI_QUEUE *queue, int node)
+{
+    if (queue == NULL || node < 0) {
+        return RTI_ERR_INVALID_PARAM;
+    }
+    RTI_ERR err = RTI_QueueNumaMove(queue, node);
+    if (err == RTI_OK) {
+        atomic_store_explicit(&queue->numaNode, node, memory_order_relaxed);
+    }
+    return err;
+}
+
+/**
+ * @brief Get the NUMA node a queue is bound to.
+ *
+ * @param queue The queue.
+ * @return int The node, -1 if not bound.
+ * @note this function is only for RTI internal use.
+ */
+int RTIPriv_QueueNumaNode(RTI_QUEUE *queue)
+{
+    int node = atomic_load_explicit(&queue->numaNode, memory_order_relaxed);
+    return (node >= 0) ? node : -1;
+}
+
+/**
+ * @brief Get the pages backing a queue.
+ *
+ * @param queue The queue.
+ * @return uint8_t RTI_QUEUE_PAGE_xxx, THP means transparent huge pages were advised.
+ * @note this function is only for RTI internal use.
+ */
+uint8_t RTIPriv_QueuePageKind(RTI_QUEUE *queue)
+{
+    return queue->pageKind;
+}
+
+/**
+ * @brief Check if sends of a queue pass flow control or rate limit.
+ *
+ * @param queue The queue.
+ * @return true A producer has flow control, or the queue is rate limited.
+ * @note this function is only for RTI internal use.
+ */
+bool RTIPriv_QueueHasPolicy(RTI_QUEUE *queue)
+{
+    RTI_QueueFlowLock(queue);
+    bool hasPolicy = (queue->flowList != NULL);
+    RTI_QueueFlowUnlock(queue);
+#if RTI_ENABLE_RATE_LIMIT == 1
+    hasPolicy = hasPolicy || (queue->rateInterval != 0);
+#endif
+    return hasPolicy;
+}
+
+/**
+ * @brief Mark a queue as shared between processes.
+ *
+ * @param queue The queue.
+ * @note this function is only for RTI internal use.
+ */
+void RTIPriv_QueueSetShared(RTI_QUEUE *queue)
+{
+    queue->isShared = true;
+}
+
+/**
+ * @brief Set the owner stamped on slots held by a producer or consumer.
+ *
+ * @param handle The producer or consumer.
+ * @param isProducer true if handle is a producer.
+ * @param owner Owner ID, must not be 0.
+ * @note this function is only for RTI internal use.
+ */
+void RTIPriv_QueueSetOwner(void *handle, bool isProducer, uint32_t owner)
+{
+    if (isProducer == true) {
+        ((RTI_QUEUE_PRODUCER *)handle)->owner = owner;
+    }
+    else {
+        ((RTI_QUEUE_CONSUMER *)handle)->owner = owner;
+    }
+}
+
+/**
+ * @brief Get the queue of a producer or consumer.
+ *
+ * @param handle The producer or consumer.
+ * @param isProducer true if handle is a producer.
+ * @return RTI_QUEUE* The queue.
+ * @note this function is only for RTI internal use.
+ */
+RTI_QUEUE *RTIPriv_QueueGet(void *handle, bool isProducer)
+{
+    if (isProducer == true) {
+        return ((RTI_QUEUE_PRODUCER *)handle)->queue;
+    }
+    return ((RTI_QUEUE_CONSUMER *)handle)->queue;
+}
+
+/**
+ * @brief Recover slots held by dead owners.
+ *
+ * @param queue The queue, must be shared.
+ * @param isDeadF Callback to check if an owner is dead.
+ * @param arg Argument of isDeadF.
+ * @param dropUnknown true to also recover slots claimed but not stamped yet.
+ * @return uint32_t Count of recovered slots.
+ * @note unfinished messages of dead producers are dropped,
+ *       messages held by dead consumers are given back to producers.
+ *       this function is only for RTI internal use.
+ */
+uint32_t RTIPriv_QueueRecover(RTI_QUEUE *queue, RTI_QueueOwnerDeadFptr isDeadF, void *arg, bool dropUnknown)
+{
+    uint32_t recovered = 0;
+    for (uint8_t i = 0; i < queue->cfg.lanes; i++) {
+        RTI_QUEUE_LANE *lane = &queue->lanes[i];
+        size_t deq = atomic_load_explicit(&lane->deqPos, memory_order_acquire);
+        size_t enq = atomic_load_explicit(&lane->enqPos, memory_order_acquire);
+        size_t pos = (deq > queue->cfg.depth) ? (deq - queue->cfg.depth) : 0;
+        for (; pos < enq; pos++) {
+            RTI_QUEUE_SLOT *slot = RTI_QUEUE_GET_SLOT(queue, lane, pos);
+            size_t seq = atomic_load_explicit(&slot->seq, memory_order_acquire);
+            bool heldByProducer = (pos >= deq && seq == pos);
+            bool heldByConsumer = (pos < deq && seq == pos + 1);
+            if (heldByProducer == false && heldByConsumer == false) {
+                continue;
+            }
+            uint32_t owner = slot->owner;
+            if ((owner == 0 && dropUnknown == false) || (owner != 0 && isDeadF(owner, arg) == false)) {
+                continue;
+            }
+            if (heldByProducer == true) {
+                slot->size = RTI_QUEUE_SLOT_DROPPED;
+                slot->owner = 0;
+                if (RTI_QueueSlotHandOver(queue, slot, pos, pos + 1) == RTI_OK) {
+                    atomic_fetch_or_explicit(&queue->readyMask, 1u << i, memory_order_release);
+                    recovered++;
+                }
+            }
+            else {
+                slot->owner = 0;
+                if (RTI_QueueSlotHandOver(queue, slot, pos + 1, pos + queue->posMask + 1) == RTI_OK) {
+                    recovered++;
+                }
+            }
+        }
+    }
+    return recovered;
+}
+
+/**
+ * @brief Instantiate the queue of an interface, called once under the lazy lock.
+ *
+ * @param arg The queue interface.
+ * @return void* The queue, NULL if failed.
+ * @note a queue with storage is initialized in place and never allocates.
+ */
+static void *RTI_QueueIfxInstantiate(void *arg)
+{
+    RTI_QUEUE_IFX *ifx = (RTI_QUEUE_IFX *)arg;
+    const RTI_QUEUE_STORAGE *storage = ifx->opts.storage;
+    RTI_QUEUE_CFG cfg = ifx->cfg;
+    cfg.memFlags = ifx->opts.memFlags;
+    cfg.numaNode = ifx->opts.numaNode;
+    RTI_ERR err = RTI_OK;
+    if (storage == NULL) {
+        err = RTI_QueueCreate(&cfg, &ifx->queue);
+    }
+    else {
+        err = RTI_QueueInit(storage->mem, storage->memSize, &cfg, &ifx->queue);
+        if (err == RTI_OK && storage->pool != NULL) {
+            err = RTI_QueuePoolSet(ifx->queue, storage->pool, storage->poolSize);
+        }
+    }
+    if (err != RTI_OK) {
+        ifx->queue = NULL;
+        return NULL;
+    }
+    // a limit that can not be applied fails the VLAN instead of silently not limiting it
+    if (RTI_QueueRateSet(ifx->queue, ifx->opts.rate) != RTI_OK) {
+        RTI_QueueDelete(ifx->queue);
+        ifx->queue = NULL;
+    }
+    return ifx->queue;
+}
+
+/**
+ * @brief Release the queue of an interface, called under the lazy lock.
+ *
+ * @param arg The queue interface.
+ * @param vlan The queue.
+ */
+static void RTI_QueueIfxRelease(void *arg, void *vlan)
+{
+    RTI_QUEUE_IFX *ifx = (RTI_QUEUE_IFX *)arg;
+    RTI_QueueDelete((RTI_QUEUE *)vlan);
+    ifx->queue = NULL;
+}
+
+/**
+ * @brief createF of RTI_QUEUE_IFX_DEFINE, create the queue once.
+ *
+ * @param ifx The queue interface.
+ * @return void* The queue, NULL if failed.
+ * @note a queue created by createF is kept until deleteF, whatever the idle policy.
+ *       this function is only for RTI internal use.
+ */
+void *RTI_QueueIfxCreate(RTI_QUEUE_IFX *ifx)
+{
+    return RTIPriv_VlanPin(&ifx->ifx, RTI_QueueIfxInstantiate, ifx);
+}
+
+/**
+ * @brief deleteF of RTI_QUEUE_IFX_DEFINE.
+ *
+ * @param ifx The queue interface.
+ * @param vlan The queue returned by createF.
+ * @note this function is only for RTI internal use.
+ */
+void RTI_QueueIfxDelete(RTI_QUEUE_IFX *ifx, void *vlan)
+{
+    RTIPriv_VlanUnpin(&ifx->ifx, vlan, RTI_QueueIfxRelease, ifx);
+}
+
+/**
+ * @brief createProducerF of RTI_QUEUE_IFX_DEFINE, the first handle creates the queue.
+ *
+ * @param ifx The queue interface.
+ * @return void* The producer, NULL if failed.
+ * @note this function is only for RTI internal use.
+ */
+void *RTI_QueueIfxCreateProducer(RTI_QUEUE_IFX *ifx)
+{
+    RTI_QUEUE *queue = (RTI_QUEUE *)RTIPriv_VlanAttach(&ifx->ifx, RTI_QueueIfxInstantiate, ifx);
+    void *producer = NULL;
+    if (queue == NULL) {
+        return NULL;
+    }
+    if (RTI_QueueProducerCreate(queue, &producer) != RTI_OK) {
+        RTIPriv_VlanDetach(&ifx->ifx, RTI_QueueIfxRelease, ifx);
+        return NULL;
+    }
+    return producer;
+}
+
+/**
+ * @brief deleteProducerF of RTI_QUEUE_IFX_DEFINE, the last handle applies idle policy.
+ *
+ * @param ifx The queue interface.
+ * @param producer The producer.
+ * @note this function is only for RTI internal use.
+ */
+void RTI_QueueIfxDeleteProducer(RTI_QUEUE_IFX *ifx, void *producer)
+{
+    if (producer == NULL) {
+        return;
+    }
+    RTI_QueueProducerDelete(producer);
+    RTIPriv_VlanDetach(&ifx->ifx, RTI_QueueIfxRelease, ifx);
+}
+
+/**
+ * @brief createIsrProducerF of RTI_QUEUE_IFX_DEFINE, mailbox is as deep as a lane.
+ *
+ * @param ifx The queue interface.
+ * @return void* The ISR producer, NULL if failed.
+ * @note this function is only for RTI internal use.
+ */
+void *RTI_QueueIfxCreateIsrProducer(RTI_QUEUE_IFX *ifx)
+{
+    RTI_QUEUE *queue = (RTI_QUEUE *)RTIPriv_VlanAttach(&ifx->ifx, RTI_QueueIfxInstantiate, ifx);
+    void *producer = NULL;
+    if (queue == NULL) {
+        return NULL;
+    }
+    if (RTI_QueueIsrProducerCreate(queue, ifx->cfg.depth, &producer) != RTI_OK) {
+        RTIPriv_VlanDetach(&ifx->ifx, RTI_QueueIfxRelease, ifx);
+        return NULL;
+    }
+    return producer;
+}
+
+/**
+ * @brief deleteIsrProducerF of RTI_QUEUE_IFX_DEFINE.
+ *
+ * @param ifx The queue interface.
+ * @param producer The ISR producer.
+ * @note this function is only for RTI internal use, not from an ISR.
+ */
+void RTI_QueueIfxDeleteIsrProducer(RTI_QUEUE_IFX *ifx, void *producer)
+{
+    if (producer == NULL) {
+        return;
+    }
+    RTI_QueueIsrProducerDelete(producer);
+    RTIPriv_VlanDetach(&ifx->ifx, RTI_QueueIfxRelease, ifx);
+}
+
+/**
+ * @brief createConsumerF of RTI_QUEUE_IFX_DEFINE, the first handle creates the queue.
+ *
+ * @param ifx The queue interface.
+ * @return void* The consumer, NULL if failed.
+ * @note this function is only for RTI internal use.
+ */
+void *RTI_QueueIfxCreateConsumer(RTI_QUEUE_IFX *ifx)
+{
+    RTI_QUEUE *queue = (RTI_QUEUE *)RTIPriv_VlanAttach(&ifx->ifx, RTI_QueueIfxInstantiate, ifx);
+    void *consumer = NULL;
+    if (queue == NULL) {
+        return NULL;
+    }
+    if (RTI_QueueConsumerCreate(queue, &consumer) != RTI_OK) {
+        RTIPriv_VlanDetach(&ifx->ifx, RTI_QueueIfxRelease, ifx);
+        return NULL;
+    }
+    return consumer;
+}
+
+/**
+ * @brief deleteConsumerF of RTI_QUEUE_IFX_DEFINE, the last handle applies idle policy.
+ *
+ * @param ifx The queue interface.
+ * @param consumer The consumer.
+ * @note this function is only for RTI internal use.
+ */
+void RTI_QueueIfxDeleteConsumer(RTI_QUEUE_IFX *ifx, void *consumer)
+{
+    if (consumer == NULL) {
+        return;
+    }
+    RTI_QueueConsumerDelete(consumer);
+    RTIPriv_VlanDetach(&ifx->ifx, RTI_QueueIfxRelease, ifx);
+}
@@ -0,0 +1,447 @@
+/**
+ * @file rti_rpc.c
+ * @author CYK-Dot
+ * @brief Request/reply RPC implementation.
+ * @version 0.1
+ * @date 2026-10-16
+ *
+ * @copyright Copyright (c) 2025 CYK-Dot, MIT License.
+ */
+
+/* Header import ------------------------------------------------------------------*/
+#include "rti_rpc.h"
+#include "rti_timer.h"
+#include <stdlib.h>
+#include <string.h>
+
+/* Private typedef ----------------------------------------------------------------*/
+
+/**
+ * @brief Pending call, one slot of the preallocated slab.
+ *
+ */
+typedef struct {
+    RTI_TIMER timer;
+    RTI_RpcReplyFptr replyF;
+    void *arg;
+    uint32_t corrId;                    /* 0 if slot is free */
+    uint32_t nextFree;
+} RTI_RPC_PENDING;
+
+/**
+ * @brief RPC client, slab and message buffers follow it in the same allocation.
+ * @note a round-trip only takes a slab slot, it never allocates.
+ */
+struct rti_rpc_client {
+    RTI_VLAN_DESC request;
+    RTI_VLAN_DESC reply;                /* resolved once at create */
+    void *producer;
+    void *consumer;
+    uint32_t slotBits;
+    uint32_t freeHead;
+    uint32_t generation;
+    size_t msgSize;
+    uint8_t *sendBuf;
+    uint8_t *recvBuf;
+    RTI_TIMER_WHEEL wheel;
+    RTI_RPC_PENDING pending[];
+};
+
+/**
+ * @brief Reply VLAN of a client, resolved on its first request.
+ *
+ */
+typedef struct {
+    RTI_VlanId vlanId;
+    RTI_VLAN_DESC desc;
+    void *producer;
+} RTI_RPC_PEER;
+
+/**
+ * @brief RPC server, message buffers follow it in the same allocation.
+ *
+ */
+struct rti_rpc_server {
+    RTI_VLAN_DESC request;
+    void *consumer;
+    RTI_RpcHandleFptr handleF;
+    void *arg;
+    size_t msgSize;
+    uint8_t *recvBuf;
+    uint8_t *sendBuf;
+    uint32_t peerCnt;
+    RTI_RPC_PEER peers[RTI_RPC_SERVER_PEERS_MAX];
+};
+
+/* Private defines ----------------------------------------------------------------*/
+
+#define RTI_RPC_SLOT_NONE UINT32_MAX
+
+/* Global variables ---------------------------------------------------------------*/
+
+/* Private function prototypes ---------------------------------------------------*/
+
+/* Exported function prototypes --------------------------------------------------*/
+
+/* Private function definitions --------------------------------------------------*/
+
+/**
+ * @brief Return a pending slot to the free list.
+ *
+ * @param client The client.
+ * @param slot The slot.
+ */
+static inline void RTI_RpcSlotFree(RTI_RPC_CLIENT *client, RTI_RPC_PENDING *slot)
+{
+    slot->corrId = 0;
+    slot->nextFree = client->freeHead;
+    client->freeHead = (uint32_t)(slot - client->pending);
+}
+
+/**
+ * @brief Finish a pending call and call its reply function.
+ *
+ * @param client The client.
+ * @param slot The slot.
+ * @param status Status passed to reply function.
+ * @param reply The reply payload.
+ * @param size The payload size.
+ */
+static void RTI_RpcFinish(RTI_RPC_CLIENT *client, RTI_RPC_PENDING *slot, RTI_ERR status, const void *reply, size_t size)
+{
+    RTI_RpcReplyFptr replyF = slot->replyF;
+    void *arg = slot->arg;
+    RTI_TimerCancel(&client->wheel, &slot->timer);
+    // free before calling, so the reply function may issue a new call
+    RTI_RpcSlotFree(client, slot);
+    replyF(status, reply, size, arg);
+}
+
+/**
+ * @brief Timer function of a pending call.
+ *
+ * @param timer Timer of the slot.
+ * @param arg The client.
+ */
+static void RTI_RpcTimeout(RTI_TIMER *timer, void *arg)
+{
+    RTI_RPC_CLIENT *client = (RTI_RPC_CLIENT *)arg;
+    RTI_RPC_PENDING *slot = (RTI_RPC_PENDING *)((uint8_t *)timer - offsetof(RTI_RPC_PENDING, timer));
+    RTI_RpcFinish(client, slot, RTI_ERR_TIMEOUT, NULL, 0);
+}
+
+/**
+ * @brief Get the producer of a reply VLAN, resolve and cache it on first use.
+ *
+ * @param server The server.
+ * @param vlanId The reply VLAN ID.
+ * @param peerOut Pointer to store the peer.
+ * @return RTI_ERR Error code indicating success or failure.
+ */
+static RTI_ERR RTI_RpcPeerGet(RTI_RPC_SERVER *server, RTI_VlanId vlanId, RTI_RPC_PEER **peerOut)
+{
+    for (uint32_t i = 0; i < server->peerCnt; i++) {
+        if (server->peers[i].vlanId == vlanId) {
+            *peerOut = &server->peers[i];
+            return RTI_OK;
+        }
+    }
+    if (server->peerCnt == RTI_RPC_SERVER_PEERS_MAX) {
+        return RTI_ERR_NO_MEMORY;
+    }
+    RTI_RPC_PEER *peer = &server->peers[server->peerCnt];
+    RTI_ERR err = RTIPriv_VlanSelect(vlanId, &peer->desc);
+    if (err != RTI_OK) {
+        return err;
+    }
+    if (peer->desc.ifx->sendF == NULL) {
+        return RTI_ERR_NOT_SUPPORTED;
+    }
+    peer->producer = peer->desc.ifx->createProducerF();
+    if (peer->producer == NULL) {
+        return RTI_ERR_FAILED;
+    }
+    peer->vlanId = vlanId;
+    server->peerCnt++;
+    *peerOut = peer;
+    return RTI_OK;
+}
+
+/* Exported function definitions -------------------------------------------------*/
+
+/**
+ * @brief Create an RPC client on created request and reply VLANs.
+ *
+ * @param cfg The configuration.
+ * @param clientOut Pointer to store the client.
+ * @return RTI_ERR Error code indicating success or failure.
+ * @note a client is not thread-safe, call and poll it from one thread.
+ */
+RTI_ERR RTI_RpcClientCreate(const RTI_RPC_CFG *cfg, RTI_RPC_CLIENT **clientOut)
+{
+    if (cfg == NULL || clientOut == NULL || cfg->pendingMax == 0 || (cfg->pendingMax & (cfg->pendingMax - 1)) != 0
+        || cfg->pendingMax > ((uint32_t)1 << 16)) {
+        return RTI_ERR_INVALID_PARAM;
+    }
+    RTI_VLAN_DESC request;
+    RTI_VLAN_DESC reply;
+    RTI_ERR err = RTIPriv_VlanSelect(cfg->requestVlan, &request);
+    if (err == RTI_OK) {
+        err = RTIPriv_VlanSelect(cfg->replyVlan, &reply);
+    }
+    if (err != RTI_OK) {
+        return err;
+    }
+    if (request.ifx->sendF == NULL || reply.ifx->recvF == NULL) {
+        return RTI_ERR_NOT_SUPPORTED;
+    }
+    size_t msgSize = RTI_RPC_MSG_SIZE(cfg->payloadMax);
+    size_t slabBytes = cfg->pendingMax * sizeof(RTI_RPC_PENDING);
+    RTI_RPC_CLIENT *client = (RTI_RPC_CLIENT *)calloc(1, sizeof(RTI_RPC_CLIENT) + slabBytes + 2 * msgSize);
+    if (client == NULL) {
+        return RTI_ERR_NO_MEMORY;
+    }
+    client->request = request;
+    client->reply = reply;
+    client->producer = request.ifx->createProducerF();
+    client->consumer = reply.ifx->createConsumerF();
+    if (client->producer == NULL || client->consumer == NULL) {
+        RTI_RpcClientDelete(client);
+        return RTI_ERR_FAILED;
+    }
+    client->slotBits = (uint32_t)__builtin_ctz(cfg->pendingMax);
+    client->msgSize = msgSize;
+    client->sendBuf = (uint8_t *)&client->pending[cfg->pendingMax];
+    client->recvBuf = client->sendBuf + msgSize;
+    client->freeHead = RTI_RPC_SLOT_NONE;
+    for (uint32_t i = cfg->pendingMax; i > 0; i--) {
+        RTI_TimerInit(&client->pending[i - 1].timer, RTI_RpcTimeout, client);
+        RTI_RpcSlotFree(client, &client->pending[i - 1]);
+    }
+    RTI_TimerWheelInit(&client->wheel, 0);
+    *clientOut = client;
+    return RTI_OK;
+}
+
+/**
+ * @brief Delete an RPC client, pending calls are dropped without reply.
+ *
+ * @param client The client.
+ */
+void RTI_RpcClientDelete(RTI_RPC_CLIENT *client)
+{
+    if (client == NULL) {
+        return;
+    }
+    if (client->producer != NULL) {
+        client->request.ifx->deleteProducerF(client->producer);
+    }
+    if (client->consumer != NULL) {
+        client->reply.ifx->deleteConsumerF(client->consumer);
+    }
+    free(client);
+}
+
+/**
+ * @brief Send a request.
+ *
+ * @param client The client.
+ * @param req The request payload.
+ * @param size The payload size.
+ * @param timeout Ticks to wait for the reply, 0 waits forever.
+ * @param replyF Called from RTI_RpcClientPoll() with the reply or on timeout.
+ * @param arg Argument of replyF.
+ * @return RTI_ERR RTI_ERR_QUEUE_FULL if pendingMax calls are in flight,
+ *                 or error of sending the request.
+ */
+RTI_ERR RTI_RpcCall(RTI_RPC_CLIENT *client, const void *req, size_t size, uint32_t timeout,
+                    RTI_RpcReplyFptr replyF, void *arg)
+{
+    if (client == NULL || replyF == NULL || (req == NULL && size > 0) || RTI_RPC_MSG_SIZE(size) > client->msgSize) {
+        return RTI_ERR_INVALID_PARAM;
+    }
+    if (client->freeHead == RTI_RPC_SLOT_NONE) {
+        return RTI_ERR_QUEUE_FULL;
+    }
+    uint32_t index = client->freeHead;
+    RTI_RPC_PENDING *slot = &client->pending[index];
+    // generation in high bits tells late replies of a reused slot apart
+    uint32_t corrId;
+    do {
+        corrId = (++client->generation << client->slotBits) | index;
+    } while (corrId == 0);
+
+    RTI_RPC_HDR *hdr = (RTI_RPC_HDR *)client->sendBuf;
+    hdr->corrId = corrId;
+    hdr->status = RTI_OK;
+    hdr->replyVlan = client->reply.id;
+    hdr->reserved = 0;
+    if (size > 0) {
+        memcpy(hdr + 1, req, size);
+    }
+    RTI_ERR err = client->request.ifx->sendF(client->producer, hdr, RTI_RPC_MSG_SIZE(size), 0);
+    if (err != RTI_OK) {
+        return err;
+    }
+    client->freeHead = slot->nextFree;
+    slot->corrId = corrId;
+    slot->replyF = replyF;
+    slot->arg = arg;
+    if (timeout > 0) {
+        RTI_TimerStart(&client->wheel, &slot->timer, RTI_TimerWheelNow(&client->wheel) + timeout);
+    }
+    return RTI_OK;
+}
+
+/**
+ * @brief Dispatch received replies and expire timed out calls.
+ *
+ * @param client The client.
+ * @param now Current tick, counting from 0 at client creation.
+ * @param doneOut Pointer to store count of finished calls, may be NULL.
+ * @return RTI_ERR Error code indicating success or failure.
+ * @note replies of timed out calls are dropped.
+ */
+RTI_ERR RTI_RpcClientPoll(RTI_RPC_CLIENT *client, uint64_t now, size_t *doneOut)
+{
+    if (client == NULL) {
+        return RTI_ERR_INVALID_PARAM;
+    }
+    size_t done = 0;
+    RTI_ERR err = RTI_OK;
+    for (;;) {
+        size_t size = client->msgSize;
+        err = client->reply.ifx->recvF(client->consumer, client->recvBuf, &size);
+        if (err != RTI_OK) {
+            break;
+        }
+        if (size < sizeof(RTI_RPC_HDR)) {
+            continue;
+        }
+        const RTI_RPC_HDR *hdr = (const RTI_RPC_HDR *)client->recvBuf;
+        RTI_RPC_PENDING *slot = &client->pending[hdr->corrId & (((uint32_t)1 << client->slotBits) - 1)];
+        if (hdr->corrId == 0 || slot->corrId != hdr->corrId) {
+            continue;
+        }
+        RTI_RpcFinish(client, slot, (RTI_ERR)hdr->status, hdr + 1, size - sizeof(RTI_RPC_HDR));
+        done++;
+    }
+    if (err != RTI_ERR_QUEUE_EMPTY) {
+        return err;
+    }
+    size_t expired = 0;
+    RTI_TimerWheelAdvance(&client->wheel, now, &expired);
+    if (doneOut != NULL) {
+        *doneOut = done + expired;
+    }
+    return RTI_OK;
+}
+
+/**
+ * @brief Create an RPC server on a created request VLAN.
+ *
+ * @param requestVlan The request VLAN ID.
+ * @param payloadMax Maximum request and reply payload size.
+ * @param handleF Request handler.
+ * @param arg Argument of handleF.
+ * @param serverOut Pointer to store the server.
+ * @return RTI_ERR Error code indicating success or failure.
+ * @note a server is not thread-safe, poll it from one thread.
+ */
+RTI_ERR RTI_RpcServerCreate(RTI_VlanId requestVlan, uint32_t payloadMax, RTI_RpcHandleFptr handleF, void *arg,
+                            RTI_RPC_SERVER **serverOut)
+{
+    if (handleF == NULL || serverOut == NULL) {
+        return RTI_ERR_INVALID_PARAM;
+    }
+    RTI_VLAN_DESC request;
+    RTI_ERR err = RTIPriv_VlanSelect(requestVlan, &request);
+    if (err != RTI_OK) {
+        return err;
+    }
+    if (request.ifx->recvF == NULL) {
+        return RTI_ERR_NOT_SUPPORTED;
+    }
+    size_t msgSize = RTI_RPC_MSG_SIZE(payloadMax);
+    RTI_RPC_SERVER *server = (RTI_RPC_SERVER *)calloc(1, sizeof(RTI_RPC_SERVER) + 2 * msgSize);
+    if (server == NULL) {
+        return RTI_ERR_NO_MEMORY;
+    }
+    server->request = request;
+    server->consumer = request.ifx->createConsumerF();
+    if (server->consumer == NULL) {
+        free(server);
+        return RTI_ERR_FAILED;
+    }
+    server->handleF = handleF;
+    server->arg = arg;
+    server->msgSize = msgSize;
+    server->recvBuf = (uint8_t *)(server + 1);
+    server->sendBuf = server->recvBuf + msgSize;
+    *serverOut = server;
+    return RTI_OK;
+}
+
+/**
+ * @brief Delete an RPC server.
+ *
+ * @param server The server.
+ */
+void RTI_RpcServerDelete(RTI_RPC_SERVER *server)
+{
+    if (server == NULL) {
+        return;
+    }
+    for (uint32_t i = 0; i < server->peerCnt; i++) {
+        server->peers[i].desc.ifx->deleteProducerF(server->peers[i].producer);
+    }
+    server->request.ifx->deleteConsumerF(server->consumer);
+    free(server);
+}
+
+/**
+ * @brief Handle all queued requests and send their replies.
+ *
+ * @param server The server.
+ * @param doneOut Pointer to store count of handled requests, may be NULL.
+ * @return RTI_ERR First error of resolving a reply VLAN or sending a reply, or RTI_OK.
+ * @note a request whose reply can not be sent is dropped, its client times out.
+ */
+RTI_ERR RTI_RpcServerPoll(RTI_RPC_SERVER *server, size_t *doneOut)
+{
+    if (server == NULL) {
+        return RTI_ERR_INVALID_PARAM;
+    }
+    size_t done = 0;
+    RTI_ERR result = RTI_OK;
+    RTI_ERR err;
+    for (;;) {
+        size_t size = server->msgSize;
+        err = server->request.ifx->recvF(server->consumer, server->recvBuf, &size);
+        if (err != RTI_OK) {
+            break;
+        }
+        if (size < sizeof(RTI_RPC_HDR)) {
+            continue;
+        }
+        const RTI_RPC_HDR *req = (const RTI_RPC_HDR *)server->recvBuf;
+        RTI_RPC_HDR *reply = (RTI_RPC_HDR *)server->sendBuf;
+        size_t replySize = server->msgSize - sizeof(RTI_RPC_HDR);
+        reply->status = server->handleF(req + 1, size - sizeof(RTI_RPC_HDR), reply + 1, &replySize, server->arg);
+        reply->corrId = req->corrId;
+        reply->replyVlan = 0;
+        reply->reserved = 0;
+        done++;
+        RTI_RPC_PEER *peer = NULL;
+        err = RTI_RpcPeerGet(server, req->replyVlan, &peer);
+        if (err == RTI_OK) {
+            replySize = (replySize < server->msgSize - sizeof(RTI_RPC_HDR)) ? replySize : server->msgSize - sizeof(RTI_RPC_HDR);
+            err = peer->desc.ifx->sendF(peer->producer, reply, RTI_RPC_MSG_SIZE(replySize), 0);
+        }
+        result = (result == RTI_OK) ? err : result;
+    }
+    if (doneOut != NULL) {
+        *doneOut = done;
+    }
+    return (err != RTI_ERR_QUEUE_EMPTY) ? err : result;
+}
@@ -0,0 +1,793 @@
+/**
+ * @file rti_shm.c
+ * @author CYK-Dot
+ * @brief Shared-memory cross-process VLAN backend implementation.
+ * @version 0.1
+ * @date 2026-10-16
+ *
+ * @copyright Copyright (c) 2025 CYK-Dot, MIT License.
+ */
+
+/* Header import ------------------------------------------------------------------*/
+#ifndef _GNU_SOURCE
+#define _GNU_SOURCE
+#endif
+#include "rti_shm.h"
+#if RTI_ENABLE_SHM == 1
+#include "rti_os.h"
+#include <errno.h>
+#include <fcntl.h>
+#include <signal.h>
+#include <stdatomic.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+/* Private typedef ----------------------------------------------------------------*/
+
+/**
+ * @brief Segment header, the queue follows it at queueOffset.
+ *
+ */
+typedef struct {
+    uint32_t magic;
+    uint32_t version;
+    size_t sizeBytes;
+    size_t queueOffset;
+    atomic_uint ready;                  /* set by creator after queue init */
+    atomic_uint recoverLock;            /* pid of the recovering peer, 0 if free */
+    atomic_uint peers[RTI_SHM_PEERS_MAX]; /* pid of attached processes, 0 if free */
+} RTI_SHM_HDR;
+
+struct rti_shm {
+    RTI_SHM_HDR *hdr;
+    RTI_QUEUE *queue;
+    size_t sizeBytes;
+    int fd;
+    uint32_t pid;
+    uint32_t peerIdx;
+    int64_t recoverAtMs;
+};
+
+typedef struct {
+    RTI_SHM *shm;
+    void *handle;
+} RTI_SHM_HANDLE;
+
+/* Private defines ----------------------------------------------------------------*/
+
+#define RTI_SHM_MAGIC 0x53495452u        /* "RTIS" */
+#define RTI_SHM_VERSION 1u
+#define RTI_SHM_QUEUE_OFFSET (((sizeof(RTI_SHM_HDR) + RTI_CACHELINE_SIZE - 1) / RTI_CACHELINE_SIZE) * RTI_CACHELINE_SIZE)
+
+/* Global variables ---------------------------------------------------------------*/
+
+/* Private function prototypes ---------------------------------------------------*/
+
+/* Exported function prototypes --------------------------------------------------*/
+
+/* Private function definitions --------------------------------------------------*/
+
+/**
+ * @brief Check if a process is dead.
+ *
+ * @param pid The process ID.
+ * @param arg Not used.
+ * @return true The process does not exist anymore.
+ * @return false The process is alive, or a zombie not reaped by its parent.
+ */
+static bool RTI_ShmPidIsDead(uint32_t pid, void *arg)
+{
+    (void)arg;
+    return (kill((pid_t)pid, 0) == -1 && errno == ESRCH);
+}
+
+/**
+ * @brief Take a free peer entry for this process.
+ *
+ * @param shm The shared-memory VLAN.
+ * @return RTI_ERR Error code indicating success or failure.
+ */
+static RTI_ERR RTI_ShmPeerAttach(RTI_SHM *shm)
+{
+    for (int retry = 0; retry < 2; retry++) {
+        for (uint32_t i = 0; i < RTI_SHM_PEERS_MAX; i++) {
+            unsigned expect = 0;
+            if (atomic_compare_exchange_strong(&shm->hdr->peers[i], &expect, shm->pid)) {
+                shm->peerIdx = i;
+                return RTI_OK;
+            }
+        }
+        // table full, entries of dead peers may be reusable
+        RTI_ShmRecover(shm);
+    }
+    return RTI_ERR_NO_MEMORY;
+}
+
+/**
+ * @brief Map a segment and attach to it.
+ *
+ * @param fd The segment file descriptor, owned by shm on success.
+ * @param isCreator true if caller is going to init the segment.
+ * @param sizeBytes Segment size, 0 to read it from fd.
+ * @param shmOut Pointer to store the shared-memory VLAN.
+ * @return RTI_ERR RTI_ERR_NOT_READY if the creator has not finished the segment yet.
+ */
+static RTI_ERR RTI_ShmMap(int fd, bool isCreator, size_t sizeBytes, RTI_SHM **shmOut)
+{
+    if (sizeBytes == 0) {
+        struct stat st;
+        if (fstat(fd, &st) != 0) {
+            return RTI_ERR_FAILED;
+        }
+        // the creator sizes the segment right after creating it
+        if ((size_t)st.st_size < RTI_SHM_QUEUE_OFFSET) {
+            return RTI_ERR_NOT_READY;
+        }
+        sizeBytes = (size_t)st.st_size;
+    }
+    void *base = mmap(NULL, sizeBytes, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    if (base == MAP_FAILED) {
+        return RTI_ERR_FAILED;
+    }
+    RTI_SHM_HDR *hdr = (RTI_SHM_HDR *)base;
+    if (isCreator == false) {
+        // header is only valid once ready is set
+        if (atomic_load(&hdr->ready) == 0) {
+            munmap(base, sizeBytes);
+            return RTI_ERR_NOT_READY;
+        }
+        if (hdr->magic != RTI_SHM_MAGIC || hdr->version != RTI_SHM_VERSION || hdr->sizeBytes != sizeBytes) {
+            munmap(base, sizeBytes);
+            return RTI_ERR_INVALID_PARAM;
+        }
+    }
+    RTI_SHM *shm = (RTI_SHM *)calloc(1, sizeof(RTI_SHM));
+    if (shm == NULL) {
+        munmap(base, sizeBytes);
+        return RTI_ERR_NO_MEMORY;
+    }
+    shm->hdr = hdr;
+    shm->queue = (RTI_QUEUE *)((uint8_t *)base + RTI_SHM_QUEUE_OFFSET);
+    shm->sizeBytes = sizeBytes;
+    shm->fd = fd;
+    shm->pid = (uint32_t)getpid();
+    *shmOut = shm;
+    return RTI_OK;
+}
+
+/**
+ * @brief Recover dead peers if the VLAN looks stalled, at most once per interval.
+ *
+ * @param shm The shared-memory VLAN.
+ * @return true Some peer was recovered, caller may retry.
+ * @return false Nothing recovered.
+ */
+static bool RTI_ShmRecoverLazy(RTI_SHM *shm)
+{
+    int64_t now = RTIPriv_OsNowMs();
+    if (now < shm->recoverAtMs) {
+        return false;
+    }
+    shm->recoverAtMs = now + RTI_SHM_RECOVER_INTERVAL_MS;
+    return RTI_ShmRecover(shm) > 0;
+}
+
+/**
+ * @brief Wrap a queue handle with its shared-memory VLAN.
+ *
+ * @param shm The shared-memory VLAN.
+ * @param handle The queue producer or consumer.
+ * @param isProducer true if handle is a producer.
+ * @param handleOut Pointer to store the wrapped handle.
+ * @return RTI_ERR Error code indicating success or failure.
+ */
+static RTI_ERR RTI_ShmHandleWrap(RTI_SHM *shm, void *handle, bool isProducer, void **handleOut)
+{
+    RTI_SHM_HANDLE *wrap = (RTI_SHM_HANDLE *)malloc(sizeof(RTI_SHM_HANDLE));
+    if (wrap == NULL) {
+        return RTI_ERR_NO_MEMORY;
+    }
+    RTIPriv_QueueSetOwner(handle, isProducer, shm->pid);
+    wrap->shm = shm;
+    wrap->handle = handle;
+    *handleOut = wrap;
+    return RTI_OK;
+}
+
+/* Exported function definitions -------------------------------------------------*/
+
+/**
+ * @brief Create a shared-memory VLAN.
+ *
+ * @param name POSIX shared-memory name like "/my_vlan", NULL to create an
+ *             anonymous memfd segment, share it by RTI_ShmGetFd().
+ * @param cfg The queue configuration.
+ * @param shmOut Pointer to store the shared-memory VLAN.
+ * @return RTI_ERR RTI_ERR_ALREADY_EXIST if a segment of name exists, open it instead.
+ * @note a named segment stays until RTI_ShmUnlink(), even if all peers exit.
+ */
+RTI_ERR RTI_ShmCreate(const char *name, const RTI_QUEUE_CFG *cfg, RTI_SHM **shmOut)
+{
+    size_t queueBytes = RTI_QueueMemSize(cfg);
+    if (queueBytes == 0 || shmOut == NULL) {
+        return RTI_ERR_INVALID_PARAM;
+    }
+    size_t sizeBytes = RTI_SHM_QUEUE_OFFSET + queueBytes;
+    int fd = (name == NULL) ? memfd_create("rti_shm", MFD_CLOEXEC)
+                            : shm_open(name, O_CREAT | O_EXCL | O_RDWR, 0600);
+    if (fd < 0) {
+        return (errno == EEXIST) ? RTI_ERR_ALREADY_EXIST : RTI_ERR_FAILED;
+    }
+    RTI_SHM *shm = NULL;
+    RTI_ERR err = RTI_ERR_FAILED;
+    if (ftruncate(fd, (off_t)sizeBytes) == 0) {
+        err = RTI_ShmMap(fd, true, sizeBytes, &shm);
+    }
+    if (err == RTI_OK) {
+        RTI_QUEUE *queue = NULL;
+        RTI_SHM_HDR *hdr = shm->hdr;
+        hdr->magic = RTI_SHM_MAGIC;
+        hdr->version = RTI_SHM_VERSION;
+        hdr->sizeBytes = sizeBytes;
+        hdr->queueOffset = RTI_SHM_QUEUE_OFFSET;
+        err = RTI_QueueInit(shm->queue, queueBytes, cfg, &queue);
+    }
+    if (err == RTI_OK) {
+        RTIPriv_QueueSetShared(shm->queue);
+        atomic_store(&shm->hdr->ready, 1);
+        err = RTI_ShmPeerAttach(shm);
+    }
+    if (err != RTI_OK) {
+        if (shm != NULL) {
+            munmap(shm->hdr, shm->sizeBytes);
+            free(shm);
+        }
+        close(fd);
+        if (name != NULL) {
+            shm_unlink(name);
+        }
+        return err;
+    }
+    *shmOut = shm;
+    return RTI_OK;
+}
+
+/**
+ * @brief Open a named shared-memory VLAN created by another process.
+ *
+ * @param name POSIX shared-memory name.
+ * @param shmOut Pointer to store the shared-memory VLAN.
+ * @return RTI_ERR RTI_ERR_NOT_READY if the creator has not finished the segment yet.
+ */
+RTI_ERR RTI_ShmOpen(const char *name, RTI_SHM **shmOut)
+{
+    if (name == NULL || shmOut == NULL) {
+        return RTI_ERR_INVALID_PARAM;
+    }
+    int fd = shm_open(name, O_RDWR, 0600);
+    if (fd < 0) {
+        return RTI_ERR_FAILED;
+    }
+    RTI_ERR err = RTI_ShmOpenFd(fd, shmOut);
+    if (err != RTI_OK) {
+        close(fd);
+    }
+    return err;
+}
+
+/**
+ * @brief Open a shared-memory VLAN by file descriptor.
+ *
+ * @param fd The segment file descriptor, from RTI_ShmGetFd() of another
+ *           process, passed by fork() or SCM_RIGHTS. owned by shm on success.
+ * @param shmOut Pointer to store the shared-memory VLAN.
+ * @return RTI_ERR Error code indicating success or failure.
+ */
+RTI_ERR RTI_ShmOpenFd(int fd, RTI_SHM **shmOut)
+{
+    if (fd < 0 || shmOut == NULL) {
+        return RTI_ERR_INVALID_PARAM;
+    }
+    RTI_SHM *shm = NULL;
+    RTI_ERR err = RTI_ShmMap(fd, false, 0, &shm);
+    if (err != RTI_OK) {
+        return err;
+    }
+    err = RTI_ShmPeerAttach(shm);
+    if (err != RTI_OK) {
+        munmap(shm->hdr, shm->sizeBytes);
+        free(shm);
+        return err;
+    }
+    *shmOut = shm;
+    return RTI_OK;
+}
+
+/**
+ * @brief Detach and unmap a shared-memory VLAN.
+ *
+ * @param shm The shared-memory VLAN.
+ * @note delete producers and consumers of shm before closing it.
+ */
+void RTI_ShmClose(RTI_SHM *shm)
+{
+    if (shm == NULL) {
+        return;
+    }
+    unsigned expect = shm->pid;
+    atomic_compare_exchange_strong(&shm->hdr->peers[shm->peerIdx], &expect, 0);
+    munmap(shm->hdr, shm->sizeBytes);
+    close(shm->fd);
+    free(shm);
+}
+
+/**
+ * @brief Remove the name of a shared-memory VLAN.
+ *
+ * @param name POSIX shared-memory name.
+ * @return RTI_ERR Error code indicating success or failure.
+ * @note attached peers keep working until they close it.
+ */
+RTI_ERR RTI_ShmUnlink(const char *name)
+{
+    if (name == NULL) {
+        return RTI_ERR_INVALID_PARAM;
+    }
+    return (shm_unlink(name) == 0) ? RTI_OK : RTI_ERR_FAILED;
+}
+
+/**
+ * @brief Get the file descriptor of a shared-memory VLAN.
+ *
+ * @param shm The shared-memory VLAN.
+ * @return int The file descriptor, -1 if shm is NULL.
+ */
+int RTI_ShmGetFd(RTI_SHM *shm)
+{
+    return (shm == NULL) ? -1 : shm->fd;
+}
+
+/**
+ * @brief Recover slots and peer entries left by dead processes.
+ *
+ * @param shm The shared-memory VLAN.
+ * @return uint32_t Count of dead peers found.
+ * @note called automatically, at most once per RTI_SHM_RECOVER_INTERVAL_MS,
+ *       when send finds the VLAN full or recv finds it stalled.
+ *       a child process is only dead after its parent has reaped it.
+ */
+uint32_t RTI_ShmRecover(RTI_SHM *shm)
+{
+    if (shm == NULL) {
+        return 0;
+    }
+    RTI_SHM_HDR *hdr = shm->hdr;
+    unsigned holder = 0;
+    while (atomic_compare_exchange_strong(&hdr->recoverLock, &holder, shm->pid) == false) {
+        // another peer is recovering, take over only if it died meanwhile
+        if (RTI_ShmPidIsDead(holder, NULL) == false) {
+            return 0;
+        }
+    }
+    uint32_t deadCnt = 0;
+    for (uint32_t i = 0; i < RTI_SHM_PEERS_MAX; i++) {
+        unsigned pid = atomic_load(&hdr->peers[i]);
+        if (pid != 0 && RTI_ShmPidIsDead(pid, NULL) == true) {
+            deadCnt++;
+        }
+    }
+    // a peer may die right after claiming a slot, before stamping it
+    RTIPriv_QueueRecover(shm->queue, RTI_ShmPidIsDead, NULL, deadCnt > 0);
+    for (uint32_t i = 0; i < RTI_SHM_PEERS_MAX; i++) {
+        unsigned pid = atomic_load(&hdr->peers[i]);
+        if (pid != 0 && RTI_ShmPidIsDead(pid, NULL) == true) {
+            atomic_compare_exchange_strong(&hdr->peers[i], &pid, 0);
+        }
+    }
+    atomic_store(&hdr->recoverLock, 0);
+    return deadCnt;
+}
+
+/**
+ * @brief Create a producer of a shared-memory VLAN.
+ *
+ * @param shm The shared-memory VLAN.
+ * @param producerOut Pointer to store the producer.
+ * @return RTI_ERR Error code indicating success or failure.
+ */
+RTI_ERR RTI_ShmProducerCreate(RTI_SHM *shm, void **producerOut)
+{
+    if (shm == NULL || producerOut == NULL) {
+        return RTI_ERR_INVALID_PARAM;
+    }
+    void *producer = NULL;
+    RTI_ERR err = RTI_QueueProducerCreate(shm->queue, &producer);
+    if (err == RTI_OK) {
+        err = RTI_ShmHandleWrap(shm, producer, true, producerOut);
+    }
+    if (err != RTI_OK) {
+        RTI_QueueProducerDelete(producer);
+    }
+    return err;
+}
+
+/**
+ * @brief Delete a producer of a shared-memory VLAN.
+ *
+ * @param producer The producer.
+ */
+void RTI_ShmProducerDelete(void *producer)
+{
+    if (producer == NULL) {
+        return;
+    }
+    RTI_QueueProducerDelete(((RTI_SHM_HANDLE *)producer)->handle);
+    free(producer);
+}
+
+/**
+ * @brief Create a consumer of a shared-memory VLAN.
+ *
+ * @param shm The shared-memory VLAN.
+ * @param consumerOut Pointer to store the consumer.
+ * @return RTI_ERR Error code indicating success or failure.
+ */
+RTI_ERR RTI_ShmConsumerCreate(RTI_SHM *shm, void **consumerOut)
+{
+    if (shm == NULL || consumerOut == NULL) {
+        return RTI_ERR_INVALID_PARAM;
+    }
+    void *consumer = NULL;
+    RTI_ERR err = RTI_QueueConsumerCreate(shm->queue, &consumer);
+    if (err == RTI_OK) {
+        err = RTI_ShmHandleWrap(shm, consumer, false, consumerOut);
+    }
+    if (err != RTI_OK) {
+        RTI_QueueConsumerDelete(consumer);
+    }
+    return err;
+}
+
+/**
+ * @brief Delete a consumer of a shared-memory VLAN.
+ *
+ * @param consumer The consumer.
+ */
+void RTI_ShmConsumerDelete(void *consumer)
+{
+    if (consumer == NULL) {
+        return;
+    }
+    RTI_QueueConsumerDelete(((RTI_SHM_HANDLE *)consumer)->handle);
+    free(consumer);
+}
+
+/**
+ * @brief Claim a slot in shared memory to write message in place.
+ *
+ * @param producer The producer.
+ * @param size The message size in bytes.
+ * @param lane The lane index, 0 has the highest priority.
+ * @param buf Pointer to store the claimed buffer.
+ * @return RTI_ERR Error code indicating success or failure.
+ */
+RTI_ERR RTI_ShmSendAcquire(void *producer, size_t size, uint8_t lane, RTI_QUEUE_BUF *buf)
+{
+    if (producer == NULL) {
+        return RTI_ERR_INVALID_PARAM;
+    }
+    RTI_SHM_HANDLE *self = (RTI_SHM_HANDLE *)producer;
+    RTI_ERR err = RTI_QueueSendAcquire(self->handle, size, lane, buf);
+    // a dead consumer may hold slots forever
+    if (err == RTI_ERR_QUEUE_FULL && RTI_ShmRecoverLazy(self->shm) == true) {
+        err = RTI_QueueSendAcquire(self->handle, size, lane, buf);
+    }
+    return err;
+}
+
+/**
+ * @brief Publish a slot claimed by RTI_ShmSendAcquire() to consumers.
+ *
+ * @param producer The producer.
+ * @param buf The claimed buffer.
+ * @return RTI_ERR RTI_ERR_FAILED if the slot was recovered by a peer meanwhile.
+ */
+RTI_ERR RTI_ShmSendCommit(void *producer, RTI_QUEUE_BUF *buf)
+{
+    if (producer == NULL) {
+        return RTI_ERR_INVALID_PARAM;
+    }
+    return RTI_QueueSendCommit(((RTI_SHM_HANDLE *)producer)->handle, buf);
+}
+
+/**
+ * @brief Claim the next message in shared memory to read it in place.
+ *
+ * @param consumer The consumer.
+ * @param buf Pointer to store the claimed buffer.
+ * @return RTI_ERR Error code indicating success or failure.
+ */
+RTI_ERR RTI_ShmRecvAcquire(void *consumer, RTI_QUEUE_BUF *buf)
+{
+    if (consumer == NULL) {
+        return RTI_ERR_INVALID_PARAM;
+    }
+    RTI_SHM_HANDLE *self = (RTI_SHM_HANDLE *)consumer;
+    RTI_ERR err = RTI_QueueRecvAcquire(self->handle, buf);
+    // claimed but unpublished slots may belong to a dead producer
+    if (err == RTI_ERR_QUEUE_EMPTY && RTIPriv_QueueUsed(self->shm->queue) > 0
+        && RTI_ShmRecoverLazy(self->shm) == true) {
+        err = RTI_QueueRecvAcquire(self->handle, buf);
+    }
+    return err;
+}
+
+/**
+ * @brief Give a slot claimed by RTI_ShmRecvAcquire() back to producers.
+ *
+ * @param consumer The consumer.
+ * @param buf The claimed buffer.
+ * @return RTI_ERR Error code indicating success or failure.
+ */
+RTI_ERR RTI_ShmRecvRelease(void *consumer, RTI_QUEUE_BUF *buf)
+{
+    if (consumer == NULL) {
+        return RTI_ERR_INVALID_PARAM;
+    }
+    return RTI_QueueRecvRelease(((RTI_SHM_HANDLE *)consumer)->handle, buf);
+}
+
+/**
+ * @brief Send a message to a shared-memory VLAN.
+ *
+ * @param producer The producer.
+ * @param msg The message.
+ * @param size The message size in bytes.
+ * @param lane The lane index, 0 has the highest priority.
+ * @return RTI_ERR Error code indicating success or failure.
+ */
+RTI_ERR RTI_ShmSend(void *producer, const void *msg, size_t size, uint8_t lane)
+{
+    if (msg == NULL) {
+        return RTI_ERR_INVALID_PARAM;
+    }
+    RTI_QUEUE_BUF buf;
+    RTI_ERR err = RTI_ShmSendAcquire(producer, size, lane, &buf);
+    if (err != RTI_OK) {
+        return err;
+    }
+    memcpy(buf.data, msg, size);
+    return RTI_ShmSendCommit(producer, &buf);
+}
+
+/**
+ * @brief Receive a message from a shared-memory VLAN.
+ *
+ * @param consumer The consumer.
+ * @param msg Buffer to store the message.
+ * @param size [in] buffer size, [out] message size.
+ * @return RTI_ERR Error code indicating success or failure.
+ */
+RTI_ERR RTI_ShmRecv(void *consumer, void *msg, size_t *size)
+{
+    if (consumer == NULL) {
+        return RTI_ERR_INVALID_PARAM;
+    }
+    RTI_SHM_HANDLE *self = (RTI_SHM_HANDLE *)consumer;
+    RTI_ERR err = RTI_QueueRecv(self->handle, msg, size);
+    if (err == RTI_ERR_QUEUE_EMPTY && RTIPriv_QueueUsed(self->shm->queue) > 0
+        && RTI_ShmRecoverLazy(self->shm) == true) {
+        err = RTI_QueueRecv(self->handle, msg, size);
+    }
+    return err;
+}
+
+/**
+ * @brief Receive a message from a shared-memory VLAN, wait if it is empty.
+ *
+ * @param consumer The consumer.
+ * @param msg Buffer to store the message.
+ * @param size [in] buffer size, [out] message size.
+ * @param timeoutMs Max time to wait in milliseconds, 0 never waits, negative waits forever.
+ * @return RTI_ERR RTI_ERR_QUEUE_EMPTY if timed out.
+ * @note parks on a process-shared futex, wakes up every
+ *       RTI_SHM_RECOVER_INTERVAL_MS to check if a dead producer stalls the VLAN.
+ */
+RTI_ERR RTI_ShmRecvWait(void *consumer, void *msg, size_t *size, int32_t timeoutMs)
+{
+    if (consumer == NULL) {
+        return RTI_ERR_INVALID_PARAM;
+    }
+    RTI_SHM_HANDLE *self = (RTI_SHM_HANDLE *)consumer;
+    int64_t deadline = RTIPriv_OsNowMs() + timeoutMs;
+    for (;;) {
+        int32_t slice = RTI_SHM_RECOVER_INTERVAL_MS;
+        if (timeoutMs >= 0) {
+            int64_t left = deadline - RTIPriv_OsNowMs();
+            slice = (left < slice) ? (int32_t)((left > 0) ? left : 0) : slice;
+        }
+        RTI_ERR err = RTI_QueueRecvWait(self->handle, msg, size, slice);
+        if (err != RTI_ERR_QUEUE_EMPTY) {
+            return err;
+        }
+        err = RTI_ShmRecv(consumer, msg, size);
+        if (err != RTI_ERR_QUEUE_EMPTY || slice == 0) {
+            return err;
+        }
+    }
+}
+
+/**
+ * @brief Get flow control status of a producer.
+ *
+ * @param producer The producer.
+ * @param flow Pointer to store the flow status.
+ * @return RTI_ERR Error code indicating success or failure.
+ * @note watermarks are not supported across processes, credits are the free slots.
+ */
+RTI_ERR RTI_ShmFlowGet(void *producer, RTI_VLAN_FLOW *flow)
+{
+    if (producer == NULL) {
+        return RTI_ERR_INVALID_PARAM;
+    }
+    return RTI_QueueFlowGet(((RTI_SHM_HANDLE *)producer)->handle, flow);
+}
+
+/**
+ * @brief Open a named segment, waiting for its creator to finish it.
+ *
+ * @param name POSIX shared-memory name.
+ * @param shmOut Pointer to store the shared-memory VLAN.
+ * @return RTI_ERR RTI_ERR_TIMEOUT if it is not ready within RTI_SHM_READY_TIMEOUT_MS.
+ */
+static RTI_ERR RTI_ShmOpenReady(const char *name, RTI_SHM **shmOut)
+{
+    int64_t deadline = RTIPriv_OsNowMs() + RTI_SHM_READY_TIMEOUT_MS;
+    RTI_ERR err = RTI_ShmOpen(name, shmOut);
+    while (err == RTI_ERR_NOT_READY) {
+        if (RTIPriv_OsNowMs() >= deadline) {
+            return RTI_ERR_TIMEOUT;
+        }
+        RTIPriv_OsSleepNs(1000000u);
+        err = RTI_ShmOpen(name, shmOut);
+    }
+    return err;
+}
+
+/**
+ * @brief Open or create the segment of an interface, called once under the lazy lock.
+ *
+ * @param arg The shared-memory interface.
+ * @return void* The shared-memory VLAN, NULL if failed.
+ */
+static void *RTI_ShmIfxInstantiate(void *arg)
+{
+    RTI_SHM_IFX *ifx = (RTI_SHM_IFX *)arg;
+    RTI_ERR err = RTI_ShmOpen(ifx->name, &ifx->shm);
+    // nobody created it yet, or another process is creating it right now
+    if (err != RTI_OK && err != RTI_ERR_NOT_READY) {
+        err = RTI_ShmCreate(ifx->name, &ifx->cfg, &ifx->shm);
+    }
+    if (err == RTI_ERR_ALREADY_EXIST || err == RTI_ERR_NOT_READY) {
+        err = RTI_ShmOpenReady(ifx->name, &ifx->shm);
+    }
+    if (err != RTI_OK) {
+        ifx->shm = NULL;
+    }
+    return ifx->shm;
+}
+
+/**
+ * @brief Close the segment of an interface, called under the lazy lock.
+ *
+ * @param arg The shared-memory interface.
+ * @param vlan The shared-memory VLAN.
+ */
+static void RTI_ShmIfxRelease(void *arg, void *vlan)
+{
+    RTI_SHM_IFX *ifx = (RTI_SHM_IFX *)arg;
+    RTI_ShmClose((RTI_SHM *)vlan);
+    ifx->shm = NULL;
+}
+
+/**
+ * @brief createF of RTI_SHM_IFX_DEFINE, open or create the segment once.
+ *
+ * @param ifx The shared-memory interface.
+ * @return void* The shared-memory VLAN, NULL if failed.
+ * @note this function is only for RTI internal use.
+ */
+void *RTI_ShmIfxCreate(RTI_SHM_IFX *ifx)
+{
+    return RTIPriv_VlanPin(&ifx->ifx, RTI_ShmIfxInstantiate, ifx);
+}
+
+/**
+ * @brief deleteF of RTI_SHM_IFX_DEFINE.
+ *
+ * @param ifx The shared-memory interface.
+ * @param vlan The shared-memory VLAN returned by createF.
+ * @note this function is only for RTI internal use.
+ */
+void RTI_ShmIfxDelete(RTI_SHM_IFX *ifx, void *vlan)
+{
+    RTIPriv_VlanUnpin(&ifx->ifx, vlan, RTI_ShmIfxRelease, ifx);
+}
+
+/**
+ * @brief createProducerF of RTI_SHM_IFX_DEFINE, the first handle opens the segment.
+ *
+ * @param ifx The shared-memory interface.
+ * @return void* The producer, NULL if failed.
+ * @note this function is only for RTI internal use.
+ */
+void *RTI_ShmIfxCreateProducer(RTI_SHM_IFX *ifx)
+{
+    RTI_SHM *shm = (RTI_SHM *)RTIPriv_VlanAttach(&ifx->ifx, RTI_ShmIfxInstantiate, ifx);
+    void *producer = NULL;
+    if (shm == NULL) {
+        return NULL;
+    }
+    if (RTI_ShmProducerCreate(shm, &producer) != RTI_OK) {
+        RTIPriv_VlanDetach(&ifx->ifx, RTI_ShmIfxRelease, ifx);
+        return NULL;
+    }
+    return producer;
+}
+
+/**
+ * @brief deleteProducerF of RTI_SHM_IFX_DEFINE, the last handle applies idle policy.
+ *
+ * @param ifx The shared-memory interface.
+ * @param producer The producer.
+ * @note this function is only for RTI internal use.
+ */
+void RTI_ShmIfxDeleteProducer(RTI_SHM_IFX *ifx, void *producer)
+{
+    if (producer == NULL) {
+        return;
+    }
+    RTI_ShmProducerDelete(producer);
+    RTIPriv_VlanDetach(&ifx->ifx, RTI_ShmIfxRelease, ifx);
+}
+
+/**
+ * @brief createConsumerF of RTI_SHM_IFX_DEFINE, the first handle opens the segment.
+ *
+ * @param ifx The shared-memory interface.
+ * @return void* The consumer, NULL if failed.
+ * @note this function is only for RTI internal use.
+ */
+void *RTI_ShmIfxCreateConsumer(RTI_SHM_IFX *ifx)
+{
+    RTI_SHM *shm = (RTI_SHM *)RTIPriv_VlanAttach(&ifx->ifx, RTI_ShmIfxInstantiate, ifx);
+    void *consumer = NULL;
+    if (shm == NULL) {
+        return NULL;
+    }
+    if (RTI_ShmConsumerCreate(shm, &consumer) != RTI_OK) {
+        RTIPriv_VlanDetach(&ifx->ifx, RTI_ShmIfxRelease, ifx);
+        return NULL;
+    }
+    return consumer;
+}
+
+/**
+ * @brief deleteConsumerF of RTI_SHM_IFX_DEFINE, the last handle applies idle policy.
+ *
+ * @param ifx The shared-memory interface.
+ * @param consumer The consumer.
+ * @note this function is only for RTI internal use.
+ */
+void RTI_ShmIfxDeleteConsumer(RTI_SHM_IFX *ifx, void *consumer)
+{
+    if (consumer == NULL) {
+        return;
+    }
+    RTI_ShmConsumerDelete(consumer);
+    RTIPriv_VlanDetach(&ifx->ifx, RTI_ShmIfxRelease, ifx);
+}
+#endif
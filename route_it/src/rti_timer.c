@@ -0,0 +1,675 @@
+/**
+ * @file rti_timer.c
+ * @author CYK-Dot
+ * @brief Hierarchical timer wheel and timer service implementation.
+ * @version 0.1
+ * @date 2026-10-16
+ *
+ * @copyright Copyright (c) 2025 CYK-Dot, MIT License.
+ */
+
+/* Header import ------------------------------------------------------------------*/
+#include "rti_timer.h"
+#include "rti_os.h"
+#include <stdatomic.h>
+#include <stdlib.h>
+#include <string.h>
+
+/* Private typedef ----------------------------------------------------------------*/
+
+/**
+ * @brief Pending post, one slot of the preallocated pool.
+ *
+ */
+typedef struct {
+    RTI_TIMER timer;
+    uint32_t postId;                    /* 0 if slot is free */
+    uint32_t nextFree;
+    uint32_t period;
+    uint32_t size;
+    uint8_t target;
+    uint8_t lane;
+    uint8_t *msg;
+} RTI_TIMER_POST;
+
+/**
+ * @brief VLAN posted to, resolved on its first post.
+ *
+ */
+typedef struct {
+    RTI_VlanId vlanId;
+    RTI_VLAN_DESC desc;
+    void *producer;
+} RTI_TIMER_TARGET;
+
+/**
+ * @brief Timer service, post pool and messages follow it in the same allocation.
+ * @note the lock is held while posts are sent, post to VLANs in nonblocking mode.
+ */
+struct rti_timer_service {
+    RTI_TIMER_WHEEL wheel;
+    atomic_flag lock;
+    atomic_uint wakeSeq;
+    atomic_bool running;
+    RTI_OS_THREAD thread;
+    int64_t startMs;
+    uint32_t tickMs;
+    uint32_t slotBits;
+    uint32_t freeHead;
+    uint32_t generation;
+    uint32_t msgSizeMax;
+    uint32_t targetCnt;
+    RTI_TIMER_TARGET targets[RTI_TIMER_SERVICE_VLANS_MAX];
+    RTI_TIMER_POST posts[];
+};
+
+/* Private defines ----------------------------------------------------------------*/
+
+#define RTI_TIMER_WHEEL_MASK ((uint64_t)RTI_TIMER_WHEEL_SLOTS - 1)
+
+#define RTI_TIMER_POST_NONE UINT32_MAX
+
+/**
+ * @brief Ticks covered by levels below LEVEL, timers this far ahead go to LEVEL.
+ */
+#define RTI_TIMER_WHEEL_SPAN(LEVEL) ((uint64_t)1 << (RTI_TIMER_WHEEL_BITS * (LEVEL)))
+
+/* Global variables ---------------------------------------------------------------*/
+
+/* Private function prototypes ---------------------------------------------------*/
+
+/* Exported function prototypes --------------------------------------------------*/
+
+/* Private function definitions --------------------------------------------------*/
+
+/**
+ * @brief Link a timer into the slot of its expire tick.
+ *
+ * @param wheel The wheel.
+ * @param timer The timer, not pending.
+ * @note a timer at level L is moved down when the ticks of level L-1 wrap
+ *       into its slot, so it never fires early and is never skipped.
+ */
+static void RTI_TimerPlace(RTI_TIMER_WHEEL *wheel, RTI_TIMER *timer)
+{
+    uint64_t expire = (timer->expire > wheel->tick) ? timer->expire : wheel->tick;
+    uint64_t delta = expire - wheel->tick;
+    if (delta >= RTI_TIMER_WHEEL_SPAN(RTI_TIMER_WHEEL_LEVELS)) {
+        // beyond the top level, park at its far end and place again later
+        expire = wheel->tick + RTI_TIMER_WHEEL_SPAN(RTI_TIMER_WHEEL_LEVELS) - 1;
+        delta = expire - wheel->tick;
+    }
+    uint32_t level = 0;
+    while (level < RTI_TIMER_WHEEL_LEVELS - 1 && delta >= RTI_TIMER_WHEEL_SPAN(level + 1)) {
+        level++;
+    }
+    RTI_TIMER **head = &wheel->slots[level][(expire >> (RTI_TIMER_WHEEL_BITS * level)) & RTI_TIMER_WHEEL_MASK];
+    timer->next = *head;
+    if (timer->next != NULL) {
+        timer->next->pprev = &timer->next;
+    }
+    timer->pprev = head;
+    *head = timer;
+}
+
+/**
+ * @brief Unlink a pending timer.
+ *
+ * @param timer The timer.
+ */
+static inline void RTI_TimerUnlink(RTI_TIMER *timer)
+{
+    *timer->pprev = timer->next;
+    if (timer->next != NULL) {
+        timer->next->pprev = timer->pprev;
+    }
+    timer->next = NULL;
+    timer->pprev = NULL;
+}
+
+/**
+ * @brief Move timers of a higher level slot down to lower levels.
+ *
+ * @param wheel The wheel.
+ * @param level The level.
+ * @param slot The slot index.
+ */
+static void RTI_TimerCascade(RTI_TIMER_WHEEL *wheel, uint32_t level, uint64_t slot)
+{
+    RTI_TIMER *list = wheel->slots[level][slot];
+    wheel->slots[level][slot] = NULL;
+    while (list != NULL) {
+        RTI_TIMER *timer = list;
+        list = timer->next;
+        RTI_TimerPlace(wheel, timer);
+    }
+}
+
+static inline void RTI_TimerServiceLock(RTI_TIMER_SERVICE *service)
+{
+    while (atomic_flag_test_and_set_explicit(&service->lock, memory_order_acquire) == true) {
+        RTI_OS_CPU_RELAX();
+    }
+}
+
+static inline void RTI_TimerServiceUnlock(RTI_TIMER_SERVICE *service)
+{
+    atomic_flag_clear_explicit(&service->lock, memory_order_release);
+}
+
+/**
+ * @brief Current tick of a service, by its clock in thread mode or its wheel otherwise.
+ *
+ * @param service The service.
+ * @return uint64_t The tick.
+ */
+static inline uint64_t RTI_TimerServiceNow(RTI_TIMER_SERVICE *service)
+{
+    if (atomic_load_explicit(&service->running, memory_order_relaxed) == true) {
+        return (uint64_t)(RTIPriv_OsNowMs() - service->startMs) / service->tickMs;
+    }
+    return RTI_TimerWheelNow(&service->wheel);
+}
+
+/**
+ * @brief Return a post slot to the free list.
+ *
+ * @param service The service.
+ * @param post The post.
+ */
+static inline void RTI_TimerPostFree(RTI_TIMER_SERVICE *service, RTI_TIMER_POST *post)
+{
+    post->postId = 0;
+    post->nextFree = service->freeHead;
+    service->freeHead = (uint32_t)(post - service->posts);
+}
+
+/**
+ * @brief Find the cached target of a VLAN, called under the service lock.
+ *
+ * @param service The service.
+ * @param vlanId The VLAN ID.
+ * @return uint32_t The target index, RTI_TIMER_SERVICE_VLANS_MAX if not cached.
+ */
+static uint32_t RTI_TimerTargetFind(RTI_TIMER_SERVICE *service, RTI_VlanId vlanId)
+{
+    for (uint32_t i = 0; i < service->targetCnt; i++) {
+        if (service->targets[i].vlanId == vlanId) {
+            return i;
+        }
+    }
+    return RTI_TIMER_SERVICE_VLANS_MAX;
+}
+
+/**
+ * @brief Get the target of a VLAN, resolve and cache it on first use.
+ *
+ * @param service The service.
+ * @param vlanId The VLAN ID.
+ * @param targetOut Pointer to store the target index.
+ * @return RTI_ERR Error code indicating success or failure.
+ * @note the VLAN is resolved and its producer created without the service lock,
+ *       a poster losing the race to cache the same VLAN deletes its producer again.
+ */
+static RTI_ERR RTI_TimerTargetGet(RTI_TIMER_SERVICE *service, RTI_VlanId vlanId, uint8_t *targetOut)
+{
+    RTI_TimerServiceLock(service);
+    uint32_t index = RTI_TimerTargetFind(service, vlanId);
+    bool isFull = (service->targetCnt == RTI_TIMER_SERVICE_VLANS_MAX);
+    RTI_TimerServiceUnlock(service);
+    if (index < RTI_TIMER_SERVICE_VLANS_MAX) {
+        *targetOut = (uint8_t)index;
+        return RTI_OK;
+    }
+    if (isFull == true) {
+        return RTI_ERR_NO_MEMORY;
+    }
+    RTI_TIMER_TARGET target = {.vlanId = vlanId};
+    RTI_ERR err = RTIPriv_VlanSelect(vlanId, &target.desc);
+    if (err != RTI_OK) {
+        return err;
+    }
+    if (target.desc.ifx->sendF == NULL) {
+        return RTI_ERR_NOT_SUPPORTED;
+    }
+    target.producer = target.desc.ifx->createProducerF();
+    if (target.producer == NULL) {
+        return RTI_ERR_FAILED;
+    }
+    RTI_TimerServiceLock(service);
+    index = RTI_TimerTargetFind(service, vlanId);
+    bool isCached = (index == RTI_TIMER_SERVICE_VLANS_MAX && service->targetCnt < RTI_TIMER_SERVICE_VLANS_MAX);
+    if (isCached == true) {
+        index = service->targetCnt++;
+        service->targets[index] = target;
+    }
+    RTI_TimerServiceUnlock(service);
+    if (isCached == false) {
+        target.desc.ifx->deleteProducerF(target.producer);
+    }
+    if (index == RTI_TIMER_SERVICE_VLANS_MAX) {
+        return RTI_ERR_NO_MEMORY;
+    }
+    *targetOut = (uint8_t)index;
+    return RTI_OK;
+}
+
+/**
+ * @brief Timer function of a post, send its message and rearm if periodic.
+ *
+ * @param timer Timer of the post.
+ * @param arg The service.
+ * @note a failed send drops this post only, a periodic post keeps its period.
+ */
+static void RTI_TimerPostExpire(RTI_TIMER *timer, void *arg)
+{
+    RTI_TIMER_SERVICE *service = (RTI_TIMER_SERVICE *)arg;
+    RTI_TIMER_POST *post = (RTI_TIMER_POST *)((uint8_t *)timer - offsetof(RTI_TIMER_POST, timer));
+    RTI_TIMER_TARGET *target = &service->targets[post->target];
+    target->desc.ifx->sendF(target->producer, post->msg, post->size, post->lane);
+    if (post->period > 0) {
+        RTI_TimerStart(&service->wheel, timer, timer->expire + post->period);
+    }
+    else {
+        RTI_TimerPostFree(service, post);
+    }
+}
+
+/**
+ * @brief Milliseconds until a tick of the dedicated thread clock.
+ *
+ * @param service The service.
+ * @param tick The tick, UINT64_MAX to wait for a post.
+ * @return int32_t Timeout of OS wait, -1 if infinite.
+ */
+static int32_t RTI_TimerServiceTimeout(RTI_TIMER_SERVICE *service, uint64_t tick)
+{
+    if (tick == UINT64_MAX) {
+        return -1;
+    }
+    int64_t waitMs = service->startMs + (int64_t)(tick * service->tickMs) - RTIPriv_OsNowMs();
+    if (waitMs <= 0) {
+        return 0;
+    }
+    return (waitMs > INT32_MAX) ? INT32_MAX : (int32_t)waitMs;
+}
+
+/**
+ * @brief Dedicated thread of a service, sleeps until the next expiry of its wheel.
+ *
+ * @param arg The service.
+ * @return void* Always NULL.
+ * @note a post wakes it to sleep again until the earlier deadline.
+ */
+static void *RTI_TimerServiceThread(void *arg)
+{
+    RTI_TIMER_SERVICE *service = (RTI_TIMER_SERVICE *)arg;
+    while (atomic_load_explicit(&service->running, memory_order_acquire) == true) {
+        unsigned seq = atomic_load_explicit(&service->wakeSeq, memory_order_acquire);
+        RTI_TimerServiceLock(service);
+        RTI_TimerWheelAdvance(&service->wheel, RTI_TimerServiceNow(service), NULL);
+        uint64_t next = RTI_TimerWheelNext(&service->wheel);
+        RTI_TimerServiceUnlock(service);
+        RTIPriv_OsWait(&service->wakeSeq, seq, false, RTI_TimerServiceTimeout(service, next));
+    }
+    return NULL;
+}
+
+/* Exported function definitions -------------------------------------------------*/
+
+/**
+ * @brief Initialize a timer wheel.
+ *
+ * @param wheel The wheel.
+ * @param now Current tick.
+ * @return RTI_ERR Error code indicating success or failure.
+ */
+RTI_ERR RTI_TimerWheelInit(RTI_TIMER_WHEEL *wheel, uint64_t now)
+{
+    if (wheel == NULL || now == UINT64_MAX) {
+        return RTI_ERR_INVALID_PARAM;
+    }
+    memset(wheel, 0, sizeof(RTI_TIMER_WHEEL));
+    wheel->tick = now + 1;
+    return RTI_OK;
+}
+
+/**
+ * @brief Get the last tick the wheel advanced to.
+ *
+ * @param wheel The wheel.
+ * @return uint64_t The tick.
+ */
+uint64_t RTI_TimerWheelNow(const RTI_TIMER_WHEEL *wheel)
+{
+    return wheel->tick - 1;
+}
+
+/**
+ * @brief Advance a timer wheel and run expired timers.
+ *
+ * @param wheel The wheel.
+ * @param now Current tick, earlier ticks than last advance are ignored.
+ * @param expiredOut Pointer to store count of run timers, may be NULL.
+ * @return RTI_ERR Error code indicating success or failure.
+ * @note timers run in the caller's context, they may start or cancel
+ *       any timer of the same wheel.
+ */
+RTI_ERR RTI_TimerWheelAdvance(RTI_TIMER_WHEEL *wheel, uint64_t now, size_t *expiredOut)
+{
+    if (wheel == NULL || now == UINT64_MAX) {
+        return RTI_ERR_INVALID_PARAM;
+    }
+    size_t expired = 0;
+    while (wheel->tick <= now) {
+        if (wheel->pending == 0) {
+            wheel->tick = now + 1;
+            break;
+        }
+        uint64_t tick = wheel->tick;
+        uint64_t slot = tick & RTI_TIMER_WHEEL_MASK;
+        for (uint32_t level = 1; slot == 0 && level < RTI_TIMER_WHEEL_LEVELS; level++) {
+            slot = (tick >> (RTI_TIMER_WHEEL_BITS * level)) & RTI_TIMER_WHEEL_MASK;
+            RTI_TimerCascade(wheel, level, slot);
+        }
+        wheel->tick = tick + 1;
+        // detach the slot, timers started by callbacks go to later ticks
+        RTI_TIMER *list = wheel->slots[0][tick & RTI_TIMER_WHEEL_MASK];
+        wheel->slots[0][tick & RTI_TIMER_WHEEL_MASK] = NULL;
+        if (list != NULL) {
+            list->pprev = &list;
+        }
+        while (list != NULL) {
+            RTI_TIMER *timer = list;
+            RTI_TimerUnlink(timer);
+            if (timer->expire > tick) {
+                RTI_TimerPlace(wheel, timer);
+                continue;
+            }
+            wheel->pending--;
+            expired++;
+            timer->expireF(timer, timer->arg);
+        }
+    }
+    if (expiredOut != NULL) {
+        *expiredOut = expired;
+    }
+    return RTI_OK;
+}
+
+/**
+ * @brief Get the earliest tick the wheel has to be advanced to.
+ *
+ * @param wheel The wheel.
+ * @return uint64_t The tick, UINT64_MAX if no timer is pending.
+ * @note it may be earlier than the next expiry: timers of higher levels are only
+ *       moved down when the lowest level wraps, so that tick is reported as well.
+ */
+uint64_t RTI_TimerWheelNext(const RTI_TIMER_WHEEL *wheel)
+{
+    if (wheel == NULL || wheel->pending == 0) {
+        return UINT64_MAX;
+    }
+    uint64_t tick = wheel->tick;
+    while ((tick & RTI_TIMER_WHEEL_MASK) != 0 && wheel->slots[0][tick & RTI_TIMER_WHEEL_MASK] == NULL) {
+        tick++;
+    }
+    return tick;
+}
+
+/**
+ * @brief Initialize a timer.
+ *
+ * @param timer The timer.
+ * @param expireF Function called when the timer expires.
+ * @param arg Argument of expireF.
+ */
+void RTI_TimerInit(RTI_TIMER *timer, RTI_TimerFptr expireF, void *arg)
+{
+    timer->next = NULL;
+    timer->pprev = NULL;
+    timer->expire = 0;
+    timer->expireF = expireF;
+    timer->arg = arg;
+}
+
+/**
+ * @brief Start a timer, or move it if already pending, O(1).
+ *
+ * @param wheel The wheel.
+ * @param timer The timer.
+ * @param expire Tick to expire at, a passed tick expires on next advance.
+ * @return RTI_ERR Error code indicating success or failure.
+ */
+RTI_ERR RTI_TimerStart(RTI_TIMER_WHEEL *wheel, RTI_TIMER *timer, uint64_t expire)
+{
+    if (wheel == NULL || timer == NULL || timer->expireF == NULL) {
+        return RTI_ERR_INVALID_PARAM;
+    }
+    if (timer->pprev != NULL) {
+        RTI_TimerUnlink(timer);
+        wheel->pending--;
+    }
+    timer->expire = expire;
+    RTI_TimerPlace(wheel, timer);
+    wheel->pending++;
+    return RTI_OK;
+}
+
+/**
+ * @brief Stop a pending timer, O(1).
+ *
+ * @param wheel The wheel the timer was started on.
+ * @param timer The timer, nothing is done if not pending.
+ */
+void RTI_TimerCancel(RTI_TIMER_WHEEL *wheel, RTI_TIMER *timer)
+{
+    if (wheel == NULL || timer == NULL || timer->pprev == NULL) {
+        return;
+    }
+    RTI_TimerUnlink(timer);
+    wheel->pending--;
+}
+
+/**
+ * @brief Check if a timer is started and not expired yet.
+ *
+ * @param timer The timer.
+ * @return true The timer is pending.
+ * @return false The timer is stopped.
+ */
+bool RTI_TimerIsPending(const RTI_TIMER *timer)
+{
+    return timer != NULL && timer->pprev != NULL;
+}
+
+/**
+ * @brief Create a timer service.
+ *
+ * @param cfg The configuration.
+ * @param serviceOut Pointer to store the service.
+ * @return RTI_ERR Error code indicating success or failure.
+ */
+RTI_ERR RTI_TimerServiceCreate(const RTI_TIMER_SERVICE_CFG *cfg, RTI_TIMER_SERVICE **serviceOut)
+{
+    if (cfg == NULL || serviceOut == NULL || cfg->postMax == 0 || (cfg->postMax & (cfg->postMax - 1)) != 0
+        || cfg->postMax > ((uint32_t)1 << 16)) {
+        return RTI_ERR_INVALID_PARAM;
+    }
+    size_t postBytes = cfg->postMax * (sizeof(RTI_TIMER_POST) + cfg->msgSizeMax);
+    RTI_TIMER_SERVICE *service = (RTI_TIMER_SERVICE *)calloc(1, sizeof(RTI_TIMER_SERVICE) + postBytes);
+    if (service == NULL) {
+        return RTI_ERR_NO_MEMORY;
+    }
+    RTI_TimerWheelInit(&service->wheel, 0);
+    atomic_flag_clear(&service->lock);
+    atomic_init(&service->wakeSeq, 0);
+    atomic_init(&service->running, false);
+    service->tickMs = (cfg->tickMs > 0) ? cfg->tickMs : 1;
+    service->slotBits = (uint32_t)__builtin_ctz(cfg->postMax);
+    service->msgSizeMax = cfg->msgSizeMax;
+    service->freeHead = RTI_TIMER_POST_NONE;
+    uint8_t *msgs = (uint8_t *)&service->posts[cfg->postMax];
+    for (uint32_t i = cfg->postMax; i > 0; i--) {
+        RTI_TIMER_POST *post = &service->posts[i - 1];
+        RTI_TimerInit(&post->timer, RTI_TimerPostExpire, service);
+        post->msg = msgs + (size_t)(i - 1) * cfg->msgSizeMax;
+        RTI_TimerPostFree(service, post);
+    }
+    *serviceOut = service;
+    return RTI_OK;
+}
+
+/**
+ * @brief Delete a timer service, pending posts are dropped.
+ *
+ * @param service The service.
+ */
+void RTI_TimerServiceDelete(RTI_TIMER_SERVICE *service)
+{
+    if (service == NULL) {
+        return;
+    }
+    RTI_TimerServiceStop(service);
+    for (uint32_t i = 0; i < service->targetCnt; i++) {
+        service->targets[i].desc.ifx->deleteProducerF(service->targets[i].producer);
+    }
+    free(service);
+}
+
+/**
+ * @brief Post a message to a VLAN after a delay, and optionally every period.
+ *
+ * @param service The service.
+ * @param cfg Target VLAN and timing.
+ * @param msg The message, copied into the service.
+ * @param size The message size, at most msgSizeMax.
+ * @param postIdOut Pointer to store ID for RTI_TimerServiceCancel(), may be NULL.
+ * @return RTI_ERR RTI_ERR_QUEUE_FULL if postMax posts are pending.
+ * @note thread-safe, the target VLAN is resolved on its first post outside the service lock.
+ *       wakes the dedicated thread to sleep until the new deadline if it is earlier.
+ */
+RTI_ERR RTI_TimerServicePost(RTI_TIMER_SERVICE *service, const RTI_TIMER_POST_CFG *cfg, const void *msg, size_t size,
+                             uint32_t *postIdOut)
+{
+    if (service == NULL || cfg == NULL || (msg == NULL && size > 0) || size > service->msgSizeMax) {
+        return RTI_ERR_INVALID_PARAM;
+    }
+    uint8_t target = 0;
+    RTI_ERR err = RTI_TimerTargetGet(service, cfg->vlanId, &target);
+    if (err != RTI_OK) {
+        return err;
+    }
+    RTI_TimerServiceLock(service);
+    if (service->freeHead == RTI_TIMER_POST_NONE) {
+        RTI_TimerServiceUnlock(service);
+        return RTI_ERR_QUEUE_FULL;
+    }
+    uint32_t index = service->freeHead;
+    RTI_TIMER_POST *post = &service->posts[index];
+    service->freeHead = post->nextFree;
+    do {
+        post->postId = (++service->generation << service->slotBits) | index;
+    } while (post->postId == 0);
+    post->period = cfg->period;
+    post->size = (uint32_t)size;
+    post->target = target;
+    post->lane = cfg->lane;
+    if (size > 0) {
+        memcpy(post->msg, msg, size);
+    }
+    RTI_TimerStart(&service->wheel, &post->timer, RTI_TimerServiceNow(service) + cfg->delay);
+    if (postIdOut != NULL) {
+        *postIdOut = post->postId;
+    }
+    RTI_TimerServiceUnlock(service);
+    atomic_fetch_add_explicit(&service->wakeSeq, 1, memory_order_release);
+    RTIPriv_OsWake(&service->wakeSeq, 1, false);
+    return RTI_OK;
+}
+
+/**
+ * @brief Cancel a pending post.
+ *
+ * @param service The service.
+ * @param postId ID returned by RTI_TimerServicePost().
+ * @return RTI_ERR RTI_ERR_INVALID_PARAM if the post already finished or was cancelled.
+ */
+RTI_ERR RTI_TimerServiceCancel(RTI_TIMER_SERVICE *service, uint32_t postId)
+{
+    if (service == NULL || postId == 0) {
+        return RTI_ERR_INVALID_PARAM;
+    }
+    RTI_ERR err = RTI_ERR_INVALID_PARAM;
+    RTI_TimerServiceLock(service);
+    RTI_TIMER_POST *post = &service->posts[postId & (((uint32_t)1 << service->slotBits) - 1)];
+    if (post->postId == postId) {
+        RTI_TimerCancel(&service->wheel, &post->timer);
+        RTI_TimerPostFree(service, post);
+        err = RTI_OK;
+    }
+    RTI_TimerServiceUnlock(service);
+    return err;
+}
+
+/**
+ * @brief Drive a service from the caller's event loop.
+ *
+ * @param service The service.
+ * @param now Current tick, counting from 0 at service creation.
+ * @param postedOut Pointer to store count of due posts, may be NULL.
+ * @return RTI_ERR RTI_ERR_NOT_SUPPORTED if the dedicated thread is running.
+ */
+RTI_ERR RTI_TimerServiceTick(RTI_TIMER_SERVICE *service, uint64_t now, size_t *postedOut)
+{
+    if (service == NULL) {
+        return RTI_ERR_INVALID_PARAM;
+    }
+    if (atomic_load_explicit(&service->running, memory_order_relaxed) == true) {
+        return RTI_ERR_NOT_SUPPORTED;
+    }
+    RTI_TimerServiceLock(service);
+    RTI_ERR err = RTI_TimerWheelAdvance(&service->wheel, now, postedOut);
+    RTI_TimerServiceUnlock(service);
+    return err;
+}
+
+/**
+ * @brief Start the dedicated thread of a service, one tick is tickMs.
+ *
+ * @param service The service.
+ * @return RTI_ERR RTI_ERR_NOT_SUPPORTED if OS wait is disabled.
+ * @note the thread sleeps on OS wait until the next expiry, or while no post is pending.
+ */
+RTI_ERR RTI_TimerServiceStart(RTI_TIMER_SERVICE *service)
+{
+    if (service == NULL || atomic_load(&service->running) == true) {
+        return RTI_ERR_INVALID_PARAM;
+    }
+    RTI_TimerServiceLock(service);
+    service->startMs = RTIPriv_OsNowMs() - (int64_t)(RTI_TimerWheelNow(&service->wheel) * service->tickMs);
+    atomic_store(&service->running, true);
+    RTI_TimerServiceUnlock(service);
+    RTI_ERR err = RTIPriv_OsThreadCreate(&service->thread, RTI_TimerServiceThread, service);
+    if (err != RTI_OK) {
+        atomic_store(&service->running, false);
+    }
+    return err;
+}
+
+/**
+ * @brief Stop the dedicated thread of a service, pending posts are kept.
+ *
+ * @param service The service.
+ * @return RTI_ERR RTI_ERR_INVALID_PARAM if the thread is not running.
+ */
+RTI_ERR RTI_TimerServiceStop(RTI_TIMER_SERVICE *service)
+{
+    if (service == NULL || atomic_exchange(&service->running, false) == false) {
+        return RTI_ERR_INVALID_PARAM;
+    }
+    atomic_fetch_add_explicit(&service->wakeSeq, 1, memory_order_release);
+    RTIPriv_OsWake(&service->wakeSeq, 1, false);
+    RTIPriv_OsThreadJoin(service->thread);
+    return RTI_OK;
+}
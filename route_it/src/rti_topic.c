@@ -0,0 +1,648 @@
+/**
+ * @file rti_topic.c
+ * @author CYK-Dot
+ * @brief Hierarchical topic router implementation.
+ * @version 0.1
+ * @date 2026-10-16
+ *
+ * @copyright Copyright (c) 2025 CYK-Dot, MIT License.
+ */
+
+/* Header import ------------------------------------------------------------------*/
+#include "rti_topic.h"
+#include <stdbool.h>
+#include <stdlib.h>
+#include <string.h>
+
+/* Private typedef ----------------------------------------------------------------*/
+
+/**
+ * @brief Trie node, a literal node holds one or more levels in label.
+ * @note chains of literal nodes without subscriptions are merged,
+ *       so a lookup visits one node per branch point, not per level.
+ */
+typedef struct rti_topic_node {
+    char *label;                        /* literal levels joined by '/', "+" or "#" */
+    size_t labelLen;
+    struct rti_topic_node *next;        /* next literal sibling */
+    struct rti_topic_node *child;       /* first literal child */
+    struct rti_topic_node *plus;        /* "+" child */
+    struct rti_topic_node *hash;        /* "#" child */
+    RTI_VlanId *vlans;
+    uint16_t vlanCnt;
+    uint16_t vlanCap;
+} RTI_TOPIC_NODE;
+
+/**
+ * @brief Match cache slot of one topic.
+ *
+ */
+typedef struct {
+    bool valid;
+    uint8_t vlanCnt;
+    uint32_t hash;
+    char topic[RTI_TOPIC_CACHE_TOPIC_LEN];
+    RTI_VlanId vlans[RTI_TOPIC_CACHE_VLANS];
+} RTI_TOPIC_CACHE;
+
+struct rti_topic_router {
+    RTI_TOPIC_NODE root;
+    RTI_VlanId *scratch;                /* match result of current lookup */
+    size_t scratchCnt;
+    size_t scratchCap;
+    RTI_TOPIC_CACHE cache[RTI_TOPIC_CACHE_SIZE];
+};
+
+/* Private defines ----------------------------------------------------------------*/
+
+/**
+ * @brief Check if a level is a single wildcard character.
+ *
+ * @param LEVEL[const char*] Start of the level.
+ * @param LEN[size_t] Level length.
+ * @param WILDCARD[char] '+' or '#'.
+ */
+#define RTI_TOPIC_IS_WILDCARD(LEVEL, LEN, WILDCARD) ((LEN) == 1 && (LEVEL)[0] == (WILDCARD))
+
+/* Global variables ---------------------------------------------------------------*/
+
+/* Private function prototypes ---------------------------------------------------*/
+
+/* Exported function prototypes --------------------------------------------------*/
+
+/* Private function definitions --------------------------------------------------*/
+
+/**
+ * @brief Get the level after the first len characters.
+ *
+ * @param rest Start of remaining levels.
+ * @param len Length of consumed levels, must end at a level boundary.
+ * @return const char* Start of next level, NULL if no level remains.
+ */
+static inline const char *RTI_TopicNext(const char *rest, size_t len)
+{
+    return (rest[len] == '/') ? rest + len + 1 : NULL;
+}
+
+/**
+ * @brief Check a subscription filter, or a topic if it must have no wildcard.
+ *
+ * @param str The filter or topic.
+ * @param isFilter true if wildcards are allowed.
+ * @return true The string is valid.
+ * @return false The string is invalid.
+ */
+static bool RTI_TopicIsValid(const char *str, bool isFilter)
+{
+    if (str == NULL || str[0] == '\0') {
+        return false;
+    }
+    for (const char *rest = str; rest != NULL;) {
+        size_t len = strcspn(rest, "/");
+        const char *wildcard = (const char *)memchr(rest, '+', len);
+        wildcard = (wildcard != NULL) ? wildcard : (const char *)memchr(rest, '#', len);
+        if (wildcard != NULL) {
+            if (isFilter == false || len != 1) {
+                return false;
+            }
+            if (rest[0] == '#' && rest[1] != '\0') {
+                return false;
+            }
+        }
+        rest = RTI_TopicNext(rest, len);
+    }
+    return true;
+}
+
+/**
+ * @brief Check if a topic matches a subscription filter.
+ *
+ * @param filter The filter.
+ * @param topic The topic.
+ * @return true The topic matches.
+ * @return false The topic does not match.
+ */
+static bool RTI_TopicFilterMatch(const char *filter, const char *topic)
+{
+    for (;;) {
+        size_t fl = strcspn(filter, "/");
+        size_t tl = strcspn(topic, "/");
+        if (RTI_TOPIC_IS_WILDCARD(filter, fl, '#') == true) {
+            return true;
+        }
+        if (RTI_TOPIC_IS_WILDCARD(filter, fl, '+') == false && (fl != tl || strncmp(filter, topic, fl) != 0)) {
+            return false;
+        }
+        bool filterEnd = (filter[fl] == '\0');
+        bool topicEnd = (topic[tl] == '\0');
+        if (filterEnd == true || topicEnd == true) {
+            // "a/#" also matches "a"
+            return (filterEnd == topicEnd) || (topicEnd == true && strcmp(filter + fl, "/#") == 0);
+        }
+        filter += fl + 1;
+        topic += tl + 1;
+    }
+}
+
+/**
+ * @brief Get length of leading literal levels, up to the first wildcard level.
+ *
+ * @param rest Start of remaining levels, first level must be literal.
+ * @return size_t Length in characters, excluding the trailing '/'.
+ */
+static size_t RTI_TopicLiteralRun(const char *rest)
+{
+    size_t pos = 0;
+    for (;;) {
+        size_t len = strcspn(rest + pos, "/");
+        if (RTI_TOPIC_IS_WILDCARD(rest + pos, len, '+') == true || RTI_TOPIC_IS_WILDCARD(rest + pos, len, '#') == true) {
+            return pos - 1;
+        }
+        if (rest[pos + len] == '\0') {
+            return pos + len;
+        }
+        pos += len + 1;
+    }
+}
+
+/**
+ * @brief Get length of whole levels shared by a node label and a literal run.
+ *
+ * @param label The node label.
+ * @param labelLen The label length.
+ * @param run The literal run.
+ * @param runLen The run length.
+ * @return size_t Length of shared levels, excluding the trailing '/'.
+ */
+static size_t RTI_TopicCommonLen(const char *label, size_t labelLen, const char *run, size_t runLen)
+{
+    size_t pos = 0;
+    size_t common = 0;
+    for (;;) {
+        size_t la = strcspn(label + pos, "/");
+        size_t lb = strcspn(run + pos, "/");
+        if (la != lb || strncmp(label + pos, run + pos, la) != 0) {
+            return common;
+        }
+        common = pos + la;
+        if (common >= labelLen || common >= runLen) {
+            return common;
+        }
+        pos = common + 1;
+    }
+}
+
+/**
+ * @brief Check if a literal label is the leading levels of rest.
+ *
+ * @param node The literal node.
+ * @param rest Start of remaining levels.
+ * @return true Label matches.
+ * @return false Label does not match.
+ */
+static inline bool RTI_TopicLabelMatch(const RTI_TOPIC_NODE *node, const char *rest)
+{
+    return strncmp(node->label, rest, node->labelLen) == 0
+        && (rest[node->labelLen] == '/' || rest[node->labelLen] == '\0');
+}
+
+/**
+ * @brief Create a node.
+ *
+ * @param label The label, not NUL terminated.
+ * @param labelLen The label length.
+ * @return RTI_TOPIC_NODE* The node, NULL if no memory.
+ */
+static RTI_TOPIC_NODE *RTI_TopicNodeCreate(const char *label, size_t labelLen)
+{
+    RTI_TOPIC_NODE *node = (RTI_TOPIC_NODE *)calloc(1, sizeof(RTI_TOPIC_NODE));
+    if (node == NULL) {
+        return NULL;
+    }
+    node->label = (char *)malloc(labelLen + 1);
+    if (node->label == NULL) {
+        free(node);
+        return NULL;
+    }
+    memcpy(node->label, label, labelLen);
+    node->label[labelLen] = '\0';
+    node->labelLen = labelLen;
+    return node;
+}
+
+/**
+ * @brief Free a node and all nodes below it.
+ *
+ * @param node The node.
+ */
+static void RTI_TopicNodeFree(RTI_TOPIC_NODE *node)
+{
+    while (node != NULL) {
+        RTI_TOPIC_NODE *next = node->next;
+        RTI_TopicNodeFree(node->child);
+        RTI_TopicNodeFree(node->plus);
+        RTI_TopicNodeFree(node->hash);
+        free(node->vlans);
+        free(node->label);
+        free(node);
+        node = next;
+    }
+}
+
+/**
+ * @brief Get the wildcard child of a node, create it if absent.
+ *
+ * @param link Link to the wildcard child.
+ * @param wildcard "+" or "#".
+ * @return RTI_TOPIC_NODE* The child, NULL if no memory.
+ */
+static RTI_TOPIC_NODE *RTI_TopicWildcardGet(RTI_TOPIC_NODE **link, const char *wildcard)
+{
+    if (*link == NULL) {
+        *link = RTI_TopicNodeCreate(wildcard, 1);
+    }
+    return *link;
+}
+
+/**
+ * @brief Get the node of a subscription filter, create missing nodes.
+ *
+ * @param node The root node.
+ * @param rest The filter.
+ * @return RTI_TOPIC_NODE* The node, NULL if no memory.
+ */
+static RTI_TOPIC_NODE *RTI_TopicInsert(RTI_TOPIC_NODE *node, const char *rest)
+{
+    while (rest != NULL && node != NULL) {
+        size_t len = strcspn(rest, "/");
+        if (RTI_TOPIC_IS_WILDCARD(rest, len, '#') == true) {
+            return RTI_TopicWildcardGet(&node->hash, "#");
+        }
+        if (RTI_TOPIC_IS_WILDCARD(rest, len, '+') == true) {
+            node = RTI_TopicWildcardGet(&node->plus, "+");
+            rest = RTI_TopicNext(rest, len);
+            continue;
+        }
+        size_t runLen = RTI_TopicLiteralRun(rest);
+        RTI_TOPIC_NODE **link = &node->child;
+        while (*link != NULL && (strcspn((*link)->label, "/") != len || strncmp((*link)->label, rest, len) != 0)) {
+            link = &(*link)->next;
+        }
+        if (*link == NULL) {
+            *link = RTI_TopicNodeCreate(rest, runLen);
+            node = *link;
+            rest = RTI_TopicNext(rest, runLen);
+            continue;
+        }
+        RTI_TOPIC_NODE *child = *link;
+        size_t common = RTI_TopicCommonLen(child->label, child->labelLen, rest, runLen);
+        if (common < child->labelLen) {
+            // split child at the last shared level
+            RTI_TOPIC_NODE *mid = RTI_TopicNodeCreate(child->label, common);
+            if (mid == NULL) {
+                return NULL;
+            }
+            memmove(child->label, child->label + common + 1, child->labelLen - common);
+            child->labelLen -= common + 1;
+            mid->child = child;
+            mid->next = child->next;
+            child->next = NULL;
+            *link = mid;
+        }
+        node = *link;
+        rest = RTI_TopicNext(rest, common);
+    }
+    return node;
+}
+
+/**
+ * @brief Remove a subscription below a node and compress the path back.
+ *
+ * @param router The router.
+ * @param link Link to the node reached after consumed levels.
+ * @param rest Remaining levels of the filter, NULL if none.
+ * @param vlanId The VLAN ID.
+ * @return RTI_ERR RTI_ERR_INVALID_PARAM if the subscription does not exist.
+ */
+static RTI_ERR RTI_TopicRemove(RTI_TOPIC_ROUTER *router, RTI_TOPIC_NODE **link, const char *rest, RTI_VlanId vlanId)
+{
+    RTI_TOPIC_NODE *node = *link;
+    RTI_ERR err = RTI_ERR_INVALID_PARAM;
+    if (rest == NULL) {
+        for (uint16_t i = 0; i < node->vlanCnt; i++) {
+            if (node->vlans[i] == vlanId) {
+                node->vlans[i] = node->vlans[--node->vlanCnt];
+                err = RTI_OK;
+                break;
+            }
+        }
+    }
+    else {
+        size_t len = strcspn(rest, "/");
+        if (RTI_TOPIC_IS_WILDCARD(rest, len, '#') == true) {
+            err = (node->hash != NULL) ? RTI_TopicRemove(router, &node->hash, NULL, vlanId) : err;
+        }
+        else if (RTI_TOPIC_IS_WILDCARD(rest, len, '+') == true) {
+            err = (node->plus != NULL) ? RTI_TopicRemove(router, &node->plus, RTI_TopicNext(rest, len), vlanId) : err;
+        }
+        else {
+            RTI_TOPIC_NODE **itr = &node->child;
+            while (*itr != NULL && RTI_TopicLabelMatch(*itr, rest) == false) {
+                itr = &(*itr)->next;
+            }
+            if (*itr != NULL) {
+                err = RTI_TopicRemove(router, itr, RTI_TopicNext(rest, (*itr)->labelLen), vlanId);
+            }
+        }
+    }
+    if (err != RTI_OK || node == &router->root || node->vlanCnt > 0) {
+        return err;
+    }
+    if (node->child == NULL && node->plus == NULL && node->hash == NULL) {
+        *link = node->next;
+        node->next = NULL;
+        RTI_TopicNodeFree(node);
+    }
+    else if (node->label[0] != '+' && node->label[0] != '#' && node->plus == NULL && node->hash == NULL
+             && node->child != NULL && node->child->next == NULL) {
+        // merge the only literal child back into node
+        RTI_TOPIC_NODE *child = node->child;
+        char *label = (char *)malloc(node->labelLen + child->labelLen + 2);
+        if (label == NULL) {
+            return RTI_OK;
+        }
+        memcpy(label, node->label, node->labelLen);
+        label[node->labelLen] = '/';
+        memcpy(label + node->labelLen + 1, child->label, child->labelLen + 1);
+        free(node->label);
+        free(node->vlans);
+        node->label = label;
+        node->labelLen += child->labelLen + 1;
+        node->child = child->child;
+        node->plus = child->plus;
+        node->hash = child->hash;
+        node->vlans = child->vlans;
+        node->vlanCnt = child->vlanCnt;
+        node->vlanCap = child->vlanCap;
+        free(child->label);
+        free(child);
+    }
+    return RTI_OK;
+}
+
+/**
+ * @brief Add VLANs of a node to the lookup result, skip duplicates.
+ *
+ * @param router The router.
+ * @param node The matched node.
+ * @return RTI_ERR Error code indicating success or failure.
+ */
+static RTI_ERR RTI_TopicCollect(RTI_TOPIC_ROUTER *router, const RTI_TOPIC_NODE *node)
+{
+    for (uint16_t i = 0; i < node->vlanCnt; i++) {
+        bool isDup = false;
+        for (size_t j = 0; j < router->scratchCnt && isDup == false; j++) {
+            isDup = (router->scratch[j] == node->vlans[i]);
+        }
+        if (isDup == true) {
+            continue;
+        }
+        if (router->scratchCnt == router->scratchCap) {
+            size_t cap = (router->scratchCap == 0) ? 8 : router->scratchCap * 2;
+            RTI_VlanId *scratch = (RTI_VlanId *)realloc(router->scratch, cap * sizeof(RTI_VlanId));
+            if (scratch == NULL) {
+                return RTI_ERR_NO_MEMORY;
+            }
+            router->scratch = scratch;
+            router->scratchCap = cap;
+        }
+        router->scratch[router->scratchCnt++] = node->vlans[i];
+    }
+    return RTI_OK;
+}
+
+/**
+ * @brief Collect VLANs of all filters below a node matching the remaining levels.
+ *
+ * @param router The router.
+ * @param node The node reached after consumed levels.
+ * @param rest Remaining levels of the topic, NULL if none.
+ * @return RTI_ERR Error code indicating success or failure.
+ */
+static RTI_ERR RTI_TopicMatch(RTI_TOPIC_ROUTER *router, const RTI_TOPIC_NODE *node, const char *rest)
+{
+    RTI_ERR err = RTI_OK;
+    if (node->hash != NULL) {
+        err = RTI_TopicCollect(router, node->hash);
+    }
+    if (err != RTI_OK || rest == NULL) {
+        return (err == RTI_OK) ? RTI_TopicCollect(router, node) : err;
+    }
+    size_t len = strcspn(rest, "/");
+    if (node->plus != NULL) {
+        err = RTI_TopicMatch(router, node->plus, RTI_TopicNext(rest, len));
+    }
+    for (const RTI_TOPIC_NODE *itr = node->child; itr != NULL && err == RTI_OK; itr = itr->next) {
+        if (RTI_TopicLabelMatch(itr, rest) == true) {
+            return RTI_TopicMatch(router, itr, RTI_TopicNext(rest, itr->labelLen));
+        }
+    }
+    return err;
+}
+
+/**
+ * @brief Hash a topic for the match cache, FNV-1a.
+ *
+ * @param topic The topic.
+ * @param lenOut Pointer to store the topic length.
+ * @return uint32_t The hash.
+ */
+static uint32_t RTI_TopicHash(const char *topic, size_t *lenOut)
+{
+    uint32_t hash = 2166136261u;
+    size_t len = 0;
+    for (; topic[len] != '\0'; len++) {
+        hash = (hash ^ (uint8_t)topic[len]) * 16777619u;
+    }
+    *lenOut = len;
+    return hash;
+}
+
+/**
+ * @brief Drop cached results of topics matching a changed filter.
+ *
+ * @param router The router.
+ * @param filter The filter.
+ */
+static void RTI_TopicCacheInvalidate(RTI_TOPIC_ROUTER *router, const char *filter)
+{
+    for (size_t i = 0; i < RTI_TOPIC_CACHE_SIZE; i++) {
+        RTI_TOPIC_CACHE *slot = &router->cache[i];
+        if (slot->valid == true && RTI_TopicFilterMatch(filter, slot->topic) == true) {
+            slot->valid = false;
+        }
+    }
+}
+
+/**
+ * @brief Write a lookup result to caller buffer.
+ *
+ * @param vlans The VLAN IDs.
+ * @param found The VLAN count.
+ * @param vlanOut Buffer to store VLAN IDs.
+ * @param count [in] buffer length, [out] VLAN count.
+ * @return RTI_ERR see RTI_TopicLookup().
+ */
+static RTI_ERR RTI_TopicEmit(const RTI_VlanId *vlans, size_t found, RTI_VlanId *vlanOut, size_t *count)
+{
+    size_t capacity = *count;
+    if (found > 0 && capacity > 0) {
+        memcpy(vlanOut, vlans, ((found < capacity) ? found : capacity) * sizeof(RTI_VlanId));
+    }
+    *count = found;
+    if (found == 0) {
+        return RTI_ERR_OBJECT_EMPTY;
+    }
+    return (found > capacity) ? RTI_ERR_INVALID_PARAM : RTI_OK;
+}
+
+/* Exported function definitions -------------------------------------------------*/
+
+/**
+ * @brief Create a topic router.
+ *
+ * @param routerOut Pointer to store the router.
+ * @return RTI_ERR Error code indicating success or failure.
+ */
+RTI_ERR RTI_TopicCreate(RTI_TOPIC_ROUTER **routerOut)
+{
+    if (routerOut == NULL) {
+        return RTI_ERR_INVALID_PARAM;
+    }
+    RTI_TOPIC_ROUTER *router = (RTI_TOPIC_ROUTER *)calloc(1, sizeof(RTI_TOPIC_ROUTER));
+    if (router == NULL) {
+        return RTI_ERR_NO_MEMORY;
+    }
+    router->root.label = (char *)"";
+    *routerOut = router;
+    return RTI_OK;
+}
+
+/**
+ * @brief Delete a topic router and all its subscriptions.
+ *
+ * @param router The router.
+ */
+void RTI_TopicDelete(RTI_TOPIC_ROUTER *router)
+{
+    if (router == NULL) {
+        return;
+    }
+    RTI_TopicNodeFree(router->root.child);
+    RTI_TopicNodeFree(router->root.plus);
+    RTI_TopicNodeFree(router->root.hash);
+    free(router->root.vlans);
+    free(router->scratch);
+    free(router);
+}
+
+/**
+ * @brief Deliver topics matching a filter to a VLAN.
+ *
+ * @param router The router.
+ * @param filter The subscription filter, like "sensor/imu/+/raw" or "sensor/#".
+ * @param vlanId The VLAN ID.
+ * @return RTI_ERR Error code indicating success or failure.
+ * @note subscribing the same filter to the same VLAN twice has no effect.
+ */
+RTI_ERR RTI_TopicSubscribe(RTI_TOPIC_ROUTER *router, const char *filter, RTI_VlanId vlanId)
+{
+    if (router == NULL || RTI_TopicIsValid(filter, true) == false) {
+        return RTI_ERR_INVALID_PARAM;
+    }
+    RTI_TOPIC_NODE *node = RTI_TopicInsert(&router->root, filter);
+    if (node == NULL) {
+        return RTI_ERR_NO_MEMORY;
+    }
+    for (uint16_t i = 0; i < node->vlanCnt; i++) {
+        if (node->vlans[i] == vlanId) {
+            return RTI_OK;
+        }
+    }
+    if (node->vlanCnt == node->vlanCap) {
+        if (node->vlanCap == UINT16_MAX) {
+            return RTI_ERR_NO_MEMORY;
+        }
+        uint16_t cap = (node->vlanCap == 0) ? 2 : ((node->vlanCap > UINT16_MAX / 2) ? UINT16_MAX : node->vlanCap * 2);
+        RTI_VlanId *vlans = (RTI_VlanId *)realloc(node->vlans, cap * sizeof(RTI_VlanId));
+        if (vlans == NULL) {
+            return RTI_ERR_NO_MEMORY;
+        }
+        node->vlans = vlans;
+        node->vlanCap = cap;
+    }
+    node->vlans[node->vlanCnt++] = vlanId;
+    RTI_TopicCacheInvalidate(router, filter);
+    return RTI_OK;
+}
+
+/**
+ * @brief Stop delivering topics matching a filter to a VLAN.
+ *
+ * @param router The router.
+ * @param filter The subscription filter, same as subscribed.
+ * @param vlanId The VLAN ID.
+ * @return RTI_ERR RTI_ERR_INVALID_PARAM if the subscription does not exist.
+ */
+RTI_ERR RTI_TopicUnsubscribe(RTI_TOPIC_ROUTER *router, const char *filter, RTI_VlanId vlanId)
+{
+    if (router == NULL || RTI_TopicIsValid(filter, true) == false) {
+        return RTI_ERR_INVALID_PARAM;
+    }
+    RTI_TOPIC_NODE *root = &router->root;
+    RTI_ERR err = RTI_TopicRemove(router, &root, filter, vlanId);
+    if (err == RTI_OK) {
+        RTI_TopicCacheInvalidate(router, filter);
+    }
+    return err;
+}
+
+/**
+ * @brief Decide destination VLANs of a topic.
+ *
+ * @param router The router.
+ * @param topic The topic, must not contain wildcards.
+ * @param vlanOut Buffer to store VLAN IDs, without duplicates.
+ * @param count [in] buffer length, [out] VLAN count.
+ * @return RTI_ERR RTI_ERR_OBJECT_EMPTY if no filter matches,
+ *                 RTI_ERR_INVALID_PARAM with count set to the VLAN count if buffer is too short.
+ * @note results of recent topics are cached until a matching filter changes.
+ */
+RTI_ERR RTI_TopicLookup(RTI_TOPIC_ROUTER *router, const char *topic, RTI_VlanId *vlanOut, size_t *count)
+{
+    if (router == NULL || count == NULL || (vlanOut == NULL && *count > 0) || RTI_TopicIsValid(topic, false) == false) {
+        return RTI_ERR_INVALID_PARAM;
+    }
+    size_t len = 0;
+    uint32_t hash = RTI_TopicHash(topic, &len);
+    RTI_TOPIC_CACHE *slot = &router->cache[hash & (RTI_TOPIC_CACHE_SIZE - 1)];
+    if (slot->valid == true && slot->hash == hash && strcmp(slot->topic, topic) == 0) {
+        return RTI_TopicEmit(slot->vlans, slot->vlanCnt, vlanOut, count);
+    }
+    router->scratchCnt = 0;
+    RTI_ERR err = RTI_TopicMatch(router, &router->root, topic);
+    if (err != RTI_OK) {
+        return err;
+    }
+    if (len < RTI_TOPIC_CACHE_TOPIC_LEN && router->scratchCnt <= RTI_TOPIC_CACHE_VLANS) {
+        slot->valid = true;
+        slot->hash = hash;
+        slot->vlanCnt = (uint8_t)router->scratchCnt;
+        memcpy(slot->topic, topic, len + 1);
+        // scratch is not allocated until a filter matches, memcpy() needs valid pointers even for 0 bytes
+        if (router->scratchCnt > 0) {
+            memcpy(slot->vlans, router->scratch, router->scratchCnt * sizeof(RTI_VlanId));
+        }
+    }
+    return RTI_TopicEmit(router->scratch, router->scratchCnt, vlanOut, count);
+}
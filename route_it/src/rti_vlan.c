@@ -1,308 +1,469 @@
-/**
- * @file rti_vlan.c
- * @author CYK-Dot
- * @brief RouteIt-Framework VLAN module implementation.
- * @version 0.1
- * @date 2025-10-04
- *
- * @copyright Copyright (c) 2025 CYK-Dot, MIT License.
- */
-
-/* Header import ------------------------------------------------------------------*/
-#include "rti_vlan.h"
-#include <string.h>
-#include <stdbool.h>
-
-/* Private typedef ----------------------------------------------------------------*/
-
-/* Private defines ----------------------------------------------------------------*/
-
-/**
- * @brief Get the ID of VLAN description from VLAN record.
- * 
- * @param RECORD[RTI_VLAN_RECORD*] The VLAN record from VLAN table.
- * @return RTI_VlanId The ID of VLAN description.
- */
-#define RTI_VLAN_GET_DESC_ID(RECORD) ((RTI_VLAN_DESC*)(RECORD))->id
-
-/**
- * @brief Get the pointer to VLAN description from VLAN record.
- * 
- * @param RECORD[RTI_VLAN_RECORD*] The VLAN record from VLAN table.
- * @return RTI_VLAN_DESC* The reference of VLAN description.
- */
-#define RTI_VLAN_GET_DESC_REF(RECORD) ((RTI_VLAN_DESC*)(RECORD))
-
-/* Global variables ---------------------------------------------------------------*/
-
-/* external variables from linker script */
-extern RTI_VLAN_RECORD __start_rti_vlan[]; 
-extern RTI_VLAN_RECORD __end_rti_vlan[];
-#if RTI_ENABLE_DYNAMIC_VLAN == 1
-static RTI_VLAN_RECORD *g_RTI_vlanTableStartPtr = __start_rti_vlan;
-static RTI_VLAN_RECORD *g_RTI_vlanTableEndPtr = __end_rti_vlan;
-static size_t g_RTI_vlanRecordUsedCnt =0;
-#endif
-
-/* Private function prototypes ---------------------------------------------------*/
-
-/* Exported function prototypes --------------------------------------------------*/
-
-/* Private function definitions --------------------------------------------------*/
-
-/**
- * @brief Check if the dynamic VLAN table is uninitialized.
- * 
- * @return true The dynamic VLAN table is uninitialized.
- * @return false The dynamic VLAN table is initialized.
- */
-static inline bool RTI_VlanIsDynamicUninitialized(void)
-{
-    return (g_RTI_vlanTableStartPtr == __start_rti_vlan || g_RTI_vlanTableEndPtr == __end_rti_vlan);
-}
-
-/**
- * @brief Get record count of VLAN table.
- * 
- * @return size_t The record count of VLAN table.
- * @note this function should be called after dynamic table setup.
- */
-static inline size_t RTI_VlanGetRecordCount(RTI_VLAN_RECORD *recordStart, RTI_VLAN_RECORD *recordEnd)
-{
-    return (((size_t)(recordEnd) - (size_t)(recordStart)) / sizeof(RTI_VLAN_RECORD));
-}
-
-/* Exported function definitions -------------------------------------------------*/
-
-/**
- * @brief Select a VLAN by ID.
- * 
- * @param vlanId The ID of the VLAN to select.
- * @param vlanOut Pointer to store the selected VLAN description.
- * @return RTI_ERR Error code indicating success or failure.
- * @note this function is only for RTI internal use.
- * @warning do not pass pointer variable to vlanOut.
- *          instead, you shold pass the address of RTI_VLAN_DESC variable
- */
-RTI_ERR RTIPriv_VlanSelect(RTI_VlanId vlanId, RTI_VLAN_DESC *descOut)
-{
-    RTI_ERR err = RTI_OK;
-    #if RTI_ENABLE_DYNAMIC_VLAN == 1
-        RTI_VLAN_RECORD *itr = g_RTI_vlanTableStartPtr;
-        RTI_VLAN_RECORD *end = g_RTI_vlanTableEndPtr;
-    #else
-        RTI_VLAN_RECORD *itr = __start_rti_vlan;
-        RTI_VLAN_RECORD *end = __end_rti_vlan;
-    #endif
-    if (itr == end) {
-        return RTI_ERR_OBJECT_EMPTY;
-    }
-    while (itr < end) {
-        // data may unregister,skip it
-        if (*itr == NULL) {
-            itr++;
-            continue;
-        }
-        if (RTI_VLAN_GET_DESC_ID(*itr) == vlanId) {
-            // copy VLAN description from record to output
-            memcpy(descOut, RTI_VLAN_GET_DESC_REF(*itr), sizeof(RTI_VLAN_DESC));
-            break;
-        }
-        itr++;
-    }
-    if (itr == end) {
-        err = RTI_ERR_INVALID_PARAM;
-    }
-    return err;
-}
-
-#if RTI_ENABLE_DYNAMIC_VLAN == 1
-/**
- * @brief Setup the dynamic VLAN table.
- * 
- * @param start Pointer to the start of the VLAN table.
- * @param sizeBytes Size of the VLAN table in bytes.
- * @return RTI_ERR Error code indicating success or failure.
- * 
- * @note start is recommended to be aligned to RTI_VLAN_RECORD size.
- *       eg. in C11,use aligned_alloc() to allocate aligned memory
- */
-RTI_ERR RTI_VlanDynamicSetup(void *start, size_t sizeBytes)
-{
-    size_t recordCntOld = 0;
-    // static table do not have record count,as it is always filled
-    if (RTI_VlanIsDynamicUninitialized() == true) {
-        recordCntOld = RTI_VlanGetRecordCount(__start_rti_vlan, __end_rti_vlan);
-    }
-    else {
-        recordCntOld = g_RTI_vlanRecordUsedCnt;
-    }
-    // check if table size is enough
-    if (start == NULL) {
-        return RTI_ERR_INVALID_PARAM;
-    }
-    else if (sizeBytes < RTI_VLAN_VLANTABLE_SIZE(recordCntOld)) {
-        return RTI_ERR_VLANTABLE_TOO_SHORT;
-    }
-    // reset new table
-    memset(start, 0, sizeBytes);
-    // copy to new table
-    memcpy(start, g_RTI_vlanTableStartPtr, RTI_VLAN_VLANTABLE_SIZE(recordCntOld));
-    g_RTI_vlanTableStartPtr = start;
-    g_RTI_vlanTableEndPtr = (RTI_VLAN_RECORD*)(start + sizeBytes);
-    g_RTI_vlanRecordUsedCnt = recordCntOld;
-    return RTI_OK;
-}
-
-/**
- * @brief Register a dynamic VLAN.
- * 
- * @param vlan Pointer to the VLAN description to register.
- * @return RTI_ERR Error code indicating success or failure.
- * @warning 
- *       vlanDesc should be a pointer to a global/static/heap variables,
- *       do not pass a pointer to a stack variable.
- *       because the VLAN-Table do not copy the VLAN description,
- *       it only store the pointer to the VLAN description.
- */
-RTI_ERR RTI_VlanDynamicRegister(RTI_VLAN_DESC *vlanDesc)
-{
-    if (vlanDesc == NULL)
-    {
-        return RTI_ERR_INVALID_PARAM;
-    }
-    else if (g_RTI_vlanRecordUsedCnt >= RTI_VlanGetRecordCount(g_RTI_vlanTableStartPtr, g_RTI_vlanTableEndPtr))
-    {
-        return RTI_ERR_VLANTABLE_OVERFLOW;
-    }
-    else if (RTI_VlanIsDynamicUninitialized() == true)
-    {
-        return RTI_ERR_VLANTABLE_NOT_SETUP;
-    }
-    g_RTI_vlanTableStartPtr[g_RTI_vlanRecordUsedCnt++] = (RTI_VLAN_RECORD)vlanDesc;
-    return RTI_OK;
-}
-
-/**
- * @brief Check if a VLAN is registered.
- * 
- * @param vlan Pointer to the VLAN description to check.
- * @return RTI_ERR Error code indicating success or failure.
- */
-RTI_ERR RTI_VlanDynamicIsRegister(const RTI_VLAN_DESC *vlan)
-{
-    if (vlan == NULL)
-    {
-        return RTI_ERR_INVALID_PARAM;
-    }
-    RTI_VLAN_RECORD *itr = g_RTI_vlanTableStartPtr;
-    RTI_VLAN_RECORD *end = g_RTI_vlanTableEndPtr;
-    while (itr < end) {
-        if (RTI_VLAN_GET_DESC_ID(*itr) == RTI_VLAN_GET_DESC_ID((RTI_VLAN_RECORD)vlan)) {
-            return RTI_OK;
-        }
-        itr++;
-    }
-    return RTI_ERR_INVALID_PARAM;
-}
-
-/**
- * @brief Get the number of free VLAN records.
- * 
- * @param freeRecord Pointer to store the number of free VLAN records.
- * @return RTI_ERR Error code indicating success or failure.
- */
-RTI_ERR RTI_VlanDynamicGetFreeCount(size_t *freeRecord)
-{
-    if (freeRecord == NULL)
-    {
-        return RTI_ERR_INVALID_PARAM;
-    }
-    if (RTI_VlanIsDynamicUninitialized() == true)
-    {
-        *freeRecord = 0;
-        return RTI_ERR_VLANTABLE_NOT_SETUP;
-    }
-    *freeRecord = RTI_VlanGetRecordCount(g_RTI_vlanTableStartPtr, g_RTI_vlanTableEndPtr) - g_RTI_vlanRecordUsedCnt;
-    return RTI_OK;
-}
-
-/**
- * @brief Get the number of all VLAN records.
- * 
- * @param allRecordCount Pointer to store the number of all VLAN records.
- * @return RTI_ERR Error code indicating success or failure.
- */
-RTI_ERR RTI_VlanDynamicGetAllCount(size_t *allRecordCount)
-{
-    if (allRecordCount == NULL)
-    {
-        return RTI_ERR_INVALID_PARAM;
-    }
-    if (RTI_VlanIsDynamicUninitialized() == true)
-    {
-        *allRecordCount = 0;
-        return RTI_ERR_VLANTABLE_NOT_SETUP;
-    }
-    *allRecordCount = RTI_VlanGetRecordCount(g_RTI_vlanTableStartPtr, g_RTI_vlanTableEndPtr);
-    return RTI_OK;
-}
-#endif
-
-/**
- * @brief Get the pointer to VLAN table start.
- * 
- * @return RTI_VLAN_RECORD* The pointer to VLAN table start.
- */
-RTI_VLAN_RECORD *RTIDFX_VlanGetTableAddr(void)
-{
-    return g_RTI_vlanTableStartPtr;
-}
-/**
- * @brief force set VLAN table start pointer,but not copy records from old table.
- * 
- * @param start Pointer to the start of the VLAN table.
- * @param sizeBytes Size of the VLAN table in bytes.
- * @return RTI_ERR 
- */
-RTI_ERR RTIDFX_VlanTableForceSet(RTI_VLAN_RECORD *start, size_t sizeBytes)
-{
-    if (start == NULL) {
-        return RTI_ERR_INVALID_PARAM;
-    }
-    g_RTI_vlanTableStartPtr = start;
-    g_RTI_vlanTableEndPtr = (RTI_VLAN_RECORD*)(start + sizeBytes);
-    return RTI_OK;
-}
-/**
- * @brief Get the maximum record count of VLAN table.
- * 
- * @return size_t The maximum record count of VLAN table.
- */
-size_t RTIDFX_VlanGetTableRecordMaxCount(void)
-{
-    return RTI_VlanGetRecordCount(g_RTI_vlanTableStartPtr, g_RTI_vlanTableEndPtr);
-}
-/**
- * @brief Unregister a dynamic VLAN.
- * 
- * @param id VLAN ID to unregister.
- * @return RTI_ERR Error code indicating success or failure.
- * @warning do not unregister static records, this function will not check that.
- */
-RTI_ERR RTIDFX_VlanTableUnregister(RTI_VlanId id)
-{
-    RTI_VLAN_RECORD *itr = g_RTI_vlanTableStartPtr;
-    RTI_VLAN_RECORD *end = g_RTI_vlanTableEndPtr;
-    while (itr < end) {
-        if (RTI_VLAN_GET_DESC_ID(*itr) == id) {
-            memmove(itr, itr + 1, (end - itr - 1) * sizeof(RTI_VLAN_RECORD));
-            g_RTI_vlanRecordUsedCnt--;
-            // reset last record to NULL
-            g_RTI_vlanTableStartPtr[g_RTI_vlanRecordUsedCnt] = NULL;
-            return RTI_OK;
-        }
-        itr++;
-    }
-    return RTI_ERR_INVALID_PARAM;
+/**
+ * @file rti_vlan.c
+ * @author CYK-Dot
+ * @brief RouteIt-Framework VLAN module implementation.
+ * @version 0.1
+ * @date 2025-10-04
+ *
+ * @copyright Copyright (c) 2025 CYK-Dot, MIT License.
+ */
+
+/* Header import ------------------------------------------------------------------*/
+#include "rti_vlan.h"
+#include "rti_os.h"
+#include <string.h>
+#include <stdbool.h>
+
+/* Private typedef ----------------------------------------------------------------*/
+
+/* Private defines ----------------------------------------------------------------*/
+
+/**
+ * @brief Get the ID of VLAN description from VLAN record.
+ * 
+ * @param RECORD[RTI_VLAN_RECORD*] The VLAN record from VLAN table.
+ * @return RTI_VlanId The ID of VLAN description.
+ */
+#define RTI_VLAN_GET_DESC_ID(RECORD) ((RTI_VLAN_DESC*)(RECORD))->id
+
+/**
+ * @brief Get the pointer to VLAN description from VLAN record.
+ * 
+ * @param RECORD[RTI_VLAN_RECORD*] The VLAN record from VLAN table.
+ * @return RTI_VLAN_DESC* The reference of VLAN description.
+ */
+#define RTI_VLAN_GET_DESC_REF(RECORD) ((RTI_VLAN_DESC*)(RECORD))
+
+/* Global variables ---------------------------------------------------------------*/
+
+/* external variables from linker script */
+extern RTI_VLAN_RECORD __start_rti_vlan[]; 
+extern RTI_VLAN_RECORD __end_rti_vlan[];
+#if RTI_ENABLE_DYNAMIC_VLAN == 1
+static RTI_VLAN_RECORD *g_RTI_vlanTableStartPtr = __start_rti_vlan;
+static RTI_VLAN_RECORD *g_RTI_vlanTableEndPtr = __end_rti_vlan;
+static size_t g_RTI_vlanRecordUsedCnt =0;
+#endif
+
+/* Private function prototypes ---------------------------------------------------*/
+
+/* Exported function prototypes --------------------------------------------------*/
+
+/* Private function definitions --------------------------------------------------*/
+
+/**
+ * @brief Check if the dynamic VLAN table is uninitialized.
+ * 
+ * @return true The dynamic VLAN table is uninitialized.
+ * @return false The dynamic VLAN table is initialized.
+ */
+static inline bool RTI_VlanIsDynamicUninitialized(void)
+{
+    return (g_RTI_vlanTableStartPtr == __start_rti_vlan || g_RTI_vlanTableEndPtr == __end_rti_vlan);
+}
+
+/**
+ * @brief Get record count of VLAN table.
+ * 
+ * @return size_t The record count of VLAN table.
+ * @note this function should be called after dynamic table setup.
+ */
+static inline size_t RTI_VlanGetRecordCount(RTI_VLAN_RECORD *recordStart, RTI_VLAN_RECORD *recordEnd)
+{
+    return (((size_t)(recordEnd) - (size_t)(recordStart)) / sizeof(RTI_VLAN_RECORD));
+}
+
+/**
+ * @brief Lock lazy instantiation state of a VLAN interface.
+ *
+ * @param lazy The lazy instantiation state.
+ */
+static inline void RTI_VlanLazyLock(RTI_VLAN_LAZY *lazy)
+{
+    while (__atomic_test_and_set(&lazy->lock, __ATOMIC_ACQUIRE)) {
+        RTI_OS_CPU_RELAX();
+    }
+}
+
+/**
+ * @brief Unlock lazy instantiation state of a VLAN interface.
+ *
+ * @param lazy The lazy instantiation state.
+ */
+static inline void RTI_VlanLazyUnlock(RTI_VLAN_LAZY *lazy)
+{
+    __atomic_clear(&lazy->lock, __ATOMIC_RELEASE);
+}
+
+/* Exported function definitions -------------------------------------------------*/
+
+/**
+ * @brief Select a VLAN by ID.
+ * 
+ * @param vlanId The ID of the VLAN to select.
+ * @param vlanOut Pointer to store the selected VLAN description.
+ * @return RTI_ERR Error code indicating success or failure.
+ * @note this function is only for RTI internal use.
+ * @warning do not pass pointer variable to vlanOut.
+ *          instead, you shold pass the address of RTI_VLAN_DESC variable
+ */
+RTI_ERR RTIPriv_VlanSelect(RTI_VlanId vlanId, RTI_VLAN_DESC *descOut)
+{
+    RTI_ERR err = RTI_OK;
+    #if RTI_ENABLE_DYNAMIC_VLAN == 1
+        RTI_VLAN_RECORD *itr = g_RTI_vlanTableStartPtr;
+        RTI_VLAN_RECORD *end = g_RTI_vlanTableEndPtr;
+    #else
+        RTI_VLAN_RECORD *itr = __start_rti_vlan;
+        RTI_VLAN_RECORD *end = __end_rti_vlan;
+    #endif
+    if (itr == end) {
+        return RTI_ERR_OBJECT_EMPTY;
+    }
+    while (itr < end) {
+        // data may unregister,skip it
+        if (*itr == NULL) {
+            itr++;
+            continue;
+        }
+        if (RTI_VLAN_GET_DESC_ID(*itr) == vlanId) {
+            // copy VLAN description from record to output
+            memcpy(descOut, RTI_VLAN_GET_DESC_REF(*itr), sizeof(RTI_VLAN_DESC));
+            break;
+        }
+        itr++;
+    }
+    if (itr == end) {
+        err = RTI_ERR_INVALID_PARAM;
+    }
+    return err;
+}
+
+/**
+ * @brief Attach a handle to a VLAN interface, the first attach instantiates the VLAN.
+ *
+ * @param ifx The VLAN interface.
+ * @param createF Creates the backend VLAN, called once under the lazy lock.
+ * @param arg Argument of createF.
+ * @return void* The backend VLAN, NULL if it can not be created and nothing is attached.
+ * @note while a handle is attached the VLAN is never deleted by idle policy,
+ *       so attaching to an instantiated VLAN is only an atomic increment.
+ *       this function is only for RTI internal use, called by createXxxF of backends.
+ */
+void *RTIPriv_VlanAttach(RTI_VLAN_IFX *ifx, RTI_VlanInstantiateFptr createF, void *arg)
+{
+    RTI_VLAN_LAZY *lazy = &ifx->lazy;
+    uint32_t cnt = __atomic_load_n(&lazy->attachCnt, __ATOMIC_RELAXED);
+    while (cnt > 0) {
+        if (__atomic_compare_exchange_n(&lazy->attachCnt, &cnt, cnt + 1, true, __ATOMIC_ACQUIRE, __ATOMIC_RELAXED)) {
+            void *vlan = __atomic_load_n(&lazy->vlan, __ATOMIC_ACQUIRE);
+            if (vlan != NULL) {
+                return vlan;
+            }
+            // deleteF was called while handles are alive, create it again under the lock
+            __atomic_fetch_sub(&lazy->attachCnt, 1, __ATOMIC_RELAXED);
+            break;
+        }
+    }
+    RTI_VlanLazyLock(lazy);
+    void *vlan = lazy->vlan;
+    if (vlan == NULL) {
+        vlan = createF(arg);
+        __atomic_store_n(&lazy->vlan, vlan, __ATOMIC_RELEASE);
+    }
+    if (vlan != NULL) {
+        __atomic_fetch_add(&lazy->attachCnt, 1, __ATOMIC_RELAXED);
+    }
+    RTI_VlanLazyUnlock(lazy);
+    return vlan;
+}
+
+/**
+ * @brief Detach a handle from a VLAN interface, the last detach applies idle policy.
+ *
+ * @param ifx The VLAN interface.
+ * @param deleteF Deletes the backend VLAN, called under the lazy lock.
+ * @param arg Argument of deleteF.
+ * @note this function is only for RTI internal use, called by deleteXxxF of backends
+ *       for each handle of a successful RTIPriv_VlanAttach().
+ */
+void RTIPriv_VlanDetach(RTI_VLAN_IFX *ifx, RTI_VlanReleaseFptr deleteF, void *arg)
+{
+    RTI_VLAN_LAZY *lazy = &ifx->lazy;
+    uint32_t cnt = __atomic_load_n(&lazy->attachCnt, __ATOMIC_RELAXED);
+    while (cnt > 1) {
+        if (__atomic_compare_exchange_n(&lazy->attachCnt, &cnt, cnt - 1, true, __ATOMIC_RELEASE, __ATOMIC_RELAXED)) {
+            return;
+        }
+    }
+    // the last handle, an attach racing with us either wins before the lock or waits for it
+    RTI_VlanLazyLock(lazy);
+    cnt = __atomic_load_n(&lazy->attachCnt, __ATOMIC_RELAXED);
+    if (cnt > 0) {
+        cnt = __atomic_sub_fetch(&lazy->attachCnt, 1, __ATOMIC_ACQ_REL);
+    }
+    if (cnt == 0 && lazy->pinned == 0 && lazy->idle == RTI_VLAN_IDLE_DELETE && lazy->vlan != NULL) {
+        deleteF(arg, lazy->vlan);
+        __atomic_store_n(&lazy->vlan, NULL, __ATOMIC_RELEASE);
+    }
+    RTI_VlanLazyUnlock(lazy);
+}
+
+/**
+ * @brief Instantiate a VLAN by explicit createF, it is kept until deleteF.
+ *
+ * @param ifx The VLAN interface.
+ * @param createF Creates the backend VLAN if it is not instantiated yet.
+ * @param arg Argument of createF.
+ * @return void* The backend VLAN, NULL if failed.
+ * @note this function is only for RTI internal use.
+ */
+void *RTIPriv_VlanPin(RTI_VLAN_IFX *ifx, RTI_VlanInstantiateFptr createF, void *arg)
+{
+    RTI_VLAN_LAZY *lazy = &ifx->lazy;
+    RTI_VlanLazyLock(lazy);
+    void *vlan = lazy->vlan;
+    if (vlan == NULL) {
+        vlan = createF(arg);
+        __atomic_store_n(&lazy->vlan, vlan, __ATOMIC_RELEASE);
+    }
+    lazy->pinned = (vlan != NULL) ? 1 : 0;
+    RTI_VlanLazyUnlock(lazy);
+    return vlan;
+}
+
+/**
+ * @brief Delete a VLAN by explicit deleteF, whether handles are attached or not.
+ *
+ * @param ifx The VLAN interface.
+ * @param vlan The backend VLAN returned by createF.
+ * @param deleteF Deletes the backend VLAN.
+ * @param arg Argument of deleteF.
+ * @note this function is only for RTI internal use.
+ */
+void RTIPriv_VlanUnpin(RTI_VLAN_IFX *ifx, void *vlan, RTI_VlanReleaseFptr deleteF, void *arg)
+{
+    RTI_VLAN_LAZY *lazy = &ifx->lazy;
+    RTI_VlanLazyLock(lazy);
+    if (vlan != NULL && vlan == lazy->vlan) {
+        deleteF(arg, vlan);
+        __atomic_store_n(&lazy->vlan, NULL, __ATOMIC_RELEASE);
+        lazy->pinned = 0;
+    }
+    RTI_VlanLazyUnlock(lazy);
+}
+
+/**
+ * @brief Set what a VLAN does when its last handle detaches.
+ *
+ * @param id The VLAN ID.
+ * @param policy The idle policy, see RTI_VLAN_IDLE_POLICY.
+ * @return RTI_ERR Error code indicating success or failure.
+ * @note it applies from the next detach, a VLAN pinned by createF is never deleted by it.
+ */
+RTI_ERR RTI_VlanIdleSet(RTI_VlanId id, uint8_t policy)
+{
+    if (policy != RTI_VLAN_IDLE_KEEP && policy != RTI_VLAN_IDLE_DELETE) {
+        return RTI_ERR_INVALID_PARAM;
+    }
+    RTI_VLAN_DESC desc;
+    RTI_ERR err = RTIPriv_VlanSelect(id, &desc);
+    if (err != RTI_OK) {
+        return err;
+    }
+    RTI_VlanLazyLock(&desc.ifx->lazy);
+    desc.ifx->lazy.idle = policy;
+    RTI_VlanLazyUnlock(&desc.ifx->lazy);
+    return RTI_OK;
+}
+
+#if RTI_ENABLE_DYNAMIC_VLAN == 1
+/**
+ * @brief Setup the dynamic VLAN table.
+ * 
+ * @param start Pointer to the start of the VLAN table.
+ * @param sizeBytes Size of the VLAN table in bytes.
+ * @return RTI_ERR Error code indicating success or failure.
+ * 
+ * @note start is recommended to be aligned to RTI_VLAN_RECORD size.
+ *       eg. in C11,use aligned_alloc() to allocate aligned memory
+ */
+RTI_ERR RTI_VlanDynamicSetup(void *start, size_t sizeBytes)
+{
+    size_t recordCntOld = 0;
+    // static table do not have record count,as it is always filled
+    if (RTI_VlanIsDynamicUninitialized() == true) {
+        recordCntOld = RTI_VlanGetRecordCount(__start_rti_vlan, __end_rti_vlan);
+    }
+    else {
+        recordCntOld = g_RTI_vlanRecordUsedCnt;
+    }
+    // check if table size is enough
+    if (start == NULL) {
+        return RTI_ERR_INVALID_PARAM;
+    }
+    else if (sizeBytes < RTI_VLAN_VLANTABLE_SIZE(recordCntOld)) {
+        return RTI_ERR_VLANTABLE_TOO_SHORT;
+    }
+    // reset new table
+    memset(start, 0, sizeBytes);
+    // copy to new table
+    memcpy(start, g_RTI_vlanTableStartPtr, RTI_VLAN_VLANTABLE_SIZE(recordCntOld));
+    g_RTI_vlanTableStartPtr = start;
+    g_RTI_vlanTableEndPtr = (RTI_VLAN_RECORD*)(start + sizeBytes);
+    g_RTI_vlanRecordUsedCnt = recordCntOld;
+    return RTI_OK;
+}
+
+/**
+ * @brief Register a dynamic VLAN.
+ * 
+ * @param vlan Pointer to the VLAN description to register.
+ * @return RTI_ERR Error code indicating success or failure.
+ * @warning 
+ *       vlanDesc should be a pointer to a global/static/heap variables,
+ *       do not pass a pointer to a stack variable.
+ *       because the VLAN-Table do not copy the VLAN description,
+ *       it only store the pointer to the VLAN description.
+ */
+RTI_ERR RTI_VlanDynamicRegister(RTI_VLAN_DESC *vlanDesc)
+{
+    if (vlanDesc == NULL)
+    {
+        return RTI_ERR_INVALID_PARAM;
+    }
+    else if (g_RTI_vlanRecordUsedCnt >= RTI_VlanGetRecordCount(g_RTI_vlanTableStartPtr, g_RTI_vlanTableEndPtr))
+    {
+        return RTI_ERR_VLANTABLE_OVERFLOW;
+    }
+    else if (RTI_VlanIsDynamicUninitialized() == true)
+    {
+        return RTI_ERR_VLANTABLE_NOT_SETUP;
+    }
+    g_RTI_vlanTableStartPtr[g_RTI_vlanRecordUsedCnt++] = (RTI_VLAN_RECORD)vlanDesc;
+    return RTI_OK;
+}
+
+/**
+ * @brief Check if a VLAN is registered.
+ * 
+ * @param vlan Pointer to the VLAN description to check.
+ * @return RTI_ERR Error code indicating success or failure.
+ */
+RTI_ERR RTI_VlanDynamicIsRegister(const RTI_VLAN_DESC *vlan)
+{
+    if (vlan == NULL)
+    {
+        return RTI_ERR_INVALID_PARAM;
+    }
+    RTI_VLAN_RECORD *itr = g_RTI_vlanTableStartPtr;
+    RTI_VLAN_RECORD *end = g_RTI_vlanTableEndPtr;
+    while (itr < end) {
+        if (RTI_VLAN_GET_DESC_ID(*itr) == RTI_VLAN_GET_DESC_ID((RTI_VLAN_RECORD)vlan)) {
+            return RTI_OK;
+        }
+        itr++;
+    }
+    return RTI_ERR_INVALID_PARAM;
+}
+
+/**
+ * @brief Get the number of free VLAN records.
+ * 
+ * @param freeRecord Pointer to store the number of free VLAN records.
+ * @return RTI_ERR Error code indicating success or failure.
+ */
+RTI_ERR RTI_VlanDynamicGetFreeCount(size_t *freeRecord)
+{
+    if (freeRecord == NULL)
+    {
+        return RTI_ERR_INVALID_PARAM;
+    }
+    if (RTI_VlanIsDynamicUninitialized() == true)
+    {
+        *freeRecord = 0;
+        return RTI_ERR_VLANTABLE_NOT_SETUP;
+    }
+    *freeRecord = RTI_VlanGetRecordCount(g_RTI_vlanTableStartPtr, g_RTI_vlanTableEndPtr) - g_RTI_vlanRecordUsedCnt;
+    return RTI_OK;
+}
+
+/**
+ * @brief Get the number of all VLAN records.
+ * 
+ * @param allRecordCount Pointer to store the number of all VLAN records.
+ * @return RTI_ERR Error code indicating success or failure.
+ */
+RTI_ERR RTI_VlanDynamicGetAllCount(size_t *allRecordCount)
+{
+    if (allRecordCount == NULL)
+    {
+        return RTI_ERR_INVALID_PARAM;
+    }
+    if (RTI_VlanIsDynamicUninitialized() == true)
+    {
+        *allRecordCount = 0;
+        return RTI_ERR_VLANTABLE_NOT_SETUP;
+    }
+    *allRecordCount = RTI_VlanGetRecordCount(g_RTI_vlanTableStartPtr, g_RTI_vlanTableEndPtr);
+    return RTI_OK;
+}
+#endif
+
+/**
+ * @brief Get the pointer to VLAN table start.
+ * 
+ * @return RTI_VLAN_RECORD* The pointer to VLAN table start.
+ */
+RTI_VLAN_RECORD *RTIDFX_VlanGetTableAddr(void)
+{
+    return g_RTI_vlanTableStartPtr;
+}
+/**
+ * @brief force set VLAN table start pointer,but not copy records from old table.
+ * 
+ * @param start Pointer to the start of the VLAN table.
+ * @param sizeBytes Size of the VLAN table in bytes.
+ * @return RTI_ERR 
+ */
+RTI_ERR RTIDFX_VlanTableForceSet(RTI_VLAN_RECORD *start, size_t sizeBytes)
+{
+    if (start == NULL) {
+        return RTI_ERR_INVALID_PARAM;
+    }
+    g_RTI_vlanTableStartPtr = start;
+    g_RTI_vlanTableEndPtr = (RTI_VLAN_RECORD*)(start + sizeBytes);
+    return RTI_OK;
+}
+/**
+ * @brief Get the maximum record count of VLAN table.
+ * 
+ * @return size_t The maximum record count of VLAN table.
+ */
+size_t RTIDFX_VlanGetTableRecordMaxCount(void)
+{
+    return RTI_VlanGetRecordCount(g_RTI_vlanTableStartPtr, g_RTI_vlanTableEndPtr);
+}
+/**
+ * @brief Unregister a dynamic VLAN.
+ * 
+ * @param id VLAN ID to unregister.
+ * @return RTI_ERR Error code indicating success or failure.
+ * @warning do not unregister static records, this function will not check that.
+ */
+RTI_ERR RTIDFX_VlanTableUnregister(RTI_VlanId id)
+{
+    RTI_VLAN_RECORD *itr = g_RTI_vlanTableStartPtr;
+    RTI_VLAN_RECORD *end = g_RTI_vlanTableEndPtr;
+    while (itr < end) {
+        if (RTI_VLAN_GET_DESC_ID(*itr) == id) {
+            memmove(itr, itr + 1, (end - itr - 1) * sizeof(RTI_VLAN_RECORD));
+            g_RTI_vlanRecordUsedCnt--;
+            // reset last record to NULL
+            g_RTI_vlanTableStartPtr[g_RTI_vlanRecordUsedCnt] = NULL;
+            return RTI_OK;
+        }
+        itr++;
+    }
+    return RTI_ERR_INVALID_PARAM;
 }
\ No newline at end of file
@@ -0,0 +1,210 @@
+#!/usr/bin/env python3
+"""
+RTI 路由表生成脚本
+将各子模块 rti_config.json 中的 routes 规则编译为常量 C 跳转表
+"""
+
+import argparse
+import json
+import os
+import re
+import sys
+from pathlib import Path
+from rti_script_logger import *
+
+try:
+    from jinja2 import Template
+except ImportError as e:
+    fatal("RTI: route-generator Failed to import jinja2: {}", e)
+    sys.exit(1)
+
+# 与 rti_config.h 中的 RTI_ROUTE_RULES_MAX 保持一致
+ROUTE_RULES_MAX = 64
+ROUTE_FIELDS = ('source', 'type', 'key')
+
+
+class RouteGenerator:
+    def __init__(self):
+        self.global_config = None
+        self.submodules = None
+
+    def load_config(self, config_path):
+        """加载 JSON 配置文件"""
+        try:
+            with open(config_path, 'r', encoding='utf-8') as f:
+                config = json.load(f)
+        except json.JSONDecodeError as e:
+            fatal("RTI: route-generator config file JSON format error: {}", e)
+            return False
+        except Exception as e:
+            fatal("RTI: route-generator load config file error: {}", e)
+            return False
+
+        if 'global' not in config or 'submodule' not in config:
+            fatal("RTI: route-generator config file missing 'global' or 'submodule' field")
+            return False
+
+        self.global_config = config['global']
+        self.submodules = config['submodule']
+        return True
+
+    def parse_rule(self, submodule_name, index, rule):
+        """校验单条规则，返回 (匹配字段字典, VLAN 表达式)"""
+        if 'vlan' not in rule:
+            fatal("RTI: route-generator submodule '{}' rule {} missing 'vlan' field", submodule_name, index)
+            return None
+        fields = {}
+        for field in ROUTE_FIELDS:
+            if field not in rule:
+                continue
+            try:
+                value = int(rule[field], 0) if isinstance(rule[field], str) else int(rule[field])
+            except ValueError:
+                fatal("RTI: route-generator submodule '{}' rule {} invalid '{}' value", submodule_name, index, field)
+                return None
+            if value < 0 or value > 0xFFFFFFFF:
+                fatal("RTI: route-generator submodule '{}' rule {} '{}' out of range", submodule_name, index, field)
+                return None
+            fields[field] = value
+        # VLAN 可以是数字 ID，也可以是 VLAN 名称（使用 VLAN ID 生成器的宏）
+        vlan = rule['vlan']
+        if isinstance(vlan, int):
+            vlan_expr = str(vlan)
+        elif isinstance(vlan, str) and re.fullmatch(r'[A-Za-z_][A-Za-z0-9_]*', vlan):
+            vlan_expr = f"RTI_VLANID_{vlan.upper()}"
+        else:
+            fatal("RTI: route-generator submodule '{}' rule {} invalid 'vlan' value", submodule_name, index)
+            return None
+        return fields, vlan_expr
+
+    def compile_rules(self, submodule_name, rules):
+        """按 type 字段把规则编译为 switch 分支，每个分支是常量规则掩码加剩余条件"""
+        if len(rules) > ROUTE_RULES_MAX:
+            fatal("RTI: route-generator submodule '{}' has {} rules, max {}", submodule_name, len(rules), ROUTE_RULES_MAX)
+            return None
+        parsed = []
+        for index, rule in enumerate(rules):
+            result = self.parse_rule(submodule_name, index, rule)
+            if result is None:
+                return None
+            parsed.append(result)
+
+        def build_case(type_value):
+            mask = 0
+            conds = []
+            for index, (fields, _) in enumerate(parsed):
+                if 'type' in fields and fields['type'] != type_value:
+                    continue
+                terms = [f"attr->{field} == {fields[field]}u" for field in ('source', 'key') if field in fields]
+                if terms:
+                    conds.append({'EXPR': ' && '.join(terms), 'MASK': f"0x{1 << index:x}ull"})
+                else:
+                    mask |= 1 << index
+            return {'MASK': f"0x{mask:x}ull", 'CONDS': conds}
+
+        types = sorted({fields['type'] for fields, _ in parsed if 'type' in fields})
+        cases = []
+        for type_value in types:
+            case = build_case(type_value)
+            case['TYPE'] = f"{type_value}u"
+            cases.append(case)
+        default = build_case(None)
+
+        vlans = [vlan for _, vlan in parsed]
+        dups = []
+        for index, vlan in enumerate(vlans):
+            # 名称与数字 ID 可能指向同一 VLAN，只有两边都是数字时才能在这里比较，
+            # 其余交给编译器求值常量表达式
+            dup = 0
+            terms = []
+            for later in range(index + 1, len(vlans)):
+                if vlan.isdigit() and vlans[later].isdigit():
+                    dup |= (1 << later) if int(vlans[later]) == int(vlan) else 0
+                elif vlans[later] == vlan:
+                    dup |= 1 << later
+                else:
+                    terms.append(f"(({vlan}) == ({vlans[later]}) ? 0x{1 << later:x}ull : 0)")
+            dups.append(' | '.join([f"0x{dup:x}ull"] + terms))
+        return {'VLANS': vlans, 'DUPS': dups, 'CASES': cases, 'DEFAULT': default}
+
+    def resolve_path(self, submodule_config, relative):
+        submodule_path = submodule_config['path']
+        if not os.path.isabs(submodule_path):
+            submodule_path = os.path.join(self.global_config['project_dir'], submodule_path)
+        return os.path.join(submodule_path, relative)
+
+    def generate_submodule_header(self, submodule_name, submodule_config):
+        """为子模块生成路由表头文件"""
+        route_config = submodule_config['routes']
+        if 'output' not in route_config:
+            fatal("RTI: route-generator submodule '{}' missing 'routes.output' field", submodule_name)
+            return False
+
+        table = self.compile_rules(submodule_name, route_config.get('rules', []))
+        if table is None:
+            return False
+
+        output_path = self.resolve_path(submodule_config, route_config['output'])
+        # 规则引用 VLAN 名称时需要包含本模块的 VLAN ID 头文件
+        vlanid_include = None
+        vlan_config = submodule_config.get('vlan', {})
+        if vlan_config.get('status') == 'enable' and 'output' in vlan_config:
+            vlanid_path = self.resolve_path(submodule_config, vlan_config['output'])
+            vlanid_include = os.path.relpath(vlanid_path, os.path.dirname(output_path)).replace(os.sep, '/')
+
+        template_path = Path(__file__).parent / "rti_route.j2"
+        try:
+            with open(template_path, 'r', encoding='utf-8') as f:
+                template = Template(f.read())
+            header_content = template.render(
+                TABLE=re.sub(r'[^A-Za-z0-9_]', '_', submodule_name).upper(),
+                VLANID_INCLUDE=vlanid_include,
+                **table)
+        except Exception as e:
+            fatal("RTI: route-generator failed to render template for submodule '{}': {}", submodule_name, e)
+            return False
+
+        try:
+            os.makedirs(os.path.dirname(output_path), exist_ok=True)
+            with open(output_path, 'w', encoding='utf-8') as f:
+                f.write(header_content)
+            info("RTI: route-generator Generated route header for submodule '{}': {}", submodule_name, output_path)
+        except Exception as e:
+            fatal("RTI: route-generator failed to write header file '{}': {}", output_path, e)
+            return False
+        return True
+
+    def run(self, config_path):
+        """运行路由表生成器"""
+        info("RTI: route-generator start...")
+        if not self.load_config(config_path):
+            return 1
+
+        count = 0
+        for submodule_name, submodule_config in self.submodules.items():
+            if submodule_config.get('routes', {}).get('status') != 'enable':
+                continue
+            if not self.generate_submodule_header(submodule_name, submodule_config):
+                return 1
+            count += 1
+
+        notice("RTI: route table generation completed successfully, {} submodules", count)
+        return 0
+
+
+def main():
+    parser = argparse.ArgumentParser(description='RTI Route Table Generator')
+    parser.add_argument('-c', '--config', required=True, help='Path to configuration JSON file')
+
+    args = parser.parse_args()
+
+    if not os.path.exists(args.config):
+        fatal("RTI: route-generator config file not found: {}", args.config)
+        return 1
+
+    generator = RouteGenerator()
+    return generator.run(args.config)
+
+
+if __name__ == '__main__':
+    sys.exit(main())
@@ -0,0 +1,202 @@
+#!/usr/bin/env python3
+"""
+RTI 静态 VLAN 存储生成脚本
+将各子模块 rti_config.json 中的 static 配置生成为 .bss 队列内存、句柄池和 VLAN 表，运行时不再使用堆
+"""
+
+import argparse
+import json
+import os
+import re
+import sys
+from pathlib import Path
+from rti_script_logger import *
+
+try:
+    from jinja2 import Template
+except ImportError as e:
+    fatal("RTI: static-generator Failed to import jinja2: {}", e)
+    sys.exit(1)
+
+# 与 rti_config.h 中的 RTI_QUEUE_LANES_MAX、RTI_QUEUE_HANDLE_CACHE 保持一致
+QUEUE_LANES_MAX = 8
+QUEUE_HANDLE_CACHE = 16
+QUEUE_SCHEDS = {'strict': 'RTI_QUEUE_SCHED_STRICT', 'wrr': 'RTI_QUEUE_SCHED_WRR'}
+NAME_PATTERN = r'[A-Za-z_][A-Za-z0-9_]*'
+
+
+class StaticGenerator:
+    def __init__(self):
+        self.global_config = None
+        self.submodules = None
+
+    def load_config(self, config_path):
+        """加载 JSON 配置文件"""
+        try:
+            with open(config_path, 'r', encoding='utf-8') as f:
+                config = json.load(f)
+        except json.JSONDecodeError as e:
+            fatal("RTI: static-generator config file JSON format error: {}", e)
+            return False
+        except Exception as e:
+            fatal("RTI: static-generator load config file error: {}", e)
+            return False
+
+        if 'global' not in config or 'submodule' not in config:
+            fatal("RTI: static-generator config file missing 'global' or 'submodule' field")
+            return False
+
+        self.global_config = config['global']
+        self.submodules = config['submodule']
+        return True
+
+    def parse_vlan(self, submodule_name, vlan_name, vlan, rates):
+        """校验单个静态 VLAN，返回模板参数"""
+        if not re.fullmatch(NAME_PATTERN, vlan_name) or not isinstance(vlan, dict):
+            fatal("RTI: static-generator submodule '{}' invalid static VLAN '{}'", submodule_name, vlan_name)
+            return None
+        # VLAN ID 可以是数字，也可以是 VLAN 名称（使用 VLAN ID 生成器的宏）
+        vlan_id = vlan.get('id')
+        if isinstance(vlan_id, int) and 0 <= vlan_id <= 0xFFFF:
+            id_expr = str(vlan_id)
+        elif isinstance(vlan_id, str) and re.fullmatch(NAME_PATTERN, vlan_id):
+            id_expr = f"RTI_VLANID_{vlan_id.upper()}"
+        else:
+            fatal("RTI: static-generator submodule '{}' VLAN '{}' invalid 'id' value", submodule_name, vlan_name)
+            return None
+        depth = vlan.get('depth')
+        if not isinstance(depth, int) or depth <= 0 or (depth & (depth - 1)) != 0:
+            fatal("RTI: static-generator submodule '{}' VLAN '{}' 'depth' must be power of 2", submodule_name, vlan_name)
+            return None
+        msg_size = vlan.get('msg_size')
+        if not isinstance(msg_size, int) or msg_size <= 0 or msg_size > 0xFFFFFFFF:
+            fatal("RTI: static-generator submodule '{}' VLAN '{}' invalid 'msg_size' value", submodule_name, vlan_name)
+            return None
+        lanes = vlan.get('lanes', 1)
+        if not isinstance(lanes, int) or lanes <= 0 or lanes > QUEUE_LANES_MAX:
+            fatal("RTI: static-generator submodule '{}' VLAN '{}' invalid 'lanes' value", submodule_name, vlan_name)
+            return None
+        sched = vlan.get('sched', 'strict')
+        if sched not in QUEUE_SCHEDS:
+            fatal("RTI: static-generator submodule '{}' VLAN '{}' invalid 'sched' value", submodule_name, vlan_name)
+            return None
+        # 句柄池容纳同时存在的生产者与消费者，耗尽后创建句柄失败而不是回退到堆
+        handles = 0
+        for field in ('producers', 'consumers'):
+            count = vlan.get(field, 1)
+            if not isinstance(count, int) or count < 0:
+                fatal("RTI: static-generator submodule '{}' VLAN '{}' invalid '{}' value", submodule_name, vlan_name, field)
+                return None
+            handles += count
+        if handles == 0 or handles > QUEUE_HANDLE_CACHE:
+            fatal("RTI: static-generator submodule '{}' VLAN '{}' needs 1 ~ {} handles", submodule_name, vlan_name, QUEUE_HANDLE_CACHE)
+            return None
+        # 限速配置来自同一模块的 vlan.rates，由 VLAN ID 生成器生成
+        rate_expr = f"&RTI_VLANRATE_{vlan_name.upper()}" if vlan_name in rates else 'NULL'
+        return {
+            'NAME': vlan_name.upper(),
+            'ID': id_expr,
+            'DEPTH': depth,
+            'MSG_SIZE': msg_size,
+            'LANES': lanes,
+            'SCHED': QUEUE_SCHEDS[sched],
+            'HANDLES': handles,
+            'RATE': rate_expr
+        }
+
+    def resolve_path(self, submodule_config, relative):
+        submodule_path = submodule_config['path']
+        if not os.path.isabs(submodule_path):
+            submodule_path = os.path.join(self.global_config['project_dir'], submodule_path)
+        return os.path.join(submodule_path, relative)
+
+    def generate_submodule_header(self, submodule_name, submodule_config):
+        """为子模块生成静态 VLAN 存储头文件"""
+        static_config = submodule_config['static']
+        if 'output' not in static_config:
+            fatal("RTI: static-generator submodule '{}' missing 'static.output' field", submodule_name)
+            return False
+
+        vlans_config = static_config.get('vlans', {})
+        if not isinstance(vlans_config, dict):
+            fatal("RTI: static-generator submodule '{}' 'static.vlans' must be an object", submodule_name)
+            return False
+        records = static_config.get('records', 0)
+        if not isinstance(records, int) or records < 0:
+            fatal("RTI: static-generator submodule '{}' invalid 'static.records' value", submodule_name)
+            return False
+
+        vlan_config = submodule_config.get('vlan', {})
+        vlan_enabled = vlan_config.get('status') == 'enable'
+        rates = vlan_config.get('rates', {}) if vlan_enabled else {}
+        vlans = []
+        for vlan_name, vlan in vlans_config.items():
+            parsed = self.parse_vlan(submodule_name, vlan_name, vlan, rates)
+            if parsed is None:
+                return False
+            vlans.append(parsed)
+
+        output_path = self.resolve_path(submodule_config, static_config['output'])
+        # VLAN ID 或限速配置来自本模块的 VLAN ID 头文件
+        vlanid_include = None
+        if vlan_enabled and 'output' in vlan_config:
+            vlanid_path = self.resolve_path(submodule_config, vlan_config['output'])
+            vlanid_include = os.path.relpath(vlanid_path, os.path.dirname(output_path)).replace(os.sep, '/')
+
+        template_path = Path(__file__).parent / "rti_static.j2"
+        try:
+            with open(template_path, 'r', encoding='utf-8') as f:
+                template = Template(f.read())
+            header_content = template.render(
+                TABLE=re.sub(r'[^A-Za-z0-9_]', '_', submodule_name).upper(),
+                VLANID_INCLUDE=vlanid_include,
+                VLANS=vlans,
+                RECORDS=records)
+        except Exception as e:
+            fatal("RTI: static-generator failed to render template for submodule '{}': {}", submodule_name, e)
+            return False
+
+        try:
+            os.makedirs(os.path.dirname(output_path), exist_ok=True)
+            with open(output_path, 'w', encoding='utf-8') as f:
+                f.write(header_content)
+            info("RTI: static-generator Generated static header for submodule '{}': {}", submodule_name, output_path)
+        except Exception as e:
+            fatal("RTI: static-generator failed to write header file '{}': {}", output_path, e)
+            return False
+        return True
+
+    def run(self, config_path):
+        """运行静态 VLAN 存储生成器"""
+        info("RTI: static-generator start...")
+        if not self.load_config(config_path):
+            return 1
+
+        count = 0
+        for submodule_name, submodule_config in self.submodules.items():
+            if submodule_config.get('static', {}).get('status') != 'enable':
+                continue
+            if not self.generate_submodule_header(submodule_name, submodule_config):
+                return 1
+            count += 1
+
+        notice("RTI: static storage generation completed successfully, {} submodules", count)
+        return 0
+
+
+def main():
+    parser = argparse.ArgumentParser(description='RTI Static VLAN Storage Generator')
+    parser.add_argument('-c', '--config', required=True, help='Path to configuration JSON file')
+
+    args = parser.parse_args()
+
+    if not os.path.exists(args.config):
+        fatal("RTI: static-generator config file not found: {}", args.config)
+        return 1
+
+    generator = StaticGenerator()
+    return generator.run(args.config)
+
+
+if __name__ == '__main__':
+    sys.exit(main())
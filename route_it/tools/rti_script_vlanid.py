@@ -76,6 +76,8 @@ class VLANIDGenerator:
     def find_macro_calls(self, directory):
         """在目录中递归查找 RTI_VLAN_REGISTER_STATIC 宏调用"""
         macro_pattern = re.compile(r'RTI_VLAN_REGISTER_STATIC\s*\(\s*[^,]+\s*,\s*([A-Za-z_][A-Za-z0-9_]*)\s*\)')
+        # RTI_VLAN_REGISTER_STATIC_QOS(_OPTS) 的 VLAN 名称是第一个参数
+        qos_macro_pattern = re.compile(r'RTI_VLAN_REGISTER_STATIC_QOS(?:_OPTS)?\s*\(\s*([A-Za-z_][A-Za-z0-9_]*)\s*,')
         vlan_occurrences = {}  # VLAN名称 -> 出现位置列表
 
         try:
@@ -86,7 +88,7 @@ class VLANIDGenerator:
                         try:
                             with open(file_path, 'r', encoding='utf-8', errors='ignore') as f:
                                 content = f.read()
-                                matches = macro_pattern.findall(content)
+                                matches = macro_pattern.findall(content) + qos_macro_pattern.findall(content)
                                 for vlan_name in matches:
                                     if vlan_name not in vlan_occurrences:
                                         vlan_occurrences[vlan_name] = []
@@ -210,10 +212,15 @@ class VLANIDGenerator:
             notice("RTI: vlanid-generator No VLANs to generate for submodule '{}'", submodule_name)
             return True
 
+        # 准备该子模块的 VLAN 限速配置
+        submodule_rates = self.parse_rates(submodule_name, submodule_config['vlan'].get('rates', {}))
+        if submodule_rates is None:
+            return False
+
         # 渲染模板
         try:
             template = Template(template_content)
-            header_content = template.render(VLANS=submodule_vlans)
+            header_content = template.render(VLANS=submodule_vlans, RATES=submodule_rates)
         except Exception as e:
             fatal("RTI: vlanid-generator failed to render template for submodule '{}': {}", submodule_name, e)
             return False
@@ -244,8 +251,89 @@ class VLANIDGenerator:
             fatal("RTI: vlanid-generator failed to write header file '{}': {}", output_path, e)
             return False
 
+        # 可选：为 C++ 生成 constexpr VLAN 注册表
+        if 'registry' in submodule_config['vlan']:
+            registry_path = os.path.join(submodule_path, submodule_config['vlan']['registry'])
+            if not self.generate_submodule_registry(submodule_name, submodule_vlans, registry_path):
+                return False
+
         return True
 
+    def generate_submodule_registry(self, submodule_name, submodule_vlans, output_path):
+        """为子模块生成 C++ constexpr VLAN 注册表头文件"""
+        template_path = Path(__file__).parent / "rti_registry.j2"
+        if not template_path.exists():
+            fatal("RTI: vlanid-generator template file not found: {}", template_path)
+            return False
+
+        # 子模块名作为 C++ 命名空间
+        module_namespace = re.sub(r'[^A-Za-z0-9_]', '_', submodule_name)
+        if module_namespace[0].isdigit():
+            module_namespace = '_' + module_namespace
+
+        try:
+            with open(template_path, 'r', encoding='utf-8') as f:
+                template = Template(f.read())
+            registry_content = template.render(FILE=os.path.basename(output_path), MODULE=module_namespace,
+                                               VLANS=submodule_vlans)
+        except Exception as e:
+            fatal("RTI: vlanid-generator failed to render registry for submodule '{}': {}", submodule_name, e)
+            return False
+
+        try:
+            os.makedirs(os.path.dirname(output_path), exist_ok=True)
+            with open(output_path, 'w', encoding='utf-8') as f:
+                f.write(registry_content)
+            info("RTI: vlanid-generator Generated VLAN registry for submodule '{}': {}", submodule_name, output_path)
+        except Exception as e:
+            fatal("RTI: vlanid-generator failed to write registry file '{}': {}", output_path, e)
+            return False
+
+        return True
+
+    def parse_rates(self, submodule_name, rates):
+        """解析子模块 vlan.rates 字段，VLAN 名称到令牌桶限速配置"""
+        policies = {'drop': 'RTI_VLAN_RATE_DROP', 'block': 'RTI_VLAN_RATE_BLOCK', 'divert': 'RTI_VLAN_RATE_DIVERT'}
+        if not isinstance(rates, dict):
+            fatal("RTI: vlanid-generator submodule '{}' 'vlan.rates' must be an object", submodule_name)
+            return None
+        parsed = []
+        for vlan_name, rate in rates.items():
+            if not re.fullmatch(r'[A-Za-z_][A-Za-z0-9_]*', vlan_name) or not isinstance(rate, dict):
+                fatal("RTI: vlanid-generator submodule '{}' invalid rate of VLAN '{}'", submodule_name, vlan_name)
+                return None
+            if not isinstance(rate.get('rate'), int) or rate['rate'] <= 0 or rate['rate'] > 1000000000:
+                fatal("RTI: vlanid-generator submodule '{}' VLAN '{}' invalid 'rate' value", submodule_name, vlan_name)
+                return None
+            burst = rate.get('burst', 1)
+            if not isinstance(burst, int) or burst < 0 or burst > 0xFFFFFFFF:
+                fatal("RTI: vlanid-generator submodule '{}' VLAN '{}' invalid 'burst' value", submodule_name, vlan_name)
+                return None
+            policy = rate.get('policy', 'drop')
+            if policy not in policies:
+                fatal("RTI: vlanid-generator submodule '{}' VLAN '{}' invalid 'policy' value", submodule_name, vlan_name)
+                return None
+            # 溢出 VLAN 可以是数字 ID，也可以是 VLAN 名称（使用 VLAN ID 生成器的宏）
+            overflow = rate.get('overflow', 0)
+            if policy == 'divert' and 'overflow' not in rate:
+                fatal("RTI: vlanid-generator submodule '{}' VLAN '{}' divert policy missing 'overflow' field", submodule_name, vlan_name)
+                return None
+            if isinstance(overflow, int):
+                overflow_expr = str(overflow)
+            elif isinstance(overflow, str) and re.fullmatch(r'[A-Za-z_][A-Za-z0-9_]*', overflow):
+                overflow_expr = f"RTI_VLANID_{overflow.upper()}"
+            else:
+                fatal("RTI: vlanid-generator submodule '{}' VLAN '{}' invalid 'overflow' value", submodule_name, vlan_name)
+                return None
+            parsed.append({
+                'NAME': vlan_name.upper(),
+                'RATE': rate['rate'],
+                'BURST': burst,
+                'POLICY': policies[policy],
+                'OVERFLOW': overflow_expr
+            })
+        return parsed
+
     def run(self, config_path):
         """运行 VLAN ID 生成器"""
         info("RTI: vlanid-generator start...")
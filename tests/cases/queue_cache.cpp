@@ -0,0 +1,140 @@
+/**
+ * @file queue_cache.cpp
+ * @author CYK-Dot
+ * @brief testcases for recycled producers and consumers of built-in queue backend
+ * @version 0.1
+ * @date 2026-10-16
+ *
+ * @copyright Copyright (c) 2025 CYK-Dot, MIT License.
+ */
+
+/* Header import ------------------------------------------------------------------*/
+#include <gtest/gtest.h>
+#include <atomic>
+#include <set>
+#include <thread>
+#include <vector>
+#include "rti_queue.h"
+
+/* Config macros ------------------------------------------------------------------*/
+#ifdef RTI_TEST_COMMON
+
+/* Mock variables and functions  --------------------------------------------------*/
+
+/* Test suites --------------------------------------------------------------------*/
+
+/**
+ * @brief testcases on one heap queue
+ *
+ */
+class QueueCacheTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        RTI_QUEUE_CFG cfg = {64, sizeof(uint32_t), 2, RTI_QUEUE_SCHED_STRICT, {0}};
+        ASSERT_EQ(RTI_QueueCreate(&cfg, &queue), RTI_OK);
+    }
+    void TearDown() override {
+        RTI_QueueDelete(queue);
+    }
+    RTI_QUEUE *queue = nullptr;
+};
+
+/* Test cases ---------------------------------------------------------------------*/
+
+/**
+ * @brief deleted handles come back on next create, reset to a created state
+ *
+ */
+TEST_F(QueueCacheTest, Recycle) {
+    void *producer = nullptr;
+    void *consumer = nullptr;
+    ASSERT_EQ(RTI_QueueProducerCreate(queue, &producer), RTI_OK);
+    ASSERT_EQ(RTI_QueueConsumerCreate(queue, &consumer), RTI_OK);
+    RTI_VLAN_FLOW_CFG flow = {4, 2, RTI_VLAN_FLOW_MODE_NONBLOCK, nullptr, nullptr};
+    ASSERT_EQ(RTI_QueueFlowSet(producer, &flow), RTI_OK);
+    ASSERT_GE(RTI_QueueConsumerGetFd(consumer), 0);
+
+    void *old = producer;
+    RTI_QueueProducerDelete(producer);
+    ASSERT_EQ(RTI_QueueProducerCreate(queue, &producer), RTI_OK);
+    EXPECT_EQ(producer, old);
+    uint32_t msg = 0;
+    for (msg = 0; msg < 8; msg++) {
+        EXPECT_EQ(RTI_QueueSend(producer, &msg, sizeof(msg), 1), RTI_OK) << "flow control is reset";
+    }
+
+    // consumer memory is reused by a producer, reset as a producer
+    old = consumer;
+    RTI_QueueConsumerDelete(consumer);
+    void *producer2 = nullptr;
+    ASSERT_EQ(RTI_QueueProducerCreate(queue, &producer2), RTI_OK);
+    EXPECT_EQ(producer2, old);
+    EXPECT_EQ(RTI_QueueSend(producer2, &msg, sizeof(msg), 0), RTI_OK);
+
+    ASSERT_EQ(RTI_QueueConsumerCreate(queue, &consumer), RTI_OK);
+    size_t size = sizeof(msg);
+    ASSERT_EQ(RTI_QueueRecv(consumer, &msg, &size), RTI_OK);
+    EXPECT_EQ(msg, 8u);
+    RTI_QueueProducerDelete(producer);
+    RTI_QueueProducerDelete(producer2);
+    RTI_QueueConsumerDelete(consumer);
+}
+
+/**
+ * @brief cache keeps RTI_QUEUE_HANDLE_CACHE handles, the rest are freed
+ *
+ */
+TEST_F(QueueCacheTest, Bounded) {
+    std::vector<void *> handles(RTI_QUEUE_HANDLE_CACHE + 4);
+    for (auto &handle : handles) {
+        ASSERT_EQ(RTI_QueueProducerCreate(queue, &handle), RTI_OK);
+    }
+    std::set<void *> cached(handles.begin(), handles.begin() + RTI_QUEUE_HANDLE_CACHE);
+    for (auto handle : handles) {
+        RTI_QueueProducerDelete(handle);
+    }
+    for (size_t i = 0; i < RTI_QUEUE_HANDLE_CACHE; i++) {
+        void *handle = nullptr;
+        ASSERT_EQ(RTI_QueueProducerCreate(queue, &handle), RTI_OK);
+        EXPECT_EQ(cached.count(handle), 1u);
+        handles[i] = handle;
+    }
+    for (size_t i = 0; i < RTI_QUEUE_HANDLE_CACHE; i++) {
+        RTI_QueueProducerDelete(handles[i]);
+    }
+}
+
+/**
+ * @brief threads create, send and delete handles concurrently
+ *
+ */
+TEST_F(QueueCacheTest, Concurrent) {
+    std::atomic<uint32_t> sent{0};
+    std::vector<std::thread> threads;
+    for (int t = 0; t < 4; t++) {
+        threads.emplace_back([&]() {
+            for (int i = 0; i < 2000; i++) {
+                void *producer = nullptr;
+                void *consumer = nullptr;
+                ASSERT_EQ(RTI_QueueProducerCreate(queue, &producer), RTI_OK);
+                ASSERT_EQ(RTI_QueueConsumerCreate(queue, &consumer), RTI_OK);
+                uint32_t msg = (uint32_t)i;
+                if (RTI_QueueSend(producer, &msg, sizeof(msg), 0) == RTI_OK) {
+                    sent++;
+                }
+                size_t size = sizeof(msg);
+                if (RTI_QueueRecv(consumer, &msg, &size) == RTI_OK) {
+                    sent--;
+                }
+                RTI_QueueProducerDelete(producer);
+                RTI_QueueConsumerDelete(consumer);
+            }
+        });
+    }
+    for (auto &thread : threads) {
+        thread.join();
+    }
+    EXPECT_EQ(RTIPriv_QueueUsed(queue), sent.load());
+}
+
+#endif
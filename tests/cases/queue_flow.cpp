@@ -0,0 +1,240 @@
+/**
+ * @file queue_flow.cpp
+ * @author CYK-Dot
+ * @brief testcases for producer flow control of built-in queue backend
+ * @version 0.1
+ * @date 2026-10-16
+ *
+ * @copyright Copyright (c) 2025 CYK-Dot, MIT License.
+ */
+
+/* Header import ------------------------------------------------------------------*/
+#include <gtest/gtest.h>
+#include <atomic>
+#include <chrono>
+#include <thread>
+#include <vector>
+#include "rti_queue.h"
+
+/* Config macros ------------------------------------------------------------------*/
+#ifdef RTI_TEST_COMMON
+
+/* Mock variables and functions  --------------------------------------------------*/
+RTI_QUEUE_IFX_DEFINE(flow_vlan_ifx, 8, sizeof(uint32_t), 1, RTI_QUEUE_SCHED_STRICT)
+
+static std::vector<RTI_VLAN_FLOW_STATE> g_flowNotified;
+static void mock_flow_notify(void *, RTI_VLAN_FLOW_STATE state, void *arg)
+{
+    EXPECT_EQ(arg, &g_flowNotified);
+    g_flowNotified.push_back(state);
+}
+
+/* Test suites --------------------------------------------------------------------*/
+
+/**
+ * @brief testcases for producer flow control
+ *
+ */
+class QueueFlowTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        RTI_QUEUE_CFG cfg = {8, sizeof(uint32_t), 1, RTI_QUEUE_SCHED_STRICT, {0}};
+        ASSERT_EQ(RTI_QueueCreate(&cfg, &queue), RTI_OK);
+        ASSERT_EQ(RTI_QueueProducerCreate(queue, &producer), RTI_OK);
+        ASSERT_EQ(RTI_QueueConsumerCreate(queue, &consumer), RTI_OK);
+        g_flowNotified.clear();
+    }
+    void TearDown() override {
+        RTI_QueueProducerDelete(producer);
+        RTI_QueueConsumerDelete(consumer);
+        RTI_QueueDelete(queue);
+    }
+    RTI_ERR Recv(uint32_t *msg) {
+        size_t size = sizeof(*msg);
+        return RTI_QueueRecv(consumer, msg, &size);
+    }
+    RTI_QUEUE *queue;
+    void *producer;
+    void *consumer;
+};
+
+/* Test cases ---------------------------------------------------------------------*/
+
+/**
+ * @brief producer without flow config sees the whole capacity as credits
+ *
+ */
+TEST_F(QueueFlowTest, DefaultCredits) {
+    RTI_VLAN_FLOW flow;
+    ASSERT_EQ(RTI_QueueFlowGet(producer, &flow), RTI_OK);
+    EXPECT_EQ(flow.capacity, 8u);
+    EXPECT_EQ(flow.credits, 8u);
+    EXPECT_EQ(flow.state, RTI_VLAN_FLOW_OPEN);
+    uint32_t msg = 0;
+    EXPECT_EQ(RTI_QueueSend(producer, &msg, sizeof(msg), 0), RTI_OK);
+    ASSERT_EQ(RTI_QueueFlowGet(producer, &flow), RTI_OK);
+    EXPECT_EQ(flow.credits, 7u);
+}
+
+/**
+ * @brief invalid watermarks should be rejected
+ *
+ */
+TEST_F(QueueFlowTest, InvalidWatermark) {
+    RTI_VLAN_FLOW_CFG cfg = {4, 4, RTI_VLAN_FLOW_MODE_NONBLOCK, nullptr, nullptr};
+    EXPECT_EQ(RTI_QueueFlowSet(producer, &cfg), RTI_ERR_INVALID_PARAM);
+    cfg.lowWatermark = 2;
+    EXPECT_EQ(RTI_QueueFlowSet(producer, &cfg), RTI_OK);
+    EXPECT_EQ(RTI_QueueFlowSet(producer, nullptr), RTI_OK);
+}
+
+/**
+ * @brief producer is throttled at high watermark and resumed at low watermark
+ *
+ */
+TEST_F(QueueFlowTest, WatermarkHysteresis) {
+    RTI_VLAN_FLOW_CFG cfg = {4, 1, RTI_VLAN_FLOW_MODE_NONBLOCK, nullptr, nullptr};
+    ASSERT_EQ(RTI_QueueFlowSet(producer, &cfg), RTI_OK);
+    uint32_t msg = 0;
+    for (msg = 0; msg < 4; msg++) {
+        EXPECT_EQ(RTI_QueueSend(producer, &msg, sizeof(msg), 0), RTI_OK);
+    }
+    EXPECT_EQ(RTI_QueueSend(producer, &msg, sizeof(msg), 0), RTI_ERR_FLOW_THROTTLED);
+    RTI_VLAN_FLOW flow;
+    ASSERT_EQ(RTI_QueueFlowGet(producer, &flow), RTI_OK);
+    EXPECT_EQ(flow.state, RTI_VLAN_FLOW_THROTTLED);
+    EXPECT_EQ(flow.credits, 0u);
+
+    // still throttled above low watermark
+    EXPECT_EQ(Recv(&msg), RTI_OK);
+    EXPECT_EQ(Recv(&msg), RTI_OK);
+    EXPECT_EQ(RTI_QueueSend(producer, &msg, sizeof(msg), 0), RTI_ERR_FLOW_THROTTLED);
+    EXPECT_EQ(Recv(&msg), RTI_OK);
+    ASSERT_EQ(RTI_QueueFlowGet(producer, &flow), RTI_OK);
+    EXPECT_EQ(flow.state, RTI_VLAN_FLOW_OPEN);
+    EXPECT_EQ(flow.credits, 3u);
+    EXPECT_EQ(RTI_QueueSend(producer, &msg, sizeof(msg), 0), RTI_OK);
+}
+
+/**
+ * @brief callback mode notifies both state changes
+ *
+ */
+TEST_F(QueueFlowTest, CallbackMode) {
+    RTI_VLAN_FLOW_CFG cfg = {2, 0, RTI_VLAN_FLOW_MODE_CALLBACK, mock_flow_notify, &g_flowNotified};
+    ASSERT_EQ(RTI_QueueFlowSet(producer, &cfg), RTI_OK);
+    uint32_t msg = 0;
+    EXPECT_EQ(RTI_QueueSend(producer, &msg, sizeof(msg), 0), RTI_OK);
+    EXPECT_EQ(RTI_QueueSend(producer, &msg, sizeof(msg), 0), RTI_OK);
+    EXPECT_EQ(RTI_QueueSend(producer, &msg, sizeof(msg), 0), RTI_ERR_FLOW_THROTTLED);
+    ASSERT_EQ(g_flowNotified.size(), 1u);
+    EXPECT_EQ(g_flowNotified[0], RTI_VLAN_FLOW_THROTTLED);
+    EXPECT_EQ(Recv(&msg), RTI_OK);
+    EXPECT_EQ(g_flowNotified.size(), 1u);
+    EXPECT_EQ(Recv(&msg), RTI_OK);
+    ASSERT_EQ(g_flowNotified.size(), 2u);
+    EXPECT_EQ(g_flowNotified[1], RTI_VLAN_FLOW_OPEN);
+}
+
+/**
+ * @brief blocking producer never drops when consumer is slower
+ *
+ */
+TEST_F(QueueFlowTest, BlockModeNoDrop) {
+    RTI_VLAN_FLOW_CFG cfg = {6, 2, RTI_VLAN_FLOW_MODE_BLOCK, nullptr, nullptr};
+    ASSERT_EQ(RTI_QueueFlowSet(producer, &cfg), RTI_OK);
+    const uint32_t total = 2000;
+    std::thread sender([this, total]() {
+        for (uint32_t i = 0; i < total; i++) {
+            ASSERT_EQ(RTI_QueueSend(producer, &i, sizeof(i), 0), RTI_OK);
+        }
+    });
+    uint32_t expect = 0;
+    while (expect < total) {
+        uint32_t msg;
+        if (Recv(&msg) == RTI_OK) {
+            ASSERT_EQ(msg, expect);
+            expect++;
+        }
+        else {
+            std::this_thread::yield();
+        }
+    }
+    sender.join();
+}
+
+/**
+ * @brief a full lane throttles the producer even if the queue is below low watermark,
+ *        and it is resumed once the lane has space
+ *
+ */
+TEST_F(QueueFlowTest, LaneFullBelowLowWatermark) {
+    RTI_QUEUE *laneQueue = nullptr;
+    void *laneProducer = nullptr;
+    void *laneConsumer = nullptr;
+    RTI_QUEUE_CFG qcfg = {4, sizeof(uint32_t), 2, RTI_QUEUE_SCHED_STRICT, {0}, RTI_QUEUE_NUMA_NONE};
+    ASSERT_EQ(RTI_QueueCreate(&qcfg, &laneQueue), RTI_OK);
+    ASSERT_EQ(RTI_QueueProducerCreate(laneQueue, &laneProducer), RTI_OK);
+    ASSERT_EQ(RTI_QueueConsumerCreate(laneQueue, &laneConsumer), RTI_OK);
+    RTI_VLAN_FLOW_CFG cfg = {8, 4, RTI_VLAN_FLOW_MODE_NONBLOCK, nullptr, nullptr};
+    ASSERT_EQ(RTI_QueueFlowSet(laneProducer, &cfg), RTI_OK);
+    uint32_t msg = 0;
+    size_t size = sizeof(msg);
+    for (msg = 0; msg < 4; msg++) {
+        ASSERT_EQ(RTI_QueueSend(laneProducer, &msg, sizeof(msg), 0), RTI_OK);
+    }
+    EXPECT_EQ(RTI_QueueSend(laneProducer, &msg, sizeof(msg), 0), RTI_ERR_FLOW_THROTTLED);
+    EXPECT_EQ(RTI_QueueSend(laneProducer, &msg, sizeof(msg), 0), RTI_ERR_FLOW_THROTTLED) << "lane still full";
+    ASSERT_EQ(RTI_QueueRecv(laneConsumer, &msg, &size), RTI_OK);
+    msg = 4;
+    EXPECT_EQ(RTI_QueueSend(laneProducer, &msg, sizeof(msg), 0), RTI_OK) << "resumed by the released slot";
+
+    // a blocking producer parks on the full lane until a slot is released
+    cfg.mode = RTI_VLAN_FLOW_MODE_BLOCK;
+    ASSERT_EQ(RTI_QueueFlowSet(laneProducer, &cfg), RTI_OK);
+    std::atomic<bool> sent(false);
+    std::thread sender([&]() {
+        uint32_t last = 5;
+        EXPECT_EQ(RTI_QueueSend(laneProducer, &last, sizeof(last), 0), RTI_OK);
+        sent = true;
+    });
+    std::this_thread::sleep_for(std::chrono::milliseconds(20));
+    EXPECT_FALSE(sent);
+    size = sizeof(msg);
+    ASSERT_EQ(RTI_QueueRecv(laneConsumer, &msg, &size), RTI_OK);
+    sender.join();
+    EXPECT_TRUE(sent);
+    for (uint32_t expect = 2; expect < 6; expect++) {
+        size = sizeof(msg);
+        ASSERT_EQ(RTI_QueueRecv(laneConsumer, &msg, &size), RTI_OK);
+        EXPECT_EQ(msg, expect);
+    }
+
+    RTI_QueueProducerDelete(laneProducer);
+    RTI_QueueConsumerDelete(laneConsumer);
+    RTI_QueueDelete(laneQueue);
+}
+
+/**
+ * @brief flow control is reachable through VLAN interface
+ *
+ */
+TEST_F(QueueFlowTest, FlowThroughInterface) {
+    RTI_VLAN_IFX *ifx = &flow_vlan_ifx.ifx;
+    void *vlan = ifx->createF();
+    ASSERT_NE(vlan, nullptr);
+    void *vlanProducer = ifx->createProducerF();
+    ASSERT_NE(ifx->flowSetF, nullptr);
+    ASSERT_NE(ifx->flowGetF, nullptr);
+    RTI_VLAN_FLOW_CFG cfg = {1, 0, RTI_VLAN_FLOW_MODE_NONBLOCK, nullptr, nullptr};
+    EXPECT_EQ(ifx->flowSetF(vlanProducer, &cfg), RTI_OK);
+    uint32_t msg = 0;
+    EXPECT_EQ(ifx->sendF(vlanProducer, &msg, sizeof(msg), 0), RTI_OK);
+    RTI_VLAN_FLOW flow;
+    EXPECT_EQ(ifx->flowGetF(vlanProducer, &flow), RTI_OK);
+    EXPECT_EQ(flow.credits, 0u);
+    ifx->deleteProducerF(vlanProducer);
+    ifx->deleteF(vlan);
+}
+
+#endif
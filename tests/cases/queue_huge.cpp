@@ -0,0 +1,98 @@
+/**
+ * @file queue_huge.cpp
+ * @author CYK-Dot
+ * @brief testcases for huge page backed and prefaulted built-in queue
+ * @version 0.1
+ * @date 2026-10-16
+ *
+ * @copyright Copyright (c) 2025 CYK-Dot, MIT License.
+ */
+
+/* Header import ------------------------------------------------------------------*/
+#include <gtest/gtest.h>
+#include <sys/mman.h>
+#include <unistd.h>
+#include <vector>
+#include "rti_queue.h"
+
+/* Config macros ------------------------------------------------------------------*/
+#if defined(RTI_TEST_COMMON) && RTI_ENABLE_HUGE_PAGES == 1
+
+/* Mock variables and functions  --------------------------------------------------*/
+RTI_VLAN_REGISTER_STATIC_QOS_OPTS_WITH_ID(HUGE_VLAN, 36, 1024, 1024, 2, RTI_QUEUE_SCHED_STRICT,
+                                          .memFlags = RTI_QUEUE_MEM_HUGE | RTI_QUEUE_MEM_PREFAULT,
+                                          .numaNode = RTI_QUEUE_NUMA_AUTO);
+
+/**
+ * @brief count pages of a range not in memory
+ *
+ */
+static size_t TestHugeMissingPages(void *addr, size_t sizeBytes)
+{
+    size_t pageSize = (size_t)sysconf(_SC_PAGESIZE);
+    std::vector<unsigned char> vec((sizeBytes + pageSize - 1) / pageSize);
+    if (mincore(addr, sizeBytes, vec.data()) != 0) {
+        return vec.size();
+    }
+    size_t missing = 0;
+    for (unsigned char page : vec) {
+        missing += ((page & 1) == 0) ? 1 : 0;
+    }
+    return missing;
+}
+
+/* Test suites --------------------------------------------------------------------*/
+
+/* Test cases ---------------------------------------------------------------------*/
+
+/**
+ * @brief a multi-megabyte ring is huge page aligned, backed by huge pages and fully prefaulted
+ *
+ */
+TEST(QueueHugeTest, PrefaultedRing) {
+    RTI_VLAN_DESC desc;
+    ASSERT_EQ(RTIPriv_VlanSelect(36, &desc), RTI_OK);
+    RTI_QUEUE *queue = (RTI_QUEUE *)desc.ifx->createF();
+    ASSERT_NE(queue, nullptr);
+    EXPECT_EQ((uintptr_t)queue % RTI_HUGE_PAGE_SIZE, 0u);
+    EXPECT_NE(RTIPriv_QueuePageKind(queue), RTI_QUEUE_PAGE_NORMAL);
+    size_t sizeBytes = RTI_QUEUE_MEM_SIZE(1024, 1024, 2);
+    EXPECT_EQ(TestHugeMissingPages(queue, sizeBytes), 0u);
+
+    void *producer = desc.ifx->createProducerF();
+    void *consumer = desc.ifx->createConsumerF();
+    std::vector<uint8_t> msg(1024, 0x5A);
+    ASSERT_EQ(desc.ifx->sendF(producer, msg.data(), msg.size(), 1), RTI_OK);
+    std::vector<uint8_t> out(1024, 0);
+    size_t size = out.size();
+    ASSERT_EQ(desc.ifx->recvF(consumer, out.data(), &size), RTI_OK);
+    EXPECT_EQ(out, msg);
+
+    void *isr = desc.ifx->createIsrProducerF();
+    ASSERT_NE(isr, nullptr);
+    EXPECT_EQ(TestHugeMissingPages((void *)((uintptr_t)isr & ~(uintptr_t)(sysconf(_SC_PAGESIZE) - 1)),
+                                   1024 * 1024), 0u) << "mailbox is prefaulted too";
+    desc.ifx->deleteIsrProducerF(isr);
+    desc.ifx->deleteProducerF(producer);
+    desc.ifx->deleteConsumerF(consumer);
+    desc.ifx->deleteF(queue);
+}
+
+/**
+ * @brief queues without memory options keep normal heap pages
+ *
+ */
+TEST(QueueHugeTest, Default) {
+    RTI_QUEUE_CFG cfg = {16, 64, 1, RTI_QUEUE_SCHED_STRICT, {0}, RTI_QUEUE_NUMA_AUTO, 0};
+    RTI_QUEUE *queue = nullptr;
+    ASSERT_EQ(RTI_QueueCreate(&cfg, &queue), RTI_OK);
+    EXPECT_EQ(RTIPriv_QueuePageKind(queue), RTI_QUEUE_PAGE_NORMAL);
+    RTI_QueueDelete(queue);
+
+    cfg.memFlags = RTI_QUEUE_MEM_HUGE;
+    ASSERT_EQ(RTI_QueueCreate(&cfg, &queue), RTI_OK);
+    EXPECT_EQ((uintptr_t)queue % RTI_HUGE_PAGE_SIZE, 0u) << "small queues are mapped as one huge page";
+    RTI_QueueDelete(queue);
+}
+
+#endif
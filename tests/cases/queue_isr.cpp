@@ -0,0 +1,184 @@
+/**
+ * @file queue_isr.cpp
+ * @author CYK-Dot
+ * @brief testcases for wait-free ISR producers of built-in queue backend
+ * @version 0.1
+ * @date 2026-10-16
+ *
+ * @copyright Copyright (c) 2025 CYK-Dot, MIT License.
+ */
+
+/* Header import ------------------------------------------------------------------*/
+#include <gtest/gtest.h>
+#include <signal.h>
+#include <sys/time.h>
+#include <atomic>
+#include <cerrno>
+#include <chrono>
+#include "rti_queue.h"
+
+/* Config macros ------------------------------------------------------------------*/
+#if defined(RTI_TEST_COMMON) && RTI_ENABLE_OS_WAIT == 1
+
+/* Mock variables and functions  --------------------------------------------------*/
+RTI_QUEUE_IFX_DEFINE(isr_vlan_ifx, 16, sizeof(uint64_t), 2, RTI_QUEUE_SCHED_STRICT)
+
+/**
+ * @brief state of the SIGALRM handler, only the handler writes it while armed
+ *
+ */
+static void *g_isrProducer;
+static std::atomic<uint32_t> g_isrSent;
+static std::atomic<uint32_t> g_isrFull;
+
+static void TestIsrAlarm(int sig)
+{
+    (void)sig;
+    uint32_t seq = g_isrSent.load(std::memory_order_relaxed);
+    uint64_t msg = ((uint64_t)1 << 32) | seq;
+    if (RTI_QueueSendIsr(g_isrProducer, &msg, sizeof(msg), 0) == RTI_OK) {
+        g_isrSent.store(seq + 1, std::memory_order_relaxed);
+    }
+    else {
+        g_isrFull.fetch_add(1, std::memory_order_relaxed);
+    }
+}
+
+/**
+ * @brief checks every message arrives once and in order of its sender
+ *
+ */
+typedef struct {
+    uint32_t next[2];
+} TEST_ISR_ORDER;
+
+static bool TestIsrCheck(TEST_ISR_ORDER *order, uint64_t msg)
+{
+    uint32_t sender = (uint32_t)(msg >> 32);
+    if (sender > 1 || (uint32_t)msg != order->next[sender]) {
+        return false;
+    }
+    order->next[sender]++;
+    return true;
+}
+
+/* Test suites --------------------------------------------------------------------*/
+
+/* Test cases ---------------------------------------------------------------------*/
+
+/**
+ * @brief mailbox is bounded and moved into its lane by consumers
+ *
+ */
+TEST(QueueIsrTest, Mailbox) {
+    RTI_VLAN_IFX *ifx = &isr_vlan_ifx.ifx;
+    void *vlan = ifx->createF();
+    ASSERT_NE(vlan, nullptr);
+    void *isr = ifx->createIsrProducerF();
+    void *consumer = ifx->createConsumerF();
+    ASSERT_NE(isr, nullptr);
+    ASSERT_NE(consumer, nullptr);
+    uint64_t msg = 0;
+    for (msg = 0; msg < 16; msg++) {
+        ASSERT_EQ(ifx->sendIsrF(isr, &msg, sizeof(msg), 1), RTI_OK);
+    }
+    EXPECT_EQ(ifx->sendIsrF(isr, &msg, sizeof(msg), 1), RTI_ERR_QUEUE_FULL);
+    EXPECT_EQ(ifx->sendIsrF(isr, &msg, sizeof(msg), 2), RTI_ERR_INVALID_PARAM);
+    for (uint64_t i = 0; i < 16; i++) {
+        size_t size = sizeof(msg);
+        ASSERT_EQ(ifx->recvF(consumer, &msg, &size), RTI_OK);
+        EXPECT_EQ(msg, i);
+    }
+    size_t size = sizeof(msg);
+    EXPECT_EQ(ifx->recvF(consumer, &msg, &size), RTI_ERR_QUEUE_EMPTY);
+    ifx->deleteIsrProducerF(isr);
+    ifx->deleteConsumerF(consumer);
+    ifx->deleteF(vlan);
+}
+
+/**
+ * @brief errno of the interrupted code survives the wake and poll signal paths
+ *
+ */
+TEST(QueueIsrTest, KeepsErrno) {
+    RTI_VLAN_IFX *ifx = &isr_vlan_ifx.ifx;
+    void *vlan = ifx->createF();
+    ASSERT_NE(vlan, nullptr);
+    void *isr = ifx->createIsrProducerF();
+    void *consumer = ifx->createConsumerF();
+    ASSERT_NE(isr, nullptr);
+    ASSERT_NE(consumer, nullptr);
+    ASSERT_GE(ifx->consumerFdF(consumer), 0);
+    uint64_t msg = 0;
+    size_t size = sizeof(msg);
+    ASSERT_EQ(ifx->recvF(consumer, &msg, &size), RTI_ERR_QUEUE_EMPTY) << "arms the poll fd";
+
+    errno = EINTR;
+    EXPECT_EQ(ifx->sendIsrF(isr, &msg, sizeof(msg), 0), RTI_OK);
+    EXPECT_EQ(errno, EINTR);
+    EXPECT_EQ(ifx->sendIsrF(isr, &msg, sizeof(msg), 2), RTI_ERR_INVALID_PARAM);
+    EXPECT_EQ(errno, EINTR);
+    ASSERT_EQ(ifx->recvF(consumer, &msg, &size), RTI_OK);
+    ifx->deleteIsrProducerF(isr);
+    ifx->deleteConsumerF(consumer);
+    ifx->deleteF(vlan);
+}
+
+/**
+ * @brief SIGALRM handler sends while the interrupted thread sends and receives
+ *
+ */
+TEST(QueueIsrTest, SignalHammer) {
+    RTI_QUEUE_CFG cfg = {16, sizeof(uint64_t), 2, RTI_QUEUE_SCHED_STRICT, {0}};
+    RTI_QUEUE *queue = nullptr;
+    ASSERT_EQ(RTI_QueueCreate(&cfg, &queue), RTI_OK);
+    void *producer = nullptr;
+    void *consumer = nullptr;
+    ASSERT_EQ(RTI_QueueProducerCreate(queue, &producer), RTI_OK);
+    ASSERT_EQ(RTI_QueueConsumerCreate(queue, &consumer), RTI_OK);
+    ASSERT_GE(RTI_QueueConsumerGetFd(consumer), 0) << "signal path also meets the poll lock";
+    ASSERT_EQ(RTI_QueueIsrProducerCreate(queue, 8, &g_isrProducer), RTI_OK);
+    g_isrSent = 0;
+    g_isrFull = 0;
+
+    struct sigaction action = {};
+    struct sigaction old = {};
+    action.sa_handler = TestIsrAlarm;
+    sigemptyset(&action.sa_mask);
+    ASSERT_EQ(sigaction(SIGALRM, &action, &old), 0);
+    struct itimerval timer = {{0, 50}, {0, 50}};
+    ASSERT_EQ(setitimer(ITIMER_REAL, &timer, nullptr), 0);
+
+    TEST_ISR_ORDER order = {};
+    uint32_t threadSent = 0;
+    uint64_t msg = 0;
+    auto end = std::chrono::steady_clock::now() + std::chrono::milliseconds(300);
+    while (std::chrono::steady_clock::now() < end) {
+        msg = threadSent;
+        if (RTI_QueueSend(producer, &msg, sizeof(msg), 1) == RTI_OK) {
+            threadSent++;
+        }
+        size_t size = sizeof(msg);
+        if (RTI_QueueRecv(consumer, &msg, &size) == RTI_OK) {
+            ASSERT_TRUE(TestIsrCheck(&order, msg)) << std::hex << msg;
+        }
+    }
+    timer = {};
+    ASSERT_EQ(setitimer(ITIMER_REAL, &timer, nullptr), 0);
+    ASSERT_EQ(sigaction(SIGALRM, &old, nullptr), 0);
+    size_t size = sizeof(msg);
+    while (RTI_QueueRecv(consumer, &msg, &size) == RTI_OK) {
+        ASSERT_TRUE(TestIsrCheck(&order, msg)) << std::hex << msg;
+        size = sizeof(msg);
+    }
+    EXPECT_EQ(order.next[0], threadSent);
+    EXPECT_EQ(order.next[1], g_isrSent.load());
+    EXPECT_GT(g_isrSent.load(), 10u);
+
+    RTI_QueueIsrProducerDelete(g_isrProducer);
+    RTI_QueueProducerDelete(producer);
+    RTI_QueueConsumerDelete(consumer);
+    RTI_QueueDelete(queue);
+}
+
+#endif
@@ -0,0 +1,120 @@
+/**
+ * @file queue_numa.cpp
+ * @author CYK-Dot
+ * @brief testcases for NUMA placement of built-in queue
+ * @version 0.1
+ * @date 2026-10-16
+ *
+ * @copyright Copyright (c) 2025 CYK-Dot, MIT License.
+ */
+
+/* Header import ------------------------------------------------------------------*/
+#include <gtest/gtest.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#include "rti_queue.h"
+
+/* Config macros ------------------------------------------------------------------*/
+#if defined(RTI_TEST_COMMON) && RTI_ENABLE_NUMA == 1
+
+/* Mock variables and functions  --------------------------------------------------*/
+
+/**
+ * @brief node of the calling thread, as the kernel reports it
+ *
+ */
+static int TestNumaCpuNode(void)
+{
+    unsigned cpu = 0;
+    unsigned node = 0;
+    if (syscall(SYS_getcpu, &cpu, &node, NULL) != 0) {
+        return -1;
+    }
+    return (int)node;
+}
+
+/**
+ * @brief check the page of addr prefers node
+ *
+ */
+static bool TestNumaIsPreferred(void *addr, int node)
+{
+    int mode = -1;
+    unsigned long mask = 0;
+    // MPOL_F_ADDR reads the policy of the page containing addr
+    if (syscall(SYS_get_mempolicy, &mode, &mask, 8 * sizeof(mask), addr, 2) != 0) {
+        return false;
+    }
+    return mode == 1 && mask == (1UL << node);
+}
+
+/* Test suites --------------------------------------------------------------------*/
+
+/* Test cases ---------------------------------------------------------------------*/
+
+/**
+ * @brief a queue of AUTO is moved to the node of its first consumer
+ *
+ */
+TEST(QueueNumaTest, AutoByConsumer) {
+    RTI_QUEUE_CFG cfg = {1024, 64, 2, RTI_QUEUE_SCHED_STRICT, {0}, RTI_QUEUE_NUMA_AUTO};
+    RTI_QUEUE *queue = nullptr;
+    ASSERT_EQ(RTI_QueueCreate(&cfg, &queue), RTI_OK);
+    EXPECT_EQ(RTIPriv_QueueNumaNode(queue), -1);
+    void *producer = nullptr;
+    void *consumer = nullptr;
+    ASSERT_EQ(RTI_QueueProducerCreate(queue, &producer), RTI_OK);
+    EXPECT_EQ(RTIPriv_QueueNumaNode(queue), -1) << "producers do not place the queue";
+    ASSERT_EQ(RTI_QueueConsumerCreate(queue, &consumer), RTI_OK);
+    int node = TestNumaCpuNode();
+    ASSERT_GE(node, 0);
+    EXPECT_EQ(RTIPriv_QueueNumaNode(queue), node);
+    EXPECT_TRUE(TestNumaIsPreferred(queue, node));
+
+    RTI_QueueProducerDelete(producer);
+    RTI_QueueConsumerDelete(consumer);
+    RTI_QueueDelete(queue);
+}
+
+/**
+ * @brief explicit node is bound at creation, NONE is never bound
+ *
+ */
+TEST(QueueNumaTest, ExplicitAndNone) {
+    RTI_QUEUE_CFG cfg = {64, 64, 1, RTI_QUEUE_SCHED_STRICT, {0}, RTI_QUEUE_NUMA_NODE(0)};
+    RTI_QUEUE *queue = nullptr;
+    ASSERT_EQ(RTI_QueueCreate(&cfg, &queue), RTI_OK);
+    EXPECT_EQ(RTIPriv_QueueNumaNode(queue), 0);
+    EXPECT_TRUE(TestNumaIsPreferred(queue, 0));
+    RTI_QueueDelete(queue);
+
+    cfg.numaNode = RTI_QUEUE_NUMA_NONE;
+    ASSERT_EQ(RTI_QueueCreate(&cfg, &queue), RTI_OK);
+    void *consumer = nullptr;
+    ASSERT_EQ(RTI_QueueConsumerCreate(queue, &consumer), RTI_OK);
+    EXPECT_EQ(RTIPriv_QueueNumaNode(queue), -1);
+    EXPECT_EQ(RTI_QueueNumaBind(queue, 0), RTI_OK);
+    EXPECT_EQ(RTIPriv_QueueNumaNode(queue), 0);
+    EXPECT_EQ(RTI_QueueNumaBind(queue, -1), RTI_ERR_INVALID_PARAM);
+    EXPECT_EQ(RTI_QueueNumaBind(queue, 4096), RTI_ERR_INVALID_PARAM);
+    RTI_QueueConsumerDelete(consumer);
+    RTI_QueueDelete(queue);
+}
+
+/**
+ * @brief a configuration without numaNode is never placed, AUTO is opt-in
+ *
+ */
+TEST(QueueNumaTest, DefaultIsNone) {
+    RTI_QUEUE_CFG cfg = {64, 64, 1, RTI_QUEUE_SCHED_STRICT, {0}};
+    EXPECT_EQ(cfg.numaNode, RTI_QUEUE_NUMA_NONE);
+    RTI_QUEUE *queue = nullptr;
+    ASSERT_EQ(RTI_QueueCreate(&cfg, &queue), RTI_OK);
+    void *consumer = nullptr;
+    ASSERT_EQ(RTI_QueueConsumerCreate(queue, &consumer), RTI_OK);
+    EXPECT_EQ(RTIPriv_QueueNumaNode(queue), -1) << "first consumer does not move it";
+    RTI_QueueConsumerDelete(consumer);
+    RTI_QueueDelete(queue);
+}
+
+#endif
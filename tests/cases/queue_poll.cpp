@@ -0,0 +1,170 @@
+/**
+ * @file queue_poll.cpp
+ * @author CYK-Dot
+ * @brief testcases for pollable consumers of built-in queue backend
+ * @version 0.1
+ * @date 2026-10-16
+ *
+ * @copyright Copyright (c) 2025 CYK-Dot, MIT License.
+ */
+
+/* Header import ------------------------------------------------------------------*/
+#include <gtest/gtest.h>
+#include <sys/epoll.h>
+#include <unistd.h>
+#include <chrono>
+#include <thread>
+#include "rti_queue.h"
+
+/* Config macros ------------------------------------------------------------------*/
+#if defined(RTI_TEST_COMMON) && RTI_ENABLE_OS_WAIT == 1
+
+/* Mock variables and functions  --------------------------------------------------*/
+RTI_QUEUE_IFX_DEFINE(poll_vlan_ifx, 4, sizeof(uint32_t), 1, RTI_QUEUE_SCHED_STRICT)
+
+/* Test suites --------------------------------------------------------------------*/
+
+/**
+ * @brief testcases for two queues multiplexed on one epoll
+ *
+ */
+class QueuePollTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        RTI_QUEUE_CFG cfg = {8, sizeof(uint32_t), 1, RTI_QUEUE_SCHED_STRICT, {0}};
+        epfd = epoll_create1(EPOLL_CLOEXEC);
+        ASSERT_GE(epfd, 0);
+        for (int i = 0; i < 2; i++) {
+            ASSERT_EQ(RTI_QueueCreate(&cfg, &queue[i]), RTI_OK);
+            ASSERT_EQ(RTI_QueueProducerCreate(queue[i], &producer[i]), RTI_OK);
+            ASSERT_EQ(RTI_QueueConsumerCreate(queue[i], &consumer[i]), RTI_OK);
+            int fd = RTI_QueueConsumerGetFd(consumer[i]);
+            ASSERT_GE(fd, 0);
+            struct epoll_event ev = {};
+            ev.events = EPOLLIN;
+            ev.data.u32 = (uint32_t)i;
+            ASSERT_EQ(epoll_ctl(epfd, EPOLL_CTL_ADD, fd, &ev), 0);
+        }
+    }
+    void TearDown() override {
+        for (int i = 0; i < 2; i++) {
+            RTI_QueueProducerDelete(producer[i]);
+            RTI_QueueConsumerDelete(consumer[i]);
+            RTI_QueueDelete(queue[i]);
+        }
+        close(epfd);
+    }
+    /* returns readiness bitmap of the two consumers */
+    unsigned Poll(int timeoutMs) {
+        struct epoll_event evs[2];
+        int n = epoll_wait(epfd, evs, 2, timeoutMs);
+        unsigned ready = 0;
+        for (int i = 0; i < n; i++) {
+            ready |= 1u << evs[i].data.u32;
+        }
+        return ready;
+    }
+    RTI_ERR Recv(int idx, uint32_t *msg) {
+        size_t size = sizeof(*msg);
+        return RTI_QueueRecv(consumer[idx], msg, &size);
+    }
+    int epfd;
+    RTI_QUEUE *queue[2];
+    void *producer[2];
+    void *consumer[2];
+};
+
+/* Test cases ---------------------------------------------------------------------*/
+
+/**
+ * @brief fd is readable while messages are pending and cleared after drain
+ *
+ */
+TEST_F(QueuePollTest, ReadableUntilDrained) {
+    EXPECT_EQ(Poll(0), 0u);
+    uint32_t msg = 1;
+    ASSERT_EQ(RTI_QueueSend(producer[1], &msg, sizeof(msg), 0), RTI_OK);
+    ASSERT_EQ(RTI_QueueSend(producer[1], &msg, sizeof(msg), 0), RTI_OK);
+    EXPECT_EQ(Poll(0), 2u);
+    EXPECT_EQ(Recv(1, &msg), RTI_OK);
+    EXPECT_EQ(Poll(0), 2u) << "still one message pending";
+    EXPECT_EQ(Recv(1, &msg), RTI_OK);
+    EXPECT_EQ(Poll(0), 2u) << "cleared only when receive sees empty";
+    EXPECT_EQ(Recv(1, &msg), RTI_ERR_QUEUE_EMPTY);
+    EXPECT_EQ(Poll(0), 0u);
+}
+
+/**
+ * @brief messages queued before fd is created make it readable at once
+ *
+ */
+TEST_F(QueuePollTest, PendingBeforeFd) {
+    void *late = nullptr;
+    ASSERT_EQ(RTI_QueueConsumerCreate(queue[0], &late), RTI_OK);
+    uint32_t msg = 1;
+    ASSERT_EQ(RTI_QueueSend(producer[0], &msg, sizeof(msg), 0), RTI_OK);
+    int fd = RTI_QueueConsumerGetFd(late);
+    ASSERT_GE(fd, 0);
+    EXPECT_EQ(RTI_QueueConsumerGetFd(late), fd) << "fd is created once";
+    struct epoll_event ev = {};
+    ev.events = EPOLLIN;
+    ev.data.u32 = 1;
+    int lateEp = epoll_create1(EPOLL_CLOEXEC);
+    ASSERT_EQ(epoll_ctl(lateEp, EPOLL_CTL_ADD, fd, &ev), 0);
+    EXPECT_EQ(epoll_wait(lateEp, &ev, 1, 0), 1);
+    close(lateEp);
+    RTI_QueueConsumerDelete(late);
+}
+
+/**
+ * @brief one reactor thread serves many VLANs without losing messages
+ *
+ */
+TEST_F(QueuePollTest, ReactorMultiplex) {
+    const uint32_t total = 5000;
+    std::thread senders[2];
+    for (int i = 0; i < 2; i++) {
+        senders[i] = std::thread([this, i, total]() {
+            for (uint32_t n = 0; n < total; n++) {
+                while (RTI_QueueSend(producer[i], &n, sizeof(n), 0) == RTI_ERR_QUEUE_FULL) {
+                    std::this_thread::yield();
+                }
+                if (n % 500 == 0) {
+                    std::this_thread::sleep_for(std::chrono::microseconds(300));
+                }
+            }
+        });
+    }
+    uint32_t expect[2] = {0, 0};
+    while (expect[0] < total || expect[1] < total) {
+        unsigned ready = Poll(5000);
+        ASSERT_NE(ready, 0u) << "reactor missed a wakeup";
+        for (int i = 0; i < 2; i++) {
+            uint32_t msg;
+            while ((ready & (1u << i)) != 0 && Recv(i, &msg) == RTI_OK) {
+                ASSERT_EQ(msg, expect[i]);
+                expect[i]++;
+            }
+        }
+    }
+    senders[0].join();
+    senders[1].join();
+}
+
+/**
+ * @brief fd is reachable through VLAN interface
+ *
+ */
+TEST_F(QueuePollTest, FdThroughInterface) {
+    RTI_VLAN_IFX *ifx = &poll_vlan_ifx.ifx;
+    void *vlan = ifx->createF();
+    ASSERT_NE(vlan, nullptr);
+    void *vlanConsumer = ifx->createConsumerF();
+    ASSERT_NE(ifx->consumerFdF, nullptr);
+    EXPECT_GE(ifx->consumerFdF(vlanConsumer), 0);
+    EXPECT_EQ(RTI_QueueConsumerGetFd(nullptr), -1);
+    ifx->deleteConsumerF(vlanConsumer);
+    ifx->deleteF(vlan);
+}
+
+#endif
@@ -0,0 +1,158 @@
+/**
+ * @file queue_qos.cpp
+ * @author CYK-Dot
+ * @brief testcases for priority lanes of built-in queue backend
+ * @version 0.1
+ * @date 2026-10-16
+ *
+ * @copyright Copyright (c) 2025 CYK-Dot, MIT License.
+ */
+
+/* Header import ------------------------------------------------------------------*/
+#include <gtest/gtest.h>
+#include "rti_queue.h"
+
+/* Config macros ------------------------------------------------------------------*/
+#ifdef RTI_TEST_COMMON
+
+/* Mock variables and functions  --------------------------------------------------*/
+RTI_VLAN_REGISTER_STATIC_QOS_WITH_ID(QOS_VLAN, 26, 4, sizeof(uint32_t), 2, RTI_QUEUE_SCHED_STRICT);
+
+/* Test suites --------------------------------------------------------------------*/
+
+/**
+ * @brief testcases for queue created from configuration
+ *
+ */
+class QueueQosTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        queue = nullptr;
+        producer = nullptr;
+        consumer = nullptr;
+    }
+    void TearDown() override {
+        RTI_QueueProducerDelete(producer);
+        RTI_QueueConsumerDelete(consumer);
+        RTI_QueueDelete(queue);
+    }
+    void Open(const RTI_QUEUE_CFG *cfg) {
+        ASSERT_EQ(RTI_QueueCreate(cfg, &queue), RTI_OK);
+        ASSERT_EQ(RTI_QueueProducerCreate(queue, &producer), RTI_OK);
+        ASSERT_EQ(RTI_QueueConsumerCreate(queue, &consumer), RTI_OK);
+    }
+    uint32_t Recv(void) {
+        uint32_t msg = 0;
+        size_t size = sizeof(msg);
+        EXPECT_EQ(RTI_QueueRecv(consumer, &msg, &size), RTI_OK);
+        EXPECT_EQ(size, sizeof(msg));
+        return msg;
+    }
+    RTI_QUEUE *queue;
+    void *producer;
+    void *consumer;
+};
+
+/* Test cases ---------------------------------------------------------------------*/
+
+/**
+ * @brief invalid configuration should be rejected
+ *
+ */
+TEST_F(QueueQosTest, InvalidConfig) {
+    RTI_QUEUE_CFG cfg = {6, sizeof(uint32_t), 1, RTI_QUEUE_SCHED_STRICT, {0}};
+    EXPECT_EQ(RTI_QueueCreate(&cfg, &queue), RTI_ERR_INVALID_PARAM) << "depth not power of 2";
+    cfg.depth = 8;
+    cfg.lanes = RTI_QUEUE_LANES_MAX + 1;
+    EXPECT_EQ(RTI_QueueCreate(&cfg, &queue), RTI_ERR_INVALID_PARAM) << "too many lanes";
+    EXPECT_EQ(RTI_QueueMemSize(&cfg), 0);
+}
+
+/**
+ * @brief strict priority always drains lower lane first
+ *
+ */
+TEST_F(QueueQosTest, StrictPriority) {
+    RTI_QUEUE_CFG cfg = {4, sizeof(uint32_t), 3, RTI_QUEUE_SCHED_STRICT, {0}};
+    Open(&cfg);
+    uint32_t msg[] = {20, 0, 10, 21, 1};
+    uint8_t lane[] = {2, 0, 1, 2, 0};
+    for (size_t i = 0; i < sizeof(msg) / sizeof(msg[0]); i++) {
+        EXPECT_EQ(RTI_QueueSend(producer, &msg[i], sizeof(msg[i]), lane[i]), RTI_OK);
+    }
+    EXPECT_EQ(Recv(), 0u);
+    EXPECT_EQ(Recv(), 1u);
+    EXPECT_EQ(Recv(), 10u);
+    EXPECT_EQ(Recv(), 20u);
+    EXPECT_EQ(Recv(), 21u);
+    uint32_t out;
+    size_t size = sizeof(out);
+    EXPECT_EQ(RTI_QueueRecv(consumer, &out, &size), RTI_ERR_QUEUE_EMPTY);
+}
+
+/**
+ * @brief weighted round-robin shares lanes by weights
+ *
+ */
+TEST_F(QueueQosTest, WeightedRoundRobin) {
+    RTI_QUEUE_CFG cfg = {8, sizeof(uint32_t), 2, RTI_QUEUE_SCHED_WRR, {2, 1}};
+    Open(&cfg);
+    for (uint32_t i = 0; i < 4; i++) {
+        uint32_t high = i, low = 100 + i;
+        EXPECT_EQ(RTI_QueueSend(producer, &high, sizeof(high), 0), RTI_OK);
+        EXPECT_EQ(RTI_QueueSend(producer, &low, sizeof(low), 1), RTI_OK);
+    }
+    uint32_t expect[] = {0, 1, 100, 2, 3, 101, 102, 103};
+    for (uint32_t value : expect) {
+        EXPECT_EQ(Recv(), value);
+    }
+}
+
+/**
+ * @brief lanes are full independently, and lane index is checked
+ *
+ */
+TEST_F(QueueQosTest, LaneFullAndInvalid) {
+    RTI_QUEUE_CFG cfg = {2, sizeof(uint32_t), 2, RTI_QUEUE_SCHED_STRICT, {0}};
+    Open(&cfg);
+    uint32_t msg = 1;
+    EXPECT_EQ(RTI_QueueSend(producer, &msg, sizeof(msg), 1), RTI_OK);
+    EXPECT_EQ(RTI_QueueSend(producer, &msg, sizeof(msg), 1), RTI_OK);
+    EXPECT_EQ(RTI_QueueSend(producer, &msg, sizeof(msg), 1), RTI_ERR_QUEUE_FULL);
+    EXPECT_EQ(RTI_QueueSend(producer, &msg, sizeof(msg), 0), RTI_OK);
+    EXPECT_EQ(RTI_QueueSend(producer, &msg, sizeof(msg), 2), RTI_ERR_INVALID_PARAM);
+    uint64_t tooLong = 0;
+    EXPECT_EQ(RTI_QueueSend(producer, &tooLong, sizeof(tooLong), 0), RTI_ERR_INVALID_PARAM);
+}
+
+/**
+ * @brief VLAN registered with lanes works through its interface
+ *
+ */
+TEST_F(QueueQosTest, RegisterStaticQos) {
+    RTI_VLAN_DESC desc;
+    ASSERT_EQ(RTIPriv_VlanSelect(26, &desc), RTI_OK);
+    EXPECT_STREQ(desc.name, "QOS_VLAN");
+    EXPECT_EQ(desc.lanes, 2);
+
+    void *vlan = desc.ifx->createF();
+    ASSERT_NE(vlan, nullptr);
+    void *vlanProducer = desc.ifx->createProducerF();
+    void *vlanConsumer = desc.ifx->createConsumerF();
+    ASSERT_NE(vlanProducer, nullptr);
+    ASSERT_NE(vlanConsumer, nullptr);
+
+    uint32_t low = 7, high = 3;
+    EXPECT_EQ(desc.ifx->sendF(vlanProducer, &low, sizeof(low), 1), RTI_OK);
+    EXPECT_EQ(desc.ifx->sendF(vlanProducer, &high, sizeof(high), 0), RTI_OK);
+    uint32_t out = 0;
+    size_t size = sizeof(out);
+    EXPECT_EQ(desc.ifx->recvF(vlanConsumer, &out, &size), RTI_OK);
+    EXPECT_EQ(out, high);
+
+    desc.ifx->deleteProducerF(vlanProducer);
+    desc.ifx->deleteConsumerF(vlanConsumer);
+    desc.ifx->deleteF(vlan);
+}
+
+#endif
@@ -0,0 +1,149 @@
+/**
+ * @file queue_rate.cpp
+ * @author CYK-Dot
+ * @brief testcases for token bucket rate limiter of built-in queue
+ * @version 0.1
+ * @date 2026-10-16
+ *
+ * @copyright Copyright (c) 2025 CYK-Dot, MIT License.
+ */
+
+/* Header import ------------------------------------------------------------------*/
+#include <gtest/gtest.h>
+#include <chrono>
+#include "rti_queue.h"
+#include "test_vlanid.h"
+
+/* Config macros ------------------------------------------------------------------*/
+#if defined(RTI_TEST_COMMON) && RTI_ENABLE_RATE_LIMIT == 1
+
+/* Mock variables and functions  --------------------------------------------------*/
+RTI_VLAN_REGISTER_STATIC_QOS_OPTS_WITH_ID(RATE_VLAN, 30, 16, sizeof(uint32_t), 1, RTI_QUEUE_SCHED_STRICT, .rate = &RTI_VLANRATE_RATE_VLAN);
+RTI_VLAN_REGISTER_STATIC_QOS_WITH_ID(RATE_OVERFLOW_VLAN, 31, 16, sizeof(uint32_t), 1, RTI_QUEUE_SCHED_STRICT);
+
+/**
+ * @brief count messages left in a consumer
+ *
+ */
+static uint32_t TestRateDrain(RTI_VLAN_DESC *desc, void *consumer)
+{
+    uint32_t count = 0;
+    uint32_t msg = 0;
+    size_t size = sizeof(msg);
+    while (desc->ifx->recvF(consumer, &msg, &size) == RTI_OK) {
+        count++;
+        size = sizeof(msg);
+    }
+    return count;
+}
+
+/* Test suites --------------------------------------------------------------------*/
+
+/* Test cases ---------------------------------------------------------------------*/
+
+/**
+ * @brief VLAN limited by rti_config.json diverts beyond its burst to VLAN 31
+ *
+ */
+TEST(QueueRateTest, DivertByConfig) {
+    RTI_VLAN_DESC limited, overflow;
+    ASSERT_EQ(RTIPriv_VlanSelect(30, &limited), RTI_OK);
+    ASSERT_EQ(RTIPriv_VlanSelect(31, &overflow), RTI_OK);
+    void *limitedVlan = limited.ifx->createF();
+    void *overflowVlan = overflow.ifx->createF();
+    ASSERT_NE(limitedVlan, nullptr);
+    ASSERT_NE(overflowVlan, nullptr);
+    void *producer = limited.ifx->createProducerF();
+    void *limitedConsumer = limited.ifx->createConsumerF();
+    void *overflowConsumer = overflow.ifx->createConsumerF();
+
+    // 1 message per second with burst 4, the test finishes long before a refill
+    for (uint32_t i = 0; i < 10; i++) {
+        ASSERT_EQ(limited.ifx->sendF(producer, &i, sizeof(i), 0), RTI_OK);
+    }
+    EXPECT_EQ(TestRateDrain(&limited, limitedConsumer), 4u);
+    EXPECT_EQ(TestRateDrain(&overflow, overflowConsumer), 6u);
+    RTI_QUEUE_BUF buf;
+    EXPECT_EQ(RTI_QueueSendAcquire(producer, sizeof(uint32_t), 0, &buf), RTI_ERR_RATE_LIMITED);
+
+    limited.ifx->deleteProducerF(producer);
+    limited.ifx->deleteConsumerF(limitedConsumer);
+    overflow.ifx->deleteConsumerF(overflowConsumer);
+    limited.ifx->deleteF(limitedVlan);
+    overflow.ifx->deleteF(overflowVlan);
+}
+
+/**
+ * @brief lanes beyond the overflow VLAN fold to its last lane when diverted
+ *
+ */
+TEST(QueueRateTest, DivertLaneClamp) {
+    RTI_VLAN_DESC overflow;
+    ASSERT_EQ(RTIPriv_VlanSelect(31, &overflow), RTI_OK);
+    void *overflowVlan = overflow.ifx->createF();
+    ASSERT_NE(overflowVlan, nullptr);
+    void *overflowConsumer = overflow.ifx->createConsumerF();
+
+    RTI_QUEUE_CFG cfg = {16, sizeof(uint32_t), 4, RTI_QUEUE_SCHED_STRICT, {0}};
+    RTI_QUEUE *queue = nullptr;
+    ASSERT_EQ(RTI_QueueCreate(&cfg, &queue), RTI_OK);
+    void *producer = nullptr;
+    ASSERT_EQ(RTI_QueueProducerCreate(queue, &producer), RTI_OK);
+    RTI_VLAN_RATE_CFG rate = {1, 1, RTI_VLAN_RATE_DIVERT, 31};
+    ASSERT_EQ(RTI_QueueRateSet(queue, &rate), RTI_OK);
+
+    uint32_t msg = 0;
+    ASSERT_EQ(RTI_QueueSend(producer, &msg, sizeof(msg), 3), RTI_OK);
+    for (msg = 1; msg < 4; msg++) {
+        ASSERT_EQ(RTI_QueueSend(producer, &msg, sizeof(msg), (uint8_t)msg), RTI_OK);
+    }
+    EXPECT_EQ(RTIPriv_QueueUsed(queue), 1u);
+    EXPECT_EQ(TestRateDrain(&overflow, overflowConsumer), 3u);
+
+    RTI_QueueProducerDelete(producer);
+    RTI_QueueDelete(queue);
+    overflow.ifx->deleteConsumerF(overflowConsumer);
+    overflow.ifx->deleteF(overflowVlan);
+}
+
+/**
+ * @brief drop and block policies set at runtime, removing the limit
+ *
+ */
+TEST(QueueRateTest, DropAndBlock) {
+    RTI_QUEUE_CFG cfg = {64, sizeof(uint32_t), 1, RTI_QUEUE_SCHED_STRICT, {0}};
+    RTI_QUEUE *queue = nullptr;
+    ASSERT_EQ(RTI_QueueCreate(&cfg, &queue), RTI_OK);
+    void *producer = nullptr;
+    ASSERT_EQ(RTI_QueueProducerCreate(queue, &producer), RTI_OK);
+    uint32_t msg = 0;
+
+    RTI_VLAN_RATE_CFG rate = {1, 2, RTI_VLAN_RATE_DROP, 0};
+    ASSERT_EQ(RTI_QueueRateSet(queue, &rate), RTI_OK);
+    EXPECT_EQ(RTI_QueueSend(producer, &msg, sizeof(msg), 0), RTI_OK);
+    EXPECT_EQ(RTI_QueueSend(producer, &msg, sizeof(msg), 0), RTI_OK);
+    EXPECT_EQ(RTI_QueueSend(producer, &msg, sizeof(msg), 0), RTI_ERR_RATE_LIMITED);
+    EXPECT_EQ(RTI_QueueSend(producer, &msg, 2 * sizeof(msg), 0), RTI_ERR_INVALID_PARAM);
+    EXPECT_EQ(RTIPriv_QueueUsed(queue), 2u);
+
+    rate = {1000, 1, RTI_VLAN_RATE_BLOCK, 0};
+    ASSERT_EQ(RTI_QueueRateSet(queue, &rate), RTI_OK);
+    auto start = std::chrono::steady_clock::now();
+    for (int i = 0; i < 21; i++) {
+        ASSERT_EQ(RTI_QueueSend(producer, &msg, sizeof(msg), 0), RTI_OK);
+    }
+    EXPECT_GE(std::chrono::steady_clock::now() - start, std::chrono::milliseconds(19));
+    EXPECT_EQ(RTIPriv_QueueUsed(queue), 23u);
+
+    ASSERT_EQ(RTI_QueueRateSet(queue, nullptr), RTI_OK);
+    for (int i = 0; i < 20; i++) {
+        ASSERT_EQ(RTI_QueueSend(producer, &msg, sizeof(msg), 0), RTI_OK);
+    }
+    rate = {1, 1, RTI_VLAN_RATE_DIVERT + 1, 0};
+    EXPECT_EQ(RTI_QueueRateSet(queue, &rate), RTI_ERR_INVALID_PARAM);
+
+    RTI_QueueProducerDelete(producer);
+    RTI_QueueDelete(queue);
+}
+
+#endif
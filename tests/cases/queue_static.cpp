@@ -0,0 +1,106 @@
+/**
+ * @file queue_static.cpp
+ * @author CYK-Dot
+ * @brief testcases for malloc-free VLANs generated from rti_config.json
+ * @version 0.1
+ * @date 2026-10-16
+ *
+ * @copyright Copyright (c) 2025 CYK-Dot, MIT License.
+ */
+
+/* Header import ------------------------------------------------------------------*/
+#include <gtest/gtest.h>
+#include "rti_queue.h"
+
+/* Config macros ------------------------------------------------------------------*/
+#ifdef RTI_TEST_COMMON
+#include "test_static.h"
+
+/* Mock variables and functions  --------------------------------------------------*/
+
+/**
+ * @brief check a handle lives in the generated handle pool
+ *
+ */
+static bool TestStaticInPool(void *handle)
+{
+    uint8_t *addr = (uint8_t *)handle;
+    return addr >= RTI_VLANPOOL_STATIC_VLAN && addr < RTI_VLANPOOL_STATIC_VLAN + sizeof(RTI_VLANPOOL_STATIC_VLAN);
+}
+
+/* Test suites --------------------------------------------------------------------*/
+
+/* Test cases ---------------------------------------------------------------------*/
+
+/**
+ * @brief generated VLAN lives in .bss storage, its pool bounds alive handles
+ *
+ */
+TEST(QueueStaticTest, GeneratedVlan) {
+    RTI_VLAN_DESC desc;
+    ASSERT_EQ(RTIPriv_VlanSelect(34, &desc), RTI_OK);
+    EXPECT_EQ(desc.lanes, 2);
+    void *vlan = desc.ifx->createF();
+    ASSERT_EQ(vlan, (void *)RTI_VLANMEM_STATIC_VLAN);
+
+    void *consumer = desc.ifx->createConsumerF();
+    void *producer1 = desc.ifx->createProducerF();
+    void *producer2 = desc.ifx->createProducerF();
+    ASSERT_TRUE(TestStaticInPool(consumer));
+    ASSERT_TRUE(TestStaticInPool(producer1));
+    ASSERT_TRUE(TestStaticInPool(producer2));
+    EXPECT_EQ(desc.ifx->createProducerF(), nullptr) << "pool of 3 handles is exhausted";
+    EXPECT_EQ(RTI_QueuePoolSet((RTI_QUEUE *)vlan, nullptr, 0), RTI_ERR_FAILED);
+
+    desc.ifx->deleteProducerF(producer2);
+    EXPECT_EQ(desc.ifx->createProducerF(), producer2);
+
+    uint64_t msg = 7;
+    ASSERT_EQ(desc.ifx->sendF(producer1, &msg, sizeof(msg), 1), RTI_OK);
+    msg = 0;
+    size_t size = sizeof(msg);
+    ASSERT_EQ(desc.ifx->recvF(consumer, &msg, &size), RTI_OK);
+    EXPECT_EQ(msg, 7u);
+    EXPECT_EQ(desc.ifx->sendF(producer1, &msg, 2 * sizeof(msg), 0), RTI_ERR_INVALID_PARAM);
+
+    desc.ifx->deleteProducerF(producer1);
+    desc.ifx->deleteProducerF(producer2);
+    desc.ifx->deleteConsumerF(consumer);
+    desc.ifx->deleteF(vlan);
+    EXPECT_EQ(desc.ifx->createF(), vlan) << "re-created in the same storage";
+    desc.ifx->deleteF(vlan);
+#if RTI_ENABLE_DYNAMIC_VLAN == 1
+    EXPECT_EQ(sizeof(RTI_VLANTABLE_TEST_CASES), RTI_VLAN_VLANTABLE_SIZE(32));
+#endif
+}
+
+/**
+ * @brief handle pool set on a heap queue, handles created before keep heap memory
+ *
+ */
+TEST(QueueStaticTest, PoolSet) {
+    RTI_QUEUE_CFG cfg = {4, sizeof(uint32_t), 1, RTI_QUEUE_SCHED_STRICT, {0}};
+    RTI_QUEUE *queue = nullptr;
+    ASSERT_EQ(RTI_QueueCreate(&cfg, &queue), RTI_OK);
+    alignas(RTI_CACHELINE_SIZE) static uint8_t pool[RTI_QUEUE_POOL_SIZE(1)];
+    void *heapProducer = nullptr;
+    void *producer = nullptr;
+    void *consumer = nullptr;
+    ASSERT_EQ(RTI_QueueProducerCreate(queue, &heapProducer), RTI_OK);
+
+    EXPECT_EQ(RTI_QueuePoolSet(nullptr, pool, sizeof(pool)), RTI_ERR_INVALID_PARAM);
+    EXPECT_EQ(RTI_QueuePoolSet(queue, pool, RTI_QUEUE_HANDLE_SIZE - 1), RTI_ERR_INVALID_PARAM);
+    ASSERT_EQ(RTI_QueuePoolSet(queue, pool, sizeof(pool)), RTI_OK);
+    ASSERT_EQ(RTI_QueueProducerCreate(queue, &producer), RTI_OK);
+    EXPECT_EQ(RTI_QueueConsumerCreate(queue, &consumer), RTI_ERR_NO_MEMORY);
+    RTI_QueueProducerDelete(heapProducer);
+    RTI_QueueProducerDelete(producer);
+
+    ASSERT_EQ(RTI_QueuePoolSet(queue, nullptr, 0), RTI_OK);
+    ASSERT_EQ(RTI_QueueConsumerCreate(queue, &consumer), RTI_OK);
+    EXPECT_TRUE(consumer < (void *)pool || consumer >= (void *)(pool + sizeof(pool)));
+    RTI_QueueConsumerDelete(consumer);
+    RTI_QueueDelete(queue);
+}
+
+#endif
@@ -0,0 +1,143 @@
+/**
+ * @file queue_wait.cpp
+ * @author CYK-Dot
+ * @brief testcases for adaptive consumer wait of built-in queue backend
+ * @version 0.1
+ * @date 2026-10-16
+ *
+ * @copyright Copyright (c) 2025 CYK-Dot, MIT License.
+ */
+
+/* Header import ------------------------------------------------------------------*/
+#include <gtest/gtest.h>
+#include <chrono>
+#include <thread>
+#include "rti_queue.h"
+
+/* Config macros ------------------------------------------------------------------*/
+#if defined(RTI_TEST_COMMON) && RTI_ENABLE_OS_WAIT == 1
+
+/* Mock variables and functions  --------------------------------------------------*/
+RTI_QUEUE_IFX_DEFINE(wait_vlan_ifx, 4, sizeof(uint32_t), 1, RTI_QUEUE_SCHED_STRICT)
+
+/* Test suites --------------------------------------------------------------------*/
+
+/**
+ * @brief testcases for consumer waiting on an empty queue
+ *
+ */
+class QueueWaitTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        RTI_QUEUE_CFG cfg = {8, sizeof(uint32_t), 2, RTI_QUEUE_SCHED_STRICT, {0}};
+        ASSERT_EQ(RTI_QueueCreate(&cfg, &queue), RTI_OK);
+        ASSERT_EQ(RTI_QueueProducerCreate(queue, &producer), RTI_OK);
+        ASSERT_EQ(RTI_QueueConsumerCreate(queue, &consumer), RTI_OK);
+    }
+    void TearDown() override {
+        RTI_QueueProducerDelete(producer);
+        RTI_QueueConsumerDelete(consumer);
+        RTI_QueueDelete(queue);
+    }
+    RTI_ERR RecvWait(uint32_t *msg, int32_t timeoutMs) {
+        size_t size = sizeof(*msg);
+        return RTI_QueueRecvWait(consumer, msg, &size, timeoutMs);
+    }
+    RTI_QUEUE *queue;
+    void *producer;
+    void *consumer;
+};
+
+/* Test cases ---------------------------------------------------------------------*/
+
+/**
+ * @brief zero timeout never waits, positive timeout expires on empty queue
+ *
+ */
+TEST_F(QueueWaitTest, Timeout) {
+    uint32_t msg = 0;
+    EXPECT_EQ(RecvWait(&msg, 0), RTI_ERR_QUEUE_EMPTY);
+    auto start = std::chrono::steady_clock::now();
+    EXPECT_EQ(RecvWait(&msg, 30), RTI_ERR_QUEUE_EMPTY);
+    auto elapsed = std::chrono::steady_clock::now() - start;
+    EXPECT_GE(elapsed, std::chrono::milliseconds(30));
+    EXPECT_EQ(RTI_QueueRecvWait(consumer, &msg, nullptr, 0), RTI_ERR_INVALID_PARAM);
+}
+
+/**
+ * @brief queued message is returned without waiting
+ *
+ */
+TEST_F(QueueWaitTest, ReadyWithoutWait) {
+    uint32_t msg = 9, out = 0;
+    ASSERT_EQ(RTI_QueueSend(producer, &msg, sizeof(msg), 1), RTI_OK);
+    EXPECT_EQ(RecvWait(&out, -1), RTI_OK);
+    EXPECT_EQ(out, msg);
+}
+
+/**
+ * @brief parked consumer is woken up by a late producer
+ *
+ */
+TEST_F(QueueWaitTest, WakeParkedConsumer) {
+    std::thread sender([this]() {
+        std::this_thread::sleep_for(std::chrono::milliseconds(50));
+        uint32_t msg = 5;
+        EXPECT_EQ(RTI_QueueSend(producer, &msg, sizeof(msg), 0), RTI_OK);
+    });
+    uint32_t out = 0;
+    EXPECT_EQ(RecvWait(&out, 5000), RTI_OK);
+    EXPECT_EQ(out, 5u);
+    sender.join();
+}
+
+/**
+ * @brief no message is lost between parking and waking
+ *
+ */
+TEST_F(QueueWaitTest, NoLostWakeup) {
+    const uint32_t total = 20000;
+    std::thread sender([this, total]() {
+        for (uint32_t i = 0; i < total; i++) {
+            while (RTI_QueueSend(producer, &i, sizeof(i), 0) == RTI_ERR_QUEUE_FULL) {
+                std::this_thread::yield();
+            }
+            if (i % 1000 == 0) {
+                std::this_thread::sleep_for(std::chrono::microseconds(200));
+            }
+        }
+    });
+    for (uint32_t expect = 0; expect < total; expect++) {
+        uint32_t out = 0;
+        ASSERT_EQ(RecvWait(&out, 5000), RTI_OK);
+        ASSERT_EQ(out, expect);
+    }
+    sender.join();
+}
+
+/**
+ * @brief zero-copy wait and interface wait
+ *
+ */
+TEST_F(QueueWaitTest, AcquireWaitAndInterface) {
+    uint32_t msg = 3;
+    RTI_QUEUE_BUF buf;
+    EXPECT_EQ(RTI_QueueRecvAcquireWait(consumer, &buf, 1), RTI_ERR_QUEUE_EMPTY);
+    ASSERT_EQ(RTI_QueueSend(producer, &msg, sizeof(msg), 0), RTI_OK);
+    ASSERT_EQ(RTI_QueueRecvAcquireWait(consumer, &buf, -1), RTI_OK);
+    EXPECT_EQ(*(uint32_t *)buf.data, msg);
+    EXPECT_EQ(RTI_QueueRecvRelease(consumer, &buf), RTI_OK);
+
+    RTI_VLAN_IFX *ifx = &wait_vlan_ifx.ifx;
+    void *vlan = ifx->createF();
+    ASSERT_NE(vlan, nullptr);
+    void *vlanConsumer = ifx->createConsumerF();
+    ASSERT_NE(ifx->recvWaitF, nullptr);
+    uint32_t out = 0;
+    size_t size = sizeof(out);
+    EXPECT_EQ(ifx->recvWaitF(vlanConsumer, &out, &size, 1), RTI_ERR_QUEUE_EMPTY);
+    ifx->deleteConsumerF(vlanConsumer);
+    ifx->deleteF(vlan);
+}
+
+#endif
@@ -0,0 +1,130 @@
+/**
+ * @file route_core.cpp
+ * @author CYK-Dot
+ * @brief testcases for rule-based routing decision core
+ * @version 0.1
+ * @date 2026-10-16
+ *
+ * @copyright Copyright (c) 2025 CYK-Dot, MIT License.
+ */
+
+/* Header import ------------------------------------------------------------------*/
+#include <gtest/gtest.h>
+#include <vector>
+#include "rti_core.h"
+
+/* Config macros ------------------------------------------------------------------*/
+#ifdef RTI_TEST_COMMON
+
+/* Mock variables and functions  --------------------------------------------------*/
+static const RTI_ROUTE_RULE g_routeRules[] = {
+    {{1, 0, 0}, RTI_ROUTE_MATCH_SOURCE, 10},                            /* everything from source 1 */
+    {{0, 7, 0}, RTI_ROUTE_MATCH_TYPE, 20},                              /* every type 7 */
+    {{1, 7, 42}, RTI_ROUTE_MATCH_ALL, 30},                              /* exact flow */
+    {{2, 0, 5}, RTI_ROUTE_MATCH_SOURCE | RTI_ROUTE_MATCH_KEY, 10},      /* same VLAN as rule 0 */
+    {{0, 0, 0}, 0, 99},                                                 /* catch-all monitor */
+};
+
+/* Test suites --------------------------------------------------------------------*/
+
+/**
+ * @brief testcases for routing table compiled from g_routeRules
+ *
+ */
+class RouteCoreTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        ASSERT_EQ(RTI_RouteCreate(g_routeRules, sizeof(g_routeRules) / sizeof(g_routeRules[0]), &table), RTI_OK);
+    }
+    void TearDown() override {
+        RTI_RouteDelete(table);
+    }
+    std::vector<RTI_VlanId> Lookup(uint32_t source, uint32_t type, uint32_t key) {
+        RTI_ROUTE_ATTR attr = {source, type, key};
+        RTI_VlanId vlans[8];
+        size_t count = 8;
+        EXPECT_EQ(RTI_RouteLookup(table, &attr, vlans, &count), RTI_OK);
+        return std::vector<RTI_VlanId>(vlans, vlans + count);
+    }
+    RTI_ROUTE_TABLE *table;
+};
+
+/* Test cases ---------------------------------------------------------------------*/
+
+/**
+ * @brief matching rules are combined across fields in rule order
+ *
+ */
+TEST_F(RouteCoreTest, MatchFields) {
+    EXPECT_EQ(Lookup(1, 7, 42), (std::vector<RTI_VlanId>{10, 20, 30, 99}));
+    EXPECT_EQ(Lookup(1, 7, 43), (std::vector<RTI_VlanId>{10, 20, 99}));
+    EXPECT_EQ(Lookup(1, 8, 42), (std::vector<RTI_VlanId>{10, 99}));
+    EXPECT_EQ(Lookup(3, 7, 0), (std::vector<RTI_VlanId>{20, 99}));
+    EXPECT_EQ(Lookup(3, 8, 0), (std::vector<RTI_VlanId>{99}));
+    EXPECT_EQ(Lookup(2, 0, 5), (std::vector<RTI_VlanId>{10, 99}));
+}
+
+/**
+ * @brief VLAN reached by several rules is reported once
+ *
+ */
+TEST_F(RouteCoreTest, Deduplicate) {
+    const RTI_ROUTE_RULE rules[] = {
+        {{1, 0, 0}, RTI_ROUTE_MATCH_SOURCE, 5},
+        {{0, 2, 0}, RTI_ROUTE_MATCH_TYPE, 5},
+        {{0, 0, 3}, RTI_ROUTE_MATCH_KEY, 6},
+    };
+    RTI_ROUTE_TABLE *dup = nullptr;
+    ASSERT_EQ(RTI_RouteCreate(rules, 3, &dup), RTI_OK);
+    RTI_ROUTE_ATTR attr = {1, 2, 3};
+    RTI_VlanId vlans[4];
+    size_t count = 4;
+    EXPECT_EQ(RTI_RouteLookup(dup, &attr, vlans, &count), RTI_OK);
+    ASSERT_EQ(count, 2u);
+    EXPECT_EQ(vlans[0], 5);
+    EXPECT_EQ(vlans[1], 6);
+    attr.source = 0;
+    count = 4;
+    EXPECT_EQ(RTI_RouteLookup(dup, &attr, vlans, &count), RTI_OK);
+    ASSERT_EQ(count, 2u) << "second rule of VLAN 5 still routes alone";
+    EXPECT_EQ(vlans[0], 5);
+    RTI_RouteDelete(dup);
+}
+
+/**
+ * @brief short buffer reports the needed length, no match reports empty
+ *
+ */
+TEST_F(RouteCoreTest, BufferAndEmpty) {
+    RTI_ROUTE_ATTR attr = {1, 7, 42};
+    RTI_VlanId vlans[2];
+    size_t count = 2;
+    EXPECT_EQ(RTI_RouteLookup(table, &attr, vlans, &count), RTI_ERR_INVALID_PARAM);
+    EXPECT_EQ(count, 4u);
+    EXPECT_EQ(vlans[0], 10);
+    EXPECT_EQ(vlans[1], 20);
+
+    RTI_ROUTE_TABLE *empty = nullptr;
+    ASSERT_EQ(RTI_RouteCreate(nullptr, 0, &empty), RTI_OK);
+    count = 2;
+    EXPECT_EQ(RTI_RouteLookup(empty, &attr, vlans, &count), RTI_ERR_OBJECT_EMPTY);
+    EXPECT_EQ(count, 0u);
+    RTI_RouteDelete(empty);
+}
+
+/**
+ * @brief invalid rules should be rejected
+ *
+ */
+TEST_F(RouteCoreTest, InvalidRules) {
+    RTI_ROUTE_TABLE *bad = nullptr;
+    RTI_ROUTE_RULE rule = {{0, 0, 0}, 0x80, 1};
+    EXPECT_EQ(RTI_RouteCreate(&rule, 1, &bad), RTI_ERR_INVALID_PARAM);
+    std::vector<RTI_ROUTE_RULE> many(RTI_ROUTE_RULES_MAX + 1, RTI_ROUTE_RULE{{0, 0, 0}, 0, 1});
+    EXPECT_EQ(RTI_RouteCreate(many.data(), many.size(), &bad), RTI_ERR_INVALID_PARAM);
+    many.pop_back();
+    ASSERT_EQ(RTI_RouteCreate(many.data(), many.size(), &bad), RTI_OK) << "full table";
+    RTI_RouteDelete(bad);
+}
+
+#endif
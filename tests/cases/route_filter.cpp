@@ -0,0 +1,205 @@
+/**
+ * @file route_filter.cpp
+ * @author CYK-Dot
+ * @brief testcases for content-based consumer filters
+ * @version 0.1
+ * @date 2026-10-16
+ *
+ * @copyright Copyright (c) 2025 CYK-Dot, MIT License.
+ */
+
+/* Header import ------------------------------------------------------------------*/
+#include <gtest/gtest.h>
+#include <cstddef>
+#include <random>
+#include <vector>
+#include "rti_core.h"
+
+/* Config macros ------------------------------------------------------------------*/
+#ifdef RTI_TEST_COMMON
+
+/* Mock variables and functions  --------------------------------------------------*/
+
+/**
+ * @brief message header used by filter tests
+ *
+ */
+typedef struct {
+    uint32_t source;
+    uint16_t type;
+    uint8_t prio;
+    uint8_t flags;
+    uint64_t seq;
+} TEST_FILTER_MSG;
+
+static std::vector<uint64_t> g_sentSeq;
+static size_t g_sendLimit;
+
+static RTI_ERR MockFilterSend(void *producer, const void *msg, size_t size, uint8_t lane)
+{
+    (void)producer;
+    (void)lane;
+    if (g_sentSeq.size() >= g_sendLimit) {
+        return RTI_ERR_QUEUE_FULL;
+    }
+    EXPECT_EQ(size, sizeof(TEST_FILTER_MSG));
+    g_sentSeq.push_back(((const TEST_FILTER_MSG *)msg)->seq);
+    return RTI_OK;
+}
+
+static uint64_t RefField(const TEST_FILTER_MSG &msg, const RTI_FILTER_COND &cond)
+{
+    switch (cond.offset) {
+    case offsetof(TEST_FILTER_MSG, source): return msg.source;
+    case offsetof(TEST_FILTER_MSG, type): return msg.type;
+    case offsetof(TEST_FILTER_MSG, prio): return msg.prio;
+    case offsetof(TEST_FILTER_MSG, flags): return msg.flags;
+    default: return msg.seq;
+    }
+}
+
+static bool RefMatch(const TEST_FILTER_MSG &msg, const RTI_FILTER_COND &cond)
+{
+    uint64_t field = RefField(msg, cond);
+    switch (cond.op) {
+    case RTI_FILTER_OP_EQ: return field == cond.value;
+    case RTI_FILTER_OP_NE: return field != cond.value;
+    case RTI_FILTER_OP_LT: return field < cond.value;
+    case RTI_FILTER_OP_LE: return field <= cond.value;
+    case RTI_FILTER_OP_GT: return field > cond.value;
+    case RTI_FILTER_OP_GE: return field >= cond.value;
+    case RTI_FILTER_OP_RANGE: return cond.value <= field && field <= cond.value2;
+    default: return (field & cond.value) == cond.value2;
+    }
+}
+
+/* Test suites --------------------------------------------------------------------*/
+
+/**
+ * @brief testcases for filters over a random message batch
+ *
+ */
+class RouteFilterTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        std::mt19937 rng(7);
+        msgs.resize(203);
+        for (size_t i = 0; i < msgs.size(); i++) {
+            msgs[i].source = rng() % 8;
+            msgs[i].type = (uint16_t)(rng() % 1000);
+            msgs[i].prio = (uint8_t)rng();
+            msgs[i].flags = (uint8_t)rng();
+            msgs[i].seq = i;
+        }
+    }
+    std::vector<bool> Reference(const std::vector<RTI_FILTER_COND> &conds) {
+        std::vector<bool> result;
+        for (const TEST_FILTER_MSG &msg : msgs) {
+            bool pass = true;
+            for (const RTI_FILTER_COND &cond : conds) {
+                pass = pass && RefMatch(msg, cond);
+            }
+            result.push_back(pass);
+        }
+        return result;
+    }
+    std::vector<TEST_FILTER_MSG> msgs;
+};
+
+/* Test cases ---------------------------------------------------------------------*/
+
+/**
+ * @brief every operator over every block size agrees with scalar evaluation
+ *
+ */
+TEST_F(RouteFilterTest, EvalSameAsScalar) {
+    const std::vector<std::vector<RTI_FILTER_COND>> filters = {
+        {},
+        {{offsetof(TEST_FILTER_MSG, source), 4, RTI_FILTER_OP_EQ, 3, 0}},
+        {{offsetof(TEST_FILTER_MSG, source), 4, RTI_FILTER_OP_NE, 3, 0}},
+        {{offsetof(TEST_FILTER_MSG, type), 2, RTI_FILTER_OP_LT, 100, 0}},
+        {{offsetof(TEST_FILTER_MSG, type), 2, RTI_FILTER_OP_LT, 0, 0}},
+        {{offsetof(TEST_FILTER_MSG, type), 2, RTI_FILTER_OP_LE, 100, 0}},
+        {{offsetof(TEST_FILTER_MSG, prio), 1, RTI_FILTER_OP_GT, 200, 0}},
+        {{offsetof(TEST_FILTER_MSG, prio), 1, RTI_FILTER_OP_GE, 0, 0}},
+        {{offsetof(TEST_FILTER_MSG, prio), 1, RTI_FILTER_OP_GE, 128, 0}},
+        {{offsetof(TEST_FILTER_MSG, type), 2, RTI_FILTER_OP_RANGE, 250, 749}},
+        {{offsetof(TEST_FILTER_MSG, flags), 1, RTI_FILTER_OP_MASK, 0x81, 0x01}},
+        {{offsetof(TEST_FILTER_MSG, seq), 8, RTI_FILTER_OP_GE, 70, 0},
+         {offsetof(TEST_FILTER_MSG, source), 4, RTI_FILTER_OP_RANGE, 2, 5},
+         {offsetof(TEST_FILTER_MSG, flags), 1, RTI_FILTER_OP_MASK, 0x10, 0x10}},
+    };
+    for (size_t f = 0; f < filters.size(); f++) {
+        RTI_FILTER *filter = nullptr;
+        ASSERT_EQ(RTI_FilterCreate(filters[f].data(), filters[f].size(), &filter), RTI_OK);
+        std::vector<bool> expect = Reference(filters[f]);
+        for (size_t count : {(size_t)1, (size_t)63, (size_t)64, (size_t)65, msgs.size()}) {
+            uint64_t match[4] = {};
+            ASSERT_EQ(RTI_FilterEval(filter, msgs.data(), sizeof(TEST_FILTER_MSG), count, match), RTI_OK);
+            for (size_t i = 0; i < count; i++) {
+                ASSERT_EQ(((match[i / 64] >> (i % 64)) & 1) != 0, expect[i]) << "filter " << f << " msg " << i;
+            }
+            if (count % 64 != 0) {
+                EXPECT_EQ(match[count / 64] >> (count % 64), 0u) << "bits beyond count stay clear";
+            }
+        }
+        RTI_FilterDelete(filter);
+    }
+}
+
+/**
+ * @brief only passing messages are sent, a failed send reports progress
+ *
+ */
+TEST_F(RouteFilterTest, Send) {
+    RTI_FILTER_COND cond = {offsetof(TEST_FILTER_MSG, type), 2, RTI_FILTER_OP_RANGE, 0, 499};
+    RTI_FILTER *filter = nullptr;
+    ASSERT_EQ(RTI_FilterCreate(&cond, 1, &filter), RTI_OK);
+    RTI_VLAN_IFX ifx = {};
+    ifx.sendF = MockFilterSend;
+    std::vector<uint64_t> expect;
+    for (const TEST_FILTER_MSG &msg : msgs) {
+        if (msg.type <= 499) {
+            expect.push_back(msg.seq);
+        }
+    }
+    ASSERT_GT(expect.size(), 10u);
+
+    g_sentSeq.clear();
+    g_sendLimit = SIZE_MAX;
+    size_t done = 0;
+    EXPECT_EQ(RTI_FilterSend(filter, &ifx, nullptr, msgs.data(), sizeof(TEST_FILTER_MSG), msgs.size(), 0, &done), RTI_OK);
+    EXPECT_EQ(done, msgs.size());
+    EXPECT_EQ(g_sentSeq, expect);
+
+    g_sentSeq.clear();
+    g_sendLimit = 10;
+    EXPECT_EQ(RTI_FilterSend(filter, &ifx, nullptr, msgs.data(), sizeof(TEST_FILTER_MSG), msgs.size(), 0, &done), RTI_ERR_QUEUE_FULL);
+    EXPECT_EQ(done, expect[10]) << "stops at the message that failed";
+    RTI_FilterDelete(filter);
+}
+
+/**
+ * @brief malformed conditions and short strides should be rejected
+ *
+ */
+TEST_F(RouteFilterTest, Invalid) {
+    RTI_FILTER *filter = nullptr;
+    RTI_FILTER_COND cond = {0, 3, RTI_FILTER_OP_EQ, 0, 0};
+    EXPECT_EQ(RTI_FilterCreate(&cond, 1, &filter), RTI_ERR_INVALID_PARAM);
+    cond = {0, 4, RTI_FILTER_OP_RANGE, 5, 4};
+    EXPECT_EQ(RTI_FilterCreate(&cond, 1, &filter), RTI_ERR_INVALID_PARAM);
+    cond = {0, 4, 0x7f, 0, 0};
+    EXPECT_EQ(RTI_FilterCreate(&cond, 1, &filter), RTI_ERR_INVALID_PARAM);
+
+    cond = {offsetof(TEST_FILTER_MSG, seq), 8, RTI_FILTER_OP_EQ, 0, 0};
+    ASSERT_EQ(RTI_FilterCreate(&cond, 1, &filter), RTI_OK);
+    uint64_t match[4];
+    EXPECT_EQ(RTI_FilterEval(filter, msgs.data(), 8, 2, match), RTI_ERR_INVALID_PARAM);
+    RTI_VLAN_IFX ifx = {};
+    size_t done = 0;
+    EXPECT_EQ(RTI_FilterSend(filter, &ifx, nullptr, msgs.data(), sizeof(TEST_FILTER_MSG), 2, 0, &done), RTI_ERR_NOT_SUPPORTED);
+    RTI_FilterDelete(filter);
+}
+
+#endif
@@ -0,0 +1,91 @@
+/**
+ * @file route_static.cpp
+ * @author CYK-Dot
+ * @brief testcases for routing table generated from rti_config.json
+ * @version 0.1
+ * @date 2026-10-16
+ *
+ * @copyright Copyright (c) 2025 CYK-Dot, MIT License.
+ */
+
+/* Header import ------------------------------------------------------------------*/
+#include <gtest/gtest.h>
+#include "rti_core.h"
+#include "test_route.h"
+
+/* Config macros ------------------------------------------------------------------*/
+#ifdef RTI_TEST_COMMON
+
+/* Mock variables and functions  --------------------------------------------------*/
+
+/* same rules as "routes" in rti_config.json */
+static const RTI_ROUTE_RULE g_staticRules[] = {
+    {{1, 0, 0}, RTI_ROUTE_MATCH_SOURCE, 10},
+    {{0, 7, 0}, RTI_ROUTE_MATCH_TYPE, 20},
+    {{1, 7, 42}, RTI_ROUTE_MATCH_ALL, 30},
+    {{2, 0, 5}, RTI_ROUTE_MATCH_SOURCE | RTI_ROUTE_MATCH_KEY, 10},
+    {{0, 0, 0}, 0, 99},
+    {{0, 0x100, 0}, RTI_ROUTE_MATCH_TYPE, RTI_VLANID_AUTO_VLAN1},
+    {{0, 0x100, 0}, RTI_ROUTE_MATCH_TYPE, 100},
+};
+
+/* Test suites --------------------------------------------------------------------*/
+
+/* Test cases ---------------------------------------------------------------------*/
+
+/**
+ * @brief generated table decides like the table compiled at runtime
+ *
+ */
+TEST(RouteStaticTest, SameAsRuntime) {
+    RTI_ROUTE_TABLE *table = nullptr;
+    ASSERT_EQ(RTI_RouteCreate(g_staticRules, sizeof(g_staticRules) / sizeof(g_staticRules[0]), &table), RTI_OK);
+    const uint32_t values[] = {0, 1, 2, 5, 7, 42, 0x100};
+    for (uint32_t source : values) {
+        for (uint32_t type : values) {
+            for (uint32_t key : values) {
+                RTI_ROUTE_ATTR attr = {source, type, key};
+                RTI_VlanId expect[8], actual[8];
+                size_t expectCnt = 8, actualCnt = 8;
+                RTI_ERR expectErr = RTI_RouteLookup(table, &attr, expect, &expectCnt);
+                RTI_ERR actualErr = RTI_RouteStaticLookup_TEST_CASES(&attr, actual, &actualCnt);
+                ASSERT_EQ(actualErr, expectErr) << source << "," << type << "," << key;
+                ASSERT_EQ(actualCnt, expectCnt) << source << "," << type << "," << key;
+                for (size_t i = 0; i < expectCnt; i++) {
+                    EXPECT_EQ(actual[i], expect[i]);
+                }
+            }
+        }
+    }
+    RTI_RouteDelete(table);
+}
+
+/**
+ * @brief VLAN referenced by name resolves to the generated VLAN ID
+ *
+ */
+TEST(RouteStaticTest, VlanByName) {
+    RTI_ROUTE_ATTR attr = {3, 0x100, 0};
+    RTI_VlanId vlans[4];
+    size_t count = 4;
+    ASSERT_EQ(RTI_RouteStaticLookup_TEST_CASES(&attr, vlans, &count), RTI_OK);
+    ASSERT_EQ(count, 2u);
+    EXPECT_EQ(vlans[0], 99);
+    EXPECT_EQ(vlans[1], RTI_VLANID_AUTO_VLAN1);
+}
+
+/**
+ * @brief VLAN referenced by name and by ID is emitted once
+ *
+ */
+TEST(RouteStaticTest, VlanByNameAndId) {
+    static_assert(RTI_VLANID_AUTO_VLAN1 == 100, "rule 6 names the VLAN of rule 7 by ID");
+    EXPECT_EQ(RTI_ROUTE_TEST_CASES_DUPS[5], 0x40ull);
+    RTI_ROUTE_ATTR attr = {3, 0x100, 0};
+    RTI_VlanId vlans[4];
+    size_t count = 4;
+    ASSERT_EQ(RTI_RouteStaticLookup_TEST_CASES(&attr, vlans, &count), RTI_OK);
+    EXPECT_EQ(count, 2u);
+}
+
+#endif
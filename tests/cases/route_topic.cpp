@@ -0,0 +1,181 @@
+/**
+ * @file route_topic.cpp
+ * @author CYK-Dot
+ * @brief testcases for hierarchical topic router
+ * @version 0.1
+ * @date 2026-10-16
+ *
+ * @copyright Copyright (c) 2025 CYK-Dot, MIT License.
+ */
+
+/* Header import ------------------------------------------------------------------*/
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <string>
+#include <vector>
+#include "rti_topic.h"
+
+/* Config macros ------------------------------------------------------------------*/
+#ifdef RTI_TEST_COMMON
+
+/* Mock variables and functions  --------------------------------------------------*/
+
+/* Test suites --------------------------------------------------------------------*/
+
+/**
+ * @brief testcases for a topic router created per test
+ *
+ */
+class RouteTopicTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        ASSERT_EQ(RTI_TopicCreate(&router), RTI_OK);
+    }
+    void TearDown() override {
+        RTI_TopicDelete(router);
+    }
+    std::vector<RTI_VlanId> Lookup(const char *topic) {
+        RTI_VlanId vlans[16];
+        size_t count = 16;
+        RTI_ERR err = RTI_TopicLookup(router, topic, vlans, &count);
+        EXPECT_TRUE(err == RTI_OK || err == RTI_ERR_OBJECT_EMPTY) << topic;
+        std::vector<RTI_VlanId> result(vlans, vlans + count);
+        std::sort(result.begin(), result.end());
+        return result;
+    }
+    RTI_TOPIC_ROUTER *router;
+};
+
+/* Test cases ---------------------------------------------------------------------*/
+
+/**
+ * @brief '+' matches one level, '#' matches parent and any levels below
+ *
+ */
+TEST_F(RouteTopicTest, Wildcards) {
+    ASSERT_EQ(RTI_TopicSubscribe(router, "sensor/imu/+/raw", 1), RTI_OK);
+    ASSERT_EQ(RTI_TopicSubscribe(router, "sensor/#", 2), RTI_OK);
+    ASSERT_EQ(RTI_TopicSubscribe(router, "sensor/imu/left/raw", 3), RTI_OK);
+    ASSERT_EQ(RTI_TopicSubscribe(router, "+/+/+/raw", 4), RTI_OK);
+    ASSERT_EQ(RTI_TopicSubscribe(router, "#", 5), RTI_OK);
+    ASSERT_EQ(RTI_TopicSubscribe(router, "sensor/gps", 6), RTI_OK);
+
+    EXPECT_EQ(Lookup("sensor/imu/left/raw"), (std::vector<RTI_VlanId>{1, 2, 3, 4, 5}));
+    EXPECT_EQ(Lookup("sensor/imu/right/raw"), (std::vector<RTI_VlanId>{1, 2, 4, 5}));
+    EXPECT_EQ(Lookup("sensor/imu/right/filtered"), (std::vector<RTI_VlanId>{2, 5}));
+    EXPECT_EQ(Lookup("sensor/imu/raw"), (std::vector<RTI_VlanId>{2, 5})) << "'+' needs one level";
+    EXPECT_EQ(Lookup("sensor"), (std::vector<RTI_VlanId>{2, 5})) << "'#' includes parent level";
+    EXPECT_EQ(Lookup("sensor/gps"), (std::vector<RTI_VlanId>{2, 5, 6}));
+    EXPECT_EQ(Lookup("sensor/gpsx"), (std::vector<RTI_VlanId>{2, 5}));
+    EXPECT_EQ(Lookup("motor/a/b/raw"), (std::vector<RTI_VlanId>{4, 5}));
+}
+
+/**
+ * @brief compressed paths split on subscribe and merge back on unsubscribe
+ *
+ */
+TEST_F(RouteTopicTest, SplitAndMerge) {
+    ASSERT_EQ(RTI_TopicSubscribe(router, "a/b/c/d", 1), RTI_OK);
+    ASSERT_EQ(RTI_TopicSubscribe(router, "a/b/x", 2), RTI_OK);
+    ASSERT_EQ(RTI_TopicSubscribe(router, "a/b", 3), RTI_OK);
+    ASSERT_EQ(RTI_TopicSubscribe(router, "a/b/c/+", 4), RTI_OK);
+    EXPECT_EQ(Lookup("a/b/c/d"), (std::vector<RTI_VlanId>{1, 4}));
+    EXPECT_EQ(Lookup("a/b/x"), (std::vector<RTI_VlanId>{2}));
+    EXPECT_EQ(Lookup("a/b"), (std::vector<RTI_VlanId>{3}));
+    EXPECT_EQ(Lookup("a/b/c"), (std::vector<RTI_VlanId>{}));
+
+    ASSERT_EQ(RTI_TopicUnsubscribe(router, "a/b", 3), RTI_OK);
+    ASSERT_EQ(RTI_TopicUnsubscribe(router, "a/b/x", 2), RTI_OK);
+    ASSERT_EQ(RTI_TopicUnsubscribe(router, "a/b/c/+", 4), RTI_OK);
+    EXPECT_EQ(Lookup("a/b/c/d"), (std::vector<RTI_VlanId>{1}));
+    EXPECT_EQ(Lookup("a/b/c/e"), (std::vector<RTI_VlanId>{}));
+    EXPECT_EQ(Lookup("a/b"), (std::vector<RTI_VlanId>{}));
+
+    ASSERT_EQ(RTI_TopicSubscribe(router, "a/b/c/d/e", 5), RTI_OK);
+    ASSERT_EQ(RTI_TopicSubscribe(router, "a//c", 6), RTI_OK);
+    EXPECT_EQ(Lookup("a/b/c/d"), (std::vector<RTI_VlanId>{1}));
+    EXPECT_EQ(Lookup("a/b/c/d/e"), (std::vector<RTI_VlanId>{5}));
+    EXPECT_EQ(Lookup("a//c"), (std::vector<RTI_VlanId>{6})) << "empty level is a level";
+}
+
+/**
+ * @brief cached result follows incremental subscribe and unsubscribe
+ *
+ */
+TEST_F(RouteTopicTest, CacheInvalidate) {
+    ASSERT_EQ(RTI_TopicSubscribe(router, "cam/front", 1), RTI_OK);
+    EXPECT_EQ(Lookup("cam/front"), (std::vector<RTI_VlanId>{1}));
+    EXPECT_EQ(Lookup("cam/front"), (std::vector<RTI_VlanId>{1})) << "served from cache";
+    EXPECT_EQ(Lookup("cam/rear"), (std::vector<RTI_VlanId>{}));
+
+    ASSERT_EQ(RTI_TopicSubscribe(router, "cam/+", 2), RTI_OK);
+    EXPECT_EQ(Lookup("cam/front"), (std::vector<RTI_VlanId>{1, 2}));
+    EXPECT_EQ(Lookup("cam/rear"), (std::vector<RTI_VlanId>{2}));
+
+    ASSERT_EQ(RTI_TopicUnsubscribe(router, "cam/front", 1), RTI_OK);
+    EXPECT_EQ(Lookup("cam/front"), (std::vector<RTI_VlanId>{2}));
+    ASSERT_EQ(RTI_TopicSubscribe(router, "cam/#", 2), RTI_OK);
+    ASSERT_EQ(RTI_TopicUnsubscribe(router, "cam/+", 2), RTI_OK);
+    EXPECT_EQ(Lookup("cam"), (std::vector<RTI_VlanId>{2}));
+    EXPECT_EQ(Lookup("cam/rear"), (std::vector<RTI_VlanId>{2})) << "still reached through '#'";
+
+    std::string longTopic = "cam/" + std::string(RTI_TOPIC_CACHE_TOPIC_LEN, 'x');
+    EXPECT_EQ(Lookup(longTopic.c_str()), (std::vector<RTI_VlanId>{2})) << "not cached";
+}
+
+/**
+ * @brief duplicated VLANs reported once, short buffer reports needed length
+ *
+ */
+TEST_F(RouteTopicTest, BufferAndDuplicates) {
+    ASSERT_EQ(RTI_TopicSubscribe(router, "x/y", 7), RTI_OK);
+    ASSERT_EQ(RTI_TopicSubscribe(router, "x/y", 7), RTI_OK);
+    ASSERT_EQ(RTI_TopicSubscribe(router, "x/+", 7), RTI_OK);
+    ASSERT_EQ(RTI_TopicSubscribe(router, "x/#", 8), RTI_OK);
+    EXPECT_EQ(Lookup("x/y"), (std::vector<RTI_VlanId>{7, 8}));
+
+    RTI_VlanId vlans[1];
+    size_t count = 1;
+    EXPECT_EQ(RTI_TopicLookup(router, "x/y", vlans, &count), RTI_ERR_INVALID_PARAM);
+    EXPECT_EQ(count, 2u);
+    count = 1;
+    EXPECT_EQ(RTI_TopicLookup(router, "z", vlans, &count), RTI_ERR_OBJECT_EMPTY);
+    EXPECT_EQ(count, 0u);
+}
+
+/**
+ * @brief lookups before any match and count only lookups pass no buffer around
+ *
+ */
+TEST_F(RouteTopicTest, CountOnly) {
+    size_t count = 0;
+    EXPECT_EQ(RTI_TopicLookup(router, "z", nullptr, &count), RTI_ERR_OBJECT_EMPTY) << "nothing matched yet";
+    EXPECT_EQ(RTI_TopicLookup(router, "z", nullptr, &count), RTI_ERR_OBJECT_EMPTY) << "cached empty result";
+    ASSERT_EQ(RTI_TopicSubscribe(router, "z", 9), RTI_OK);
+    EXPECT_EQ(RTI_TopicLookup(router, "z", nullptr, &count), RTI_ERR_INVALID_PARAM);
+    EXPECT_EQ(count, 1u);
+    EXPECT_EQ(Lookup("z"), std::vector<RTI_VlanId>{9});
+}
+
+/**
+ * @brief malformed filters, topics and missing subscriptions should be rejected
+ *
+ */
+TEST_F(RouteTopicTest, Invalid) {
+    EXPECT_EQ(RTI_TopicSubscribe(router, "", 1), RTI_ERR_INVALID_PARAM);
+    EXPECT_EQ(RTI_TopicSubscribe(router, "a/#/b", 1), RTI_ERR_INVALID_PARAM);
+    EXPECT_EQ(RTI_TopicSubscribe(router, "a/b+", 1), RTI_ERR_INVALID_PARAM);
+    EXPECT_EQ(RTI_TopicSubscribe(router, "a#", 1), RTI_ERR_INVALID_PARAM);
+    EXPECT_EQ(RTI_TopicUnsubscribe(router, "a/b", 1), RTI_ERR_INVALID_PARAM);
+    ASSERT_EQ(RTI_TopicSubscribe(router, "a/b", 1), RTI_OK);
+    EXPECT_EQ(RTI_TopicUnsubscribe(router, "a/b", 2), RTI_ERR_INVALID_PARAM);
+    EXPECT_EQ(RTI_TopicUnsubscribe(router, "a", 1), RTI_ERR_INVALID_PARAM);
+    EXPECT_EQ(RTI_TopicUnsubscribe(router, "a/+", 1), RTI_ERR_INVALID_PARAM);
+
+    RTI_VlanId vlans[4];
+    size_t count = 4;
+    EXPECT_EQ(RTI_TopicLookup(router, "a/+", vlans, &count), RTI_ERR_INVALID_PARAM);
+    EXPECT_EQ(RTI_TopicLookup(router, nullptr, vlans, &count), RTI_ERR_INVALID_PARAM);
+}
+
+#endif
@@ -0,0 +1,190 @@
+/**
+ * @file rpc_call.cpp
+ * @author CYK-Dot
+ * @brief testcases for request/reply RPC over VLANs
+ * @version 0.1
+ * @date 2026-10-16
+ *
+ * @copyright Copyright (c) 2025 CYK-Dot, MIT License.
+ */
+
+/* Header import ------------------------------------------------------------------*/
+#include <gtest/gtest.h>
+#include <vector>
+#include "rti_queue.h"
+#include "rti_rpc.h"
+
+/* Config macros ------------------------------------------------------------------*/
+#ifdef RTI_TEST_COMMON
+
+/* Mock variables and functions  --------------------------------------------------*/
+RTI_VLAN_REGISTER_STATIC_QOS_WITH_ID(RPC_REQ_VLAN, 27, 4, RTI_RPC_MSG_SIZE(8), 1, RTI_QUEUE_SCHED_STRICT);
+RTI_VLAN_REGISTER_STATIC_QOS_WITH_ID(RPC_REPLY_VLAN, 28, 4, RTI_RPC_MSG_SIZE(8), 1, RTI_QUEUE_SCHED_STRICT);
+
+/**
+ * @brief adds two uint32_t, fails on overflow
+ *
+ */
+static RTI_ERR TestRpcAdd(const void *req, size_t size, void *reply, size_t *replySize, void *arg)
+{
+    (*(uint32_t *)arg)++;
+    if (size != 2 * sizeof(uint32_t) || *replySize < sizeof(uint32_t)) {
+        return RTI_ERR_INVALID_PARAM;
+    }
+    const uint32_t *operand = (const uint32_t *)req;
+    uint32_t sum = operand[0] + operand[1];
+    memcpy(reply, &sum, sizeof(sum));
+    *replySize = sizeof(sum);
+    return (sum < operand[0]) ? RTI_ERR_FAILED : RTI_OK;
+}
+
+/**
+ * @brief result of one call
+ *
+ */
+typedef struct {
+    uint32_t calls;
+    RTI_ERR status;
+    uint32_t value;
+} TEST_RPC_RESULT;
+
+static void TestRpcReply(RTI_ERR status, const void *reply, size_t size, void *arg)
+{
+    TEST_RPC_RESULT *result = (TEST_RPC_RESULT *)arg;
+    result->calls++;
+    result->status = status;
+    if (status != RTI_ERR_TIMEOUT) {
+        EXPECT_EQ(size, sizeof(uint32_t));
+        memcpy(&result->value, reply, sizeof(uint32_t));
+    }
+}
+
+/* Test suites --------------------------------------------------------------------*/
+
+/**
+ * @brief testcases for one client and one server on VLAN 27 and 28
+ *
+ */
+class RpcCallTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        ASSERT_EQ(RTIPriv_VlanSelect(27, &request), RTI_OK);
+        ASSERT_EQ(RTIPriv_VlanSelect(28, &reply), RTI_OK);
+        requestVlan = request.ifx->createF();
+        replyVlan = reply.ifx->createF();
+        ASSERT_NE(requestVlan, nullptr);
+        ASSERT_NE(replyVlan, nullptr);
+        RTI_RPC_CFG cfg = {27, 28, 2, 8};
+        ASSERT_EQ(RTI_RpcClientCreate(&cfg, &client), RTI_OK);
+        ASSERT_EQ(RTI_RpcServerCreate(27, 8, TestRpcAdd, &handled, &server), RTI_OK);
+    }
+    void TearDown() override {
+        RTI_RpcClientDelete(client);
+        RTI_RpcServerDelete(server);
+        request.ifx->deleteF(requestVlan);
+        reply.ifx->deleteF(replyVlan);
+    }
+    RTI_ERR Call(uint32_t a, uint32_t b, uint32_t timeout, TEST_RPC_RESULT *result) {
+        uint32_t operand[2] = {a, b};
+        return RTI_RpcCall(client, operand, sizeof(operand), timeout, TestRpcReply, result);
+    }
+    RTI_VLAN_DESC request;
+    RTI_VLAN_DESC reply;
+    void *requestVlan;
+    void *replyVlan;
+    RTI_RPC_CLIENT *client;
+    RTI_RPC_SERVER *server;
+    uint32_t handled = 0;
+};
+
+/* Test cases ---------------------------------------------------------------------*/
+
+/**
+ * @brief replies reach the call they belong to, with handler status
+ *
+ */
+TEST_F(RpcCallTest, RoundTrip) {
+    TEST_RPC_RESULT first = {}, second = {};
+    ASSERT_EQ(Call(2, 3, 0, &first), RTI_OK);
+    ASSERT_EQ(Call(0xFFFFFFFFu, 2, 0, &second), RTI_OK);
+    size_t done = 0;
+    ASSERT_EQ(RTI_RpcClientPoll(client, 0, &done), RTI_OK);
+    EXPECT_EQ(done, 0u);
+    ASSERT_EQ(RTI_RpcServerPoll(server, &done), RTI_OK);
+    EXPECT_EQ(done, 2u);
+    ASSERT_EQ(RTI_RpcClientPoll(client, 0, &done), RTI_OK);
+    EXPECT_EQ(done, 2u);
+    EXPECT_EQ(first.calls, 1u);
+    EXPECT_EQ(first.status, RTI_OK);
+    EXPECT_EQ(first.value, 5u);
+    EXPECT_EQ(second.calls, 1u);
+    EXPECT_EQ(second.status, RTI_ERR_FAILED);
+
+    for (uint32_t i = 0; i < 100; i++) {
+        TEST_RPC_RESULT result = {};
+        ASSERT_EQ(Call(i, i, 0, &result), RTI_OK);
+        ASSERT_EQ(RTI_RpcServerPoll(server, nullptr), RTI_OK);
+        ASSERT_EQ(RTI_RpcClientPoll(client, 0, nullptr), RTI_OK);
+        ASSERT_EQ(result.calls, 1u);
+        ASSERT_EQ(result.value, 2 * i);
+    }
+}
+
+/**
+ * @brief pending slab bounds calls in flight, slots are reused after reply
+ *
+ */
+TEST_F(RpcCallTest, SlabFull) {
+    TEST_RPC_RESULT result[3] = {};
+    ASSERT_EQ(Call(1, 1, 0, &result[0]), RTI_OK);
+    ASSERT_EQ(Call(1, 2, 0, &result[1]), RTI_OK);
+    EXPECT_EQ(Call(1, 3, 0, &result[2]), RTI_ERR_QUEUE_FULL);
+    ASSERT_EQ(RTI_RpcServerPoll(server, nullptr), RTI_OK);
+    ASSERT_EQ(RTI_RpcClientPoll(client, 0, nullptr), RTI_OK);
+    EXPECT_EQ(Call(1, 3, 0, &result[2]), RTI_OK);
+    EXPECT_EQ(RTI_RpcCall(client, nullptr, RTI_RPC_MSG_SIZE(8), 0, TestRpcReply, &result[2]), RTI_ERR_INVALID_PARAM);
+}
+
+/**
+ * @brief call without reply times out once, its late reply is dropped
+ *
+ */
+TEST_F(RpcCallTest, Timeout) {
+    TEST_RPC_RESULT late = {}, next = {};
+    ASSERT_EQ(RTI_RpcClientPoll(client, 100, nullptr), RTI_OK);
+    ASSERT_EQ(Call(4, 4, 5, &late), RTI_OK);
+    ASSERT_EQ(RTI_RpcClientPoll(client, 104, nullptr), RTI_OK);
+    EXPECT_EQ(late.calls, 0u);
+    size_t done = 0;
+    ASSERT_EQ(RTI_RpcClientPoll(client, 105, &done), RTI_OK);
+    EXPECT_EQ(done, 1u);
+    EXPECT_EQ(late.calls, 1u);
+    EXPECT_EQ(late.status, RTI_ERR_TIMEOUT);
+
+    ASSERT_EQ(Call(5, 5, 5, &next), RTI_OK) << "reuses the slot of the timed out call";
+    ASSERT_EQ(RTI_RpcServerPoll(server, &done), RTI_OK);
+    EXPECT_EQ(done, 2u);
+    ASSERT_EQ(RTI_RpcClientPoll(client, 106, &done), RTI_OK);
+    EXPECT_EQ(done, 1u);
+    EXPECT_EQ(late.calls, 1u);
+    EXPECT_EQ(next.calls, 1u);
+    EXPECT_EQ(next.value, 10u);
+    ASSERT_EQ(RTI_RpcClientPoll(client, 200, &done), RTI_OK);
+    EXPECT_EQ(done, 0u) << "answered call does not time out";
+}
+
+/**
+ * @brief unknown VLANs should be rejected
+ *
+ */
+TEST_F(RpcCallTest, Invalid) {
+    RTI_RPC_CLIENT *bad = nullptr;
+    RTI_RPC_CFG cfg = {27, 0x7FFF, 2, 8};
+    EXPECT_NE(RTI_RpcClientCreate(&cfg, &bad), RTI_OK);
+    cfg = {27, 28, 3, 8};
+    EXPECT_EQ(RTI_RpcClientCreate(&cfg, &bad), RTI_ERR_INVALID_PARAM);
+    RTI_RPC_SERVER *badServer = nullptr;
+    EXPECT_NE(RTI_RpcServerCreate(0x7FFF, 8, TestRpcAdd, &handled, &badServer), RTI_OK);
+}
+
+#endif
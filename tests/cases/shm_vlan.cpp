@@ -0,0 +1,285 @@
+/**
+ * @file shm_vlan.cpp
+ * @author CYK-Dot
+ * @brief testcases for shared-memory cross-process VLAN backend
+ * @version 0.1
+ * @date 2026-10-16
+ *
+ * @copyright Copyright (c) 2025 CYK-Dot, MIT License.
+ */
+
+/* Header import ------------------------------------------------------------------*/
+#include <gtest/gtest.h>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/wait.h>
+#include <unistd.h>
+#include <chrono>
+#include "rti_shm.h"
+
+/* Config macros ------------------------------------------------------------------*/
+#if defined(RTI_TEST_COMMON) && RTI_ENABLE_SHM == 1
+
+#define SHM_TEST_NAME "/rti_test_shm_vlan"
+#define SHM_TEST_STALE_NAME "/rti_test_shm_stale"
+
+/* Mock variables and functions  --------------------------------------------------*/
+RTI_SHM_IFX_DEFINE(shm_vlan_ifx, SHM_TEST_NAME, 4, sizeof(uint32_t), 1, RTI_QUEUE_SCHED_STRICT)
+RTI_SHM_IFX_DEFINE(shm_stale_ifx, SHM_TEST_STALE_NAME, 4, sizeof(uint32_t), 1, RTI_QUEUE_SCHED_STRICT)
+
+/**
+ * @brief run body in a child process, exit code 0 if body returns true
+ *
+ */
+template <typename F>
+static pid_t ForkRun(F body)
+{
+    pid_t pid = fork();
+    if (pid == 0) {
+        _exit(body() ? 0 : 1);
+    }
+    return pid;
+}
+
+static int WaitExit(pid_t pid)
+{
+    int status = 0;
+    if (waitpid(pid, &status, 0) != pid || WIFEXITED(status) == false) {
+        return -1;
+    }
+    return WEXITSTATUS(status);
+}
+
+/* Test suites --------------------------------------------------------------------*/
+
+/**
+ * @brief testcases for anonymous segment shared by fork
+ *
+ */
+class ShmVlanTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        RTI_QUEUE_CFG cfg = {4, sizeof(uint32_t), 1, RTI_QUEUE_SCHED_STRICT, {0}};
+        ASSERT_EQ(RTI_ShmCreate(nullptr, &cfg, &shm), RTI_OK);
+        ASSERT_EQ(RTI_ShmConsumerCreate(shm, &consumer), RTI_OK);
+    }
+    void TearDown() override {
+        RTI_ShmConsumerDelete(consumer);
+        RTI_ShmClose(shm);
+    }
+    RTI_ERR Recv(uint32_t *msg) {
+        size_t size = sizeof(*msg);
+        return RTI_ShmRecv(consumer, msg, &size);
+    }
+    RTI_SHM *shm;
+    void *consumer;
+};
+
+/* Test cases ---------------------------------------------------------------------*/
+
+/**
+ * @brief messages from another process arrive in order
+ *
+ */
+TEST_F(ShmVlanTest, CrossProcess) {
+    const uint32_t total = 1000;
+    int fd = RTI_ShmGetFd(shm);
+    pid_t child = ForkRun([fd, total]() {
+        RTI_SHM *peer = nullptr;
+        void *producer = nullptr;
+        if (RTI_ShmOpenFd(dup(fd), &peer) != RTI_OK || RTI_ShmProducerCreate(peer, &producer) != RTI_OK) {
+            return false;
+        }
+        for (uint32_t i = 0; i < total; i++) {
+            while (RTI_ShmSend(producer, &i, sizeof(i), 0) == RTI_ERR_QUEUE_FULL) {
+                sched_yield();
+            }
+        }
+        RTI_ShmProducerDelete(producer);
+        RTI_ShmClose(peer);
+        return true;
+    });
+    ASSERT_GT(child, 0);
+    uint32_t expect = 0;
+    while (expect < total) {
+        uint32_t msg;
+        if (Recv(&msg) == RTI_OK) {
+            ASSERT_EQ(msg, expect);
+            expect++;
+        }
+        else {
+            sched_yield();
+        }
+    }
+    EXPECT_EQ(WaitExit(child), 0);
+}
+
+/**
+ * @brief consumer parked on shared futex is woken up by another process
+ *
+ */
+TEST_F(ShmVlanTest, WaitCrossProcess) {
+    int fd = RTI_ShmGetFd(shm);
+    pid_t child = ForkRun([fd]() {
+        RTI_SHM *peer = nullptr;
+        void *producer = nullptr;
+        if (RTI_ShmOpenFd(dup(fd), &peer) != RTI_OK || RTI_ShmProducerCreate(peer, &producer) != RTI_OK) {
+            return false;
+        }
+        usleep(50 * 1000);
+        uint32_t msg = 11;
+        bool ok = (RTI_ShmSend(producer, &msg, sizeof(msg), 0) == RTI_OK);
+        RTI_ShmProducerDelete(producer);
+        RTI_ShmClose(peer);
+        return ok;
+    });
+    ASSERT_GT(child, 0);
+    uint32_t out = 0;
+    size_t size = sizeof(out);
+    EXPECT_EQ(RTI_ShmRecvWait(consumer, &out, &size, 5000), RTI_OK);
+    EXPECT_EQ(out, 11u);
+    EXPECT_EQ(WaitExit(child), 0);
+    EXPECT_EQ(RTI_ShmRecvWait(consumer, &out, &size, 10), RTI_ERR_QUEUE_EMPTY);
+}
+
+/**
+ * @brief zero-copy acquire and commit in the same process
+ *
+ */
+TEST_F(ShmVlanTest, AcquireCommit) {
+    void *producer = nullptr;
+    ASSERT_EQ(RTI_ShmProducerCreate(shm, &producer), RTI_OK);
+    RTI_QUEUE_BUF buf;
+    ASSERT_EQ(RTI_ShmSendAcquire(producer, sizeof(uint32_t), 0, &buf), RTI_OK);
+    *(uint32_t *)buf.data = 42;
+    ASSERT_EQ(RTI_ShmSendCommit(producer, &buf), RTI_OK);
+    RTI_QUEUE_BUF in;
+    ASSERT_EQ(RTI_ShmRecvAcquire(consumer, &in), RTI_OK);
+    EXPECT_EQ(in.size, sizeof(uint32_t));
+    EXPECT_EQ(*(uint32_t *)in.data, 42u);
+    EXPECT_EQ(RTI_ShmRecvRelease(consumer, &in), RTI_OK);
+    RTI_ShmProducerDelete(producer);
+}
+
+/**
+ * @brief slot claimed by a dead producer is recovered and skipped
+ *
+ */
+TEST_F(ShmVlanTest, ProducerDeath) {
+    int fd = RTI_ShmGetFd(shm);
+    pid_t child = ForkRun([fd]() {
+        RTI_SHM *peer = nullptr;
+        void *producer = nullptr;
+        RTI_QUEUE_BUF buf;
+        if (RTI_ShmOpenFd(dup(fd), &peer) != RTI_OK || RTI_ShmProducerCreate(peer, &producer) != RTI_OK) {
+            return false;
+        }
+        // die holding the slot
+        return RTI_ShmSendAcquire(producer, sizeof(uint32_t), 0, &buf) == RTI_OK;
+    });
+    ASSERT_EQ(WaitExit(child), 0);
+
+    void *producer = nullptr;
+    ASSERT_EQ(RTI_ShmProducerCreate(shm, &producer), RTI_OK);
+    uint32_t msg = 7;
+    ASSERT_EQ(RTI_ShmSend(producer, &msg, sizeof(msg), 0), RTI_OK);
+    uint32_t out = 0;
+    EXPECT_EQ(Recv(&out), RTI_OK) << "dead slot recovered on demand";
+    EXPECT_EQ(out, msg);
+    EXPECT_EQ(RTI_ShmRecover(shm), 0u) << "dead peer already cleared";
+    RTI_ShmProducerDelete(producer);
+}
+
+/**
+ * @brief slots held by a dead consumer are given back to producers
+ *
+ */
+TEST_F(ShmVlanTest, ConsumerDeath) {
+    void *producer = nullptr;
+    ASSERT_EQ(RTI_ShmProducerCreate(shm, &producer), RTI_OK);
+    for (uint32_t i = 0; i < 4; i++) {
+        ASSERT_EQ(RTI_ShmSend(producer, &i, sizeof(i), 0), RTI_OK);
+    }
+    int fd = RTI_ShmGetFd(shm);
+    pid_t child = ForkRun([fd]() {
+        RTI_SHM *peer = nullptr;
+        void *peerConsumer = nullptr;
+        RTI_QUEUE_BUF buf;
+        if (RTI_ShmOpenFd(dup(fd), &peer) != RTI_OK || RTI_ShmConsumerCreate(peer, &peerConsumer) != RTI_OK) {
+            return false;
+        }
+        // die holding the slot
+        return RTI_ShmRecvAcquire(peerConsumer, &buf) == RTI_OK;
+    });
+    ASSERT_EQ(WaitExit(child), 0);
+
+    uint32_t out = 0;
+    for (uint32_t i = 1; i < 4; i++) {
+        EXPECT_EQ(Recv(&out), RTI_OK);
+        EXPECT_EQ(out, i);
+    }
+    uint32_t msg = 4;
+    EXPECT_EQ(RTI_ShmSend(producer, &msg, sizeof(msg), 0), RTI_OK) << "full slot recovered on demand";
+    EXPECT_EQ(Recv(&out), RTI_OK);
+    EXPECT_EQ(out, msg);
+    RTI_ShmProducerDelete(producer);
+}
+
+/**
+ * @brief named VLAN works through its interface, second open shares the segment
+ *
+ */
+TEST(ShmVlanIfxTest, NamedInterface) {
+    RTI_ShmUnlink(SHM_TEST_NAME);
+    RTI_VLAN_IFX *ifx = &shm_vlan_ifx.ifx;
+    void *vlan = ifx->createF();
+    ASSERT_NE(vlan, nullptr);
+    EXPECT_EQ(ifx->flowSetF, nullptr);
+    void *vlanProducer = ifx->createProducerF();
+    ASSERT_NE(vlanProducer, nullptr);
+
+    RTI_SHM *peer = nullptr;
+    void *peerConsumer = nullptr;
+    ASSERT_EQ(RTI_ShmOpen(SHM_TEST_NAME, &peer), RTI_OK);
+    ASSERT_EQ(RTI_ShmConsumerCreate(peer, &peerConsumer), RTI_OK);
+
+    uint32_t msg = 5, out = 0;
+    size_t size = sizeof(out);
+    EXPECT_EQ(ifx->sendF(vlanProducer, &msg, sizeof(msg), 0), RTI_OK);
+    EXPECT_EQ(RTI_ShmRecv(peerConsumer, &out, &size), RTI_OK);
+    EXPECT_EQ(out, msg);
+    RTI_VLAN_FLOW flow;
+    EXPECT_EQ(ifx->flowGetF(vlanProducer, &flow), RTI_OK);
+    EXPECT_EQ(flow.credits, 4u);
+
+    RTI_ShmConsumerDelete(peerConsumer);
+    RTI_ShmClose(peer);
+    ifx->deleteProducerF(vlanProducer);
+    ifx->deleteF(vlan);
+    EXPECT_EQ(RTI_ShmUnlink(SHM_TEST_NAME), RTI_OK);
+}
+
+/**
+ * @brief segment whose creator never finished it is reported, lazy open gives up after a bounded wait
+ *
+ */
+TEST(ShmVlanIfxTest, CreatorNotReady) {
+    RTI_ShmUnlink(SHM_TEST_STALE_NAME);
+    int fd = shm_open(SHM_TEST_STALE_NAME, O_CREAT | O_EXCL | O_RDWR, 0600);
+    ASSERT_GE(fd, 0);
+    RTI_QUEUE_CFG cfg = {4, sizeof(uint32_t), 1, RTI_QUEUE_SCHED_STRICT, {0}};
+    RTI_SHM *shm = nullptr;
+    EXPECT_EQ(RTI_ShmCreate(SHM_TEST_STALE_NAME, &cfg, &shm), RTI_ERR_ALREADY_EXIST);
+    EXPECT_EQ(RTI_ShmOpen(SHM_TEST_STALE_NAME, &shm), RTI_ERR_NOT_READY) << "not sized yet";
+    ASSERT_EQ(ftruncate(fd, 4096), 0);
+    EXPECT_EQ(RTI_ShmOpen(SHM_TEST_STALE_NAME, &shm), RTI_ERR_NOT_READY) << "not marked ready";
+
+    auto start = std::chrono::steady_clock::now();
+    EXPECT_EQ(shm_stale_ifx.ifx.createF(), nullptr);
+    // deadline is counted in whole milliseconds
+    EXPECT_GE(std::chrono::steady_clock::now() - start, std::chrono::milliseconds(RTI_SHM_READY_TIMEOUT_MS - 1));
+    close(fd);
+    EXPECT_EQ(RTI_ShmUnlink(SHM_TEST_STALE_NAME), RTI_OK);
+}
+
+#endif
@@ -0,0 +1,67 @@
+/**
+ * @file rti_generated_route.h
+ * @brief generated header file for routing table
+ * ---------------------------------------------------------------------------
+ * @note this file is auto generated, do not edit manually
+ * @version 
+ */
+#ifndef __RTI_GENERATED_ROUTE_TEST_CASES_H__
+#define __RTI_GENERATED_ROUTE_TEST_CASES_H__
+#include "rti_core.h"
+#include "test_vlanid.h"
+
+static const RTI_VlanId RTI_ROUTE_TEST_CASES_VLANS[] = {
+    10,
+    20,
+    30,
+    10,
+    99,
+    RTI_VLANID_AUTO_VLAN1,
+    100,
+    0,
+};
+
+static const uint64_t RTI_ROUTE_TEST_CASES_DUPS[] = {
+    0x8ull | ((10) == (RTI_VLANID_AUTO_VLAN1) ? 0x20ull : 0),
+    0x0ull | ((20) == (RTI_VLANID_AUTO_VLAN1) ? 0x20ull : 0),
+    0x0ull | ((30) == (RTI_VLANID_AUTO_VLAN1) ? 0x20ull : 0),
+    0x0ull | ((10) == (RTI_VLANID_AUTO_VLAN1) ? 0x20ull : 0),
+    0x0ull | ((99) == (RTI_VLANID_AUTO_VLAN1) ? 0x20ull : 0),
+    0x0ull | ((RTI_VLANID_AUTO_VLAN1) == (100) ? 0x40ull : 0),
+    0x0ull,
+    0,
+};
+
+/**
+ * @brief Decide destination VLANs of a message by the generated routing table.
+ *
+ * @param attr The message attributes.
+ * @param vlanOut Buffer to store VLAN IDs, in rule order and without duplicates.
+ * @param count [in] buffer length, [out] VLAN count.
+ * @return RTI_ERR see RTI_RouteLookup().
+ */
+static inline RTI_ERR RTI_RouteStaticLookup_TEST_CASES(const RTI_ROUTE_ATTR *attr, RTI_VlanId *vlanOut, size_t *count)
+{
+    uint64_t match = 0;
+    switch (attr->type) {
+    case 7u:
+        match = 0x12ull;
+        match |= (attr->source == 1u) ? 0x1ull : 0;
+        match |= (attr->source == 1u && attr->key == 42u) ? 0x4ull : 0;
+        match |= (attr->source == 2u && attr->key == 5u) ? 0x8ull : 0;
+        break;
+    case 256u:
+        match = 0x70ull;
+        match |= (attr->source == 1u) ? 0x1ull : 0;
+        match |= (attr->source == 2u && attr->key == 5u) ? 0x8ull : 0;
+        break;
+    default:
+        match = 0x10ull;
+        match |= (attr->source == 1u) ? 0x1ull : 0;
+        match |= (attr->source == 2u && attr->key == 5u) ? 0x8ull : 0;
+        break;
+    }
+    return RTIPriv_RouteEmit(RTI_ROUTE_TEST_CASES_VLANS, RTI_ROUTE_TEST_CASES_DUPS, match, vlanOut, count);
+}
+
+#endif
\ No newline at end of file
@@ -0,0 +1,28 @@
+/**
+ * @file rti_generated_static.h
+ * @brief generated header file for static VLAN storage
+ * ---------------------------------------------------------------------------
+ * @note this file is auto generated, do not edit manually
+ *       it defines and registers VLANs, include it in exactly one source file
+ * @version 
+ */
+#ifndef __RTI_GENERATED_STATIC_TEST_CASES_H__
+#define __RTI_GENERATED_STATIC_TEST_CASES_H__
+#include "rti_queue.h"
+#include "test_vlanid.h"
+
+static uint8_t RTI_VLANMEM_STATIC_VLAN[RTI_QUEUE_MEM_SIZE(8, 8, 2)] RTI_TYPE_ALIGNED(RTI_CACHELINE_SIZE);
+static uint8_t RTI_VLANPOOL_STATIC_VLAN[RTI_QUEUE_POOL_SIZE(3)] RTI_TYPE_ALIGNED(RTI_CACHELINE_SIZE);
+static const RTI_QUEUE_STORAGE RTI_VLANSTORAGE_STATIC_VLAN = {
+    RTI_VLANMEM_STATIC_VLAN, sizeof(RTI_VLANMEM_STATIC_VLAN),
+    RTI_VLANPOOL_STATIC_VLAN, sizeof(RTI_VLANPOOL_STATIC_VLAN),
+};
+RTI_VLAN_REGISTER_STATIC_QOS_OPTS_WITH_ID(STATIC_VLAN, 34, 8, 8, 2, RTI_QUEUE_SCHED_WRR,
+                                          .rate = NULL, .storage = &RTI_VLANSTORAGE_STATIC_VLAN);
+
+#if RTI_ENABLE_DYNAMIC_VLAN == 1
+/* pass to RTI_VlanDynamicSetup() instead of a heap table */
+static RTI_VLAN_RECORD RTI_VLANTABLE_TEST_CASES[32];
+#endif
+
+#endif
\ No newline at end of file
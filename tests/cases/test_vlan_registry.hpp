@@ -0,0 +1,49 @@
+/**
+ * @file test_vlan_registry.hpp
+ * @brief generated constexpr registry of VLANs in submodule test_cases
+ * ---------------------------------------------------------------------------
+ * @note this file is auto generated, do not edit manually
+ *       include it before registering these VLANs in C++ files
+ */
+#pragma once
+
+#include "rti_registry.hpp"
+
+extern "C" {
+extern const RTI_VLAN_DESC RTI_VLAN_AUTO_VLAN1;
+extern const RTI_VLAN_DESC RTI_VLAN_AUTO_VLAN2;
+}
+
+namespace rti {
+
+template <>
+struct Vlan<100> {
+    static constexpr RTI_VlanId id = 100;
+    static constexpr const char *name = "AUTO_VLAN1";
+    static constexpr const RTI_VLAN_DESC &Desc() noexcept { return RTI_VLAN_AUTO_VLAN1; }
+};
+
+template <>
+struct Vlan<101> {
+    static constexpr RTI_VlanId id = 101;
+    static constexpr const char *name = "AUTO_VLAN2";
+    static constexpr const RTI_VLAN_DESC &Desc() noexcept { return RTI_VLAN_AUTO_VLAN2; }
+};
+
+namespace registry {
+namespace test_cases {
+
+inline constexpr RegistryEntry entries[] = {
+    {100, "AUTO_VLAN1"},
+    {101, "AUTO_VLAN2"},
+};
+static_assert(RegistryIsUnique(entries), "duplicate VLAN in submodule test_cases");
+
+constexpr RTI_VlanId IdOf(const char *name) noexcept
+{
+    return RegistryFind(entries, name);
+}
+
+} // namespace test_cases
+} // namespace registry
+} // namespace rti
\ No newline at end of file
@@ -10,4 +10,7 @@
 #define RTI_VLANID_AUTO_VLAN1 100
 #define RTI_VLANID_AUTO_VLAN2 101
 
+#include "rti_vlan.h"
+static const RTI_VLAN_RATE_CFG RTI_VLANRATE_RATE_VLAN = {1, 4, RTI_VLAN_RATE_DIVERT, 31};
+
 #endif
\ No newline at end of file
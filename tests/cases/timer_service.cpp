@@ -0,0 +1,142 @@
+/**
+ * @file timer_service.cpp
+ * @author CYK-Dot
+ * @brief testcases for timer service posting delayed and periodic messages
+ * @version 0.1
+ * @date 2026-10-16
+ *
+ * @copyright Copyright (c) 2025 CYK-Dot, MIT License.
+ */
+
+/* Header import ------------------------------------------------------------------*/
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <chrono>
+#include <vector>
+#include "rti_queue.h"
+#include "rti_timer.h"
+
+/* Config macros ------------------------------------------------------------------*/
+#ifdef RTI_TEST_COMMON
+
+/* Mock variables and functions  --------------------------------------------------*/
+RTI_VLAN_REGISTER_STATIC_QOS_WITH_ID(TIMER_VLAN, 29, 16, sizeof(uint32_t), 1, RTI_QUEUE_SCHED_STRICT);
+
+/* Test suites --------------------------------------------------------------------*/
+
+/**
+ * @brief testcases for a service posting to VLAN 29
+ *
+ */
+class TimerServiceTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        ASSERT_EQ(RTIPriv_VlanSelect(29, &desc), RTI_OK);
+        vlan = desc.ifx->createF();
+        ASSERT_NE(vlan, nullptr);
+        consumer = desc.ifx->createConsumerF();
+        ASSERT_NE(consumer, nullptr);
+        RTI_TIMER_SERVICE_CFG cfg = {4, sizeof(uint32_t), 1};
+        ASSERT_EQ(RTI_TimerServiceCreate(&cfg, &service), RTI_OK);
+    }
+    void TearDown() override {
+        RTI_TimerServiceDelete(service);
+        desc.ifx->deleteConsumerF(consumer);
+        desc.ifx->deleteF(vlan);
+    }
+    RTI_ERR Post(uint32_t msg, uint32_t delay, uint32_t period, uint32_t *postId) {
+        RTI_TIMER_POST_CFG cfg = {29, 0, delay, period};
+        return RTI_TimerServicePost(service, &cfg, &msg, sizeof(msg), postId);
+    }
+    std::vector<uint32_t> Drain() {
+        std::vector<uint32_t> msgs;
+        uint32_t msg = 0;
+        size_t size = sizeof(msg);
+        while (desc.ifx->recvF(consumer, &msg, &size) == RTI_OK) {
+            msgs.push_back(msg);
+            size = sizeof(msg);
+        }
+        // posts due on the same tick have no order
+        std::sort(msgs.begin(), msgs.end());
+        return msgs;
+    }
+    RTI_VLAN_DESC desc;
+    void *vlan;
+    void *consumer;
+    RTI_TIMER_SERVICE *service;
+};
+
+/* Test cases ---------------------------------------------------------------------*/
+
+/**
+ * @brief delayed and periodic posts driven by event loop ticks
+ *
+ */
+TEST_F(TimerServiceTest, TickDriven) {
+    uint32_t periodic = 0;
+    ASSERT_EQ(Post(1, 5, 0, nullptr), RTI_OK);
+    ASSERT_EQ(Post(2, 2, 3, &periodic), RTI_OK);
+    std::vector<std::vector<uint32_t>> expect = {{}, {2}, {}, {}, {1, 2}, {}, {}, {2}, {}, {}, {2}};
+    for (uint64_t now = 1; now <= expect.size(); now++) {
+        ASSERT_EQ(RTI_TimerServiceTick(service, now, nullptr), RTI_OK);
+        EXPECT_EQ(Drain(), expect[now - 1]) << "tick " << now;
+    }
+    ASSERT_EQ(RTI_TimerServiceCancel(service, periodic), RTI_OK);
+    EXPECT_EQ(RTI_TimerServiceCancel(service, periodic), RTI_ERR_INVALID_PARAM);
+    ASSERT_EQ(RTI_TimerServiceTick(service, 100, nullptr), RTI_OK);
+    EXPECT_EQ(Drain(), std::vector<uint32_t>{});
+}
+
+/**
+ * @brief post pool bounds pending posts, finished one-shot posts free their slot
+ *
+ */
+TEST_F(TimerServiceTest, PoolFull) {
+    for (uint32_t i = 0; i < 4; i++) {
+        ASSERT_EQ(Post(i, 1, 0, nullptr), RTI_OK);
+    }
+    EXPECT_EQ(Post(9, 1, 0, nullptr), RTI_ERR_QUEUE_FULL);
+    size_t posted = 0;
+    ASSERT_EQ(RTI_TimerServiceTick(service, 1, &posted), RTI_OK);
+    EXPECT_EQ(posted, 4u);
+    EXPECT_EQ(Drain().size(), 4u);
+    EXPECT_EQ(Post(9, 1, 0, nullptr), RTI_OK);
+
+    RTI_TIMER_POST_CFG cfg = {0x7FFF, 0, 1, 0};
+    uint32_t msg = 0;
+    EXPECT_NE(RTI_TimerServicePost(service, &cfg, &msg, sizeof(msg), nullptr), RTI_OK);
+    cfg.vlanId = 29;
+    uint64_t tooLong = 0;
+    EXPECT_EQ(RTI_TimerServicePost(service, &cfg, &tooLong, sizeof(tooLong), nullptr), RTI_ERR_INVALID_PARAM);
+}
+
+#if RTI_ENABLE_OS_WAIT == 1
+/**
+ * @brief dedicated thread posts on wall clock and sleeps while idle
+ *
+ */
+TEST_F(TimerServiceTest, ThreadDriven) {
+    ASSERT_EQ(RTI_TimerServiceStart(service), RTI_OK);
+    EXPECT_EQ(RTI_TimerServiceTick(service, 1, nullptr), RTI_ERR_NOT_SUPPORTED);
+    auto start = std::chrono::steady_clock::now();
+    ASSERT_EQ(Post(7, 20, 0, nullptr), RTI_OK);
+    uint32_t msg = 0;
+    size_t size = sizeof(msg);
+    ASSERT_EQ(desc.ifx->recvWaitF(consumer, &msg, &size, 2000), RTI_OK);
+    EXPECT_EQ(msg, 7u);
+    EXPECT_GE(std::chrono::steady_clock::now() - start, std::chrono::milliseconds(19));
+
+    uint32_t periodic = 0;
+    ASSERT_EQ(Post(8, 1, 5, &periodic), RTI_OK);
+    for (int i = 0; i < 3; i++) {
+        size = sizeof(msg);
+        ASSERT_EQ(desc.ifx->recvWaitF(consumer, &msg, &size, 2000), RTI_OK);
+        EXPECT_EQ(msg, 8u);
+    }
+    ASSERT_EQ(RTI_TimerServiceCancel(service, periodic), RTI_OK);
+    ASSERT_EQ(RTI_TimerServiceStop(service), RTI_OK);
+    EXPECT_EQ(RTI_TimerServiceStop(service), RTI_ERR_INVALID_PARAM);
+}
+#endif
+
+#endif
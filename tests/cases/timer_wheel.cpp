@@ -0,0 +1,153 @@
+/**
+ * @file timer_wheel.cpp
+ * @author CYK-Dot
+ * @brief testcases for hierarchical timer wheel
+ * @version 0.1
+ * @date 2026-10-16
+ *
+ * @copyright Copyright (c) 2025 CYK-Dot, MIT License.
+ */
+
+/* Header import ------------------------------------------------------------------*/
+#include <gtest/gtest.h>
+#include <random>
+#include <vector>
+#include "rti_timer.h"
+
+/* Config macros ------------------------------------------------------------------*/
+#ifdef RTI_TEST_COMMON
+
+/* Mock variables and functions  --------------------------------------------------*/
+
+/**
+ * @brief timer recording the wheel time it expired at
+ *
+ */
+typedef struct {
+    RTI_TIMER timer;
+    RTI_TIMER_WHEEL *wheel;
+    uint64_t firedAt;
+    uint32_t fired;
+    uint64_t period;
+} TEST_TIMER;
+
+static void TestTimerExpire(RTI_TIMER *timer, void *arg)
+{
+    TEST_TIMER *test = (TEST_TIMER *)arg;
+    test->firedAt = RTI_TimerWheelNow(test->wheel);
+    test->fired++;
+    if (test->period > 0) {
+        RTI_TimerStart(test->wheel, timer, timer->expire + test->period);
+    }
+}
+
+/* Test suites --------------------------------------------------------------------*/
+
+/* Test cases ---------------------------------------------------------------------*/
+
+/**
+ * @brief timers across all levels fire on the first advance reaching their tick
+ *
+ */
+TEST(TimerWheelTest, ExpireOnTime) {
+    RTI_TIMER_WHEEL wheel;
+    ASSERT_EQ(RTI_TimerWheelInit(&wheel, 1000), RTI_OK);
+    std::mt19937_64 rng(11);
+    const uint64_t span = (uint64_t)1 << (RTI_TIMER_WHEEL_BITS * RTI_TIMER_WHEEL_LEVELS);
+    std::vector<TEST_TIMER> timers(400);
+    std::vector<uint64_t> expire(timers.size());
+    for (size_t i = 0; i < timers.size(); i++) {
+        timers[i] = TEST_TIMER{};
+        timers[i].wheel = &wheel;
+        RTI_TimerInit(&timers[i].timer, TestTimerExpire, &timers[i]);
+        uint64_t limit = (i % 4 == 0) ? 64 : ((i % 4 == 1) ? 5000 : ((i % 4 == 2) ? 300000 : span * 2));
+        expire[i] = 1000 + rng() % limit;
+        ASSERT_EQ(RTI_TimerStart(&wheel, &timers[i].timer, expire[i]), RTI_OK);
+    }
+    for (size_t i = 0; i < timers.size(); i += 7) {
+        RTI_TimerCancel(&wheel, &timers[i].timer);
+        EXPECT_FALSE(RTI_TimerIsPending(&timers[i].timer));
+    }
+    uint64_t now = 1000;
+    while (now < 1000 + span * 2) {
+        now += (now < 400000) ? 1 + rng() % 300 : 1 + rng() % (span / 8);
+        size_t expired = 0;
+        ASSERT_EQ(RTI_TimerWheelAdvance(&wheel, now, &expired), RTI_OK);
+        for (size_t i = 0; i < timers.size(); i++) {
+            if (i % 7 == 0) {
+                ASSERT_EQ(timers[i].fired, 0u);
+                continue;
+            }
+            if (expire[i] <= now) {
+                ASSERT_EQ(timers[i].fired, 1u) << "timer " << i << " expire " << expire[i] << " now " << now;
+                ASSERT_EQ(timers[i].firedAt, expire[i] > 1000 ? expire[i] : 1001);
+            }
+            else {
+                ASSERT_EQ(timers[i].fired, 0u) << "timer " << i << " fired early";
+            }
+        }
+    }
+}
+
+/**
+ * @brief timers restarted from their callback and passed deadlines
+ *
+ */
+TEST(TimerWheelTest, PeriodicAndPassed) {
+    RTI_TIMER_WHEEL wheel;
+    ASSERT_EQ(RTI_TimerWheelInit(&wheel, 0), RTI_OK);
+    TEST_TIMER periodic = {};
+    periodic.wheel = &wheel;
+    periodic.period = 10;
+    RTI_TimerInit(&periodic.timer, TestTimerExpire, &periodic);
+    ASSERT_EQ(RTI_TimerStart(&wheel, &periodic.timer, 10), RTI_OK);
+    for (uint64_t now = 1; now <= 1000; now++) {
+        ASSERT_EQ(RTI_TimerWheelAdvance(&wheel, now, nullptr), RTI_OK);
+    }
+    EXPECT_EQ(periodic.fired, 100u);
+    EXPECT_EQ(periodic.firedAt, 1000u);
+    RTI_TimerCancel(&wheel, &periodic.timer);
+    EXPECT_EQ(wheel.pending, 0u);
+
+    TEST_TIMER passed = {};
+    passed.wheel = &wheel;
+    RTI_TimerInit(&passed.timer, TestTimerExpire, &passed);
+    ASSERT_EQ(RTI_TimerStart(&wheel, &passed.timer, 5), RTI_OK);
+    ASSERT_EQ(RTI_TimerWheelAdvance(&wheel, 1000, nullptr), RTI_OK);
+    EXPECT_EQ(passed.fired, 0u) << "same tick is not advanced again";
+    ASSERT_EQ(RTI_TimerWheelAdvance(&wheel, 1001, nullptr), RTI_OK);
+    EXPECT_EQ(passed.fired, 1u);
+    EXPECT_EQ(passed.firedAt, 1001u);
+}
+
+/**
+ * @brief advancing only to the reported ticks still fires timers of all levels on time
+ *
+ */
+TEST(TimerWheelTest, NextExpiry) {
+    RTI_TIMER_WHEEL wheel;
+    ASSERT_EQ(RTI_TimerWheelInit(&wheel, 1000), RTI_OK);
+    EXPECT_EQ(RTI_TimerWheelNext(&wheel), UINT64_MAX) << "nothing pending";
+    TEST_TIMER near = {}, far = {};
+    near.wheel = &wheel;
+    far.wheel = &wheel;
+    RTI_TimerInit(&near.timer, TestTimerExpire, &near);
+    RTI_TimerInit(&far.timer, TestTimerExpire, &far);
+    ASSERT_EQ(RTI_TimerStart(&wheel, &near.timer, 1005), RTI_OK);
+    ASSERT_EQ(RTI_TimerStart(&wheel, &far.timer, 300000), RTI_OK);
+    EXPECT_EQ(RTI_TimerWheelNext(&wheel), 1005u);
+
+    uint32_t wakes = 0;
+    while (far.fired == 0) {
+        uint64_t next = RTI_TimerWheelNext(&wheel);
+        ASSERT_LE(next, 300000u);
+        ASSERT_EQ(RTI_TimerWheelAdvance(&wheel, next, nullptr), RTI_OK);
+        wakes++;
+    }
+    EXPECT_EQ(near.firedAt, 1005u);
+    EXPECT_EQ(far.firedAt, 300000u);
+    EXPECT_LT(wakes, 300000u / RTI_TIMER_WHEEL_SLOTS + 2) << "no wake per tick";
+    EXPECT_EQ(RTI_TimerWheelNext(&wheel), UINT64_MAX);
+}
+
+#endif
@@ -24,12 +24,12 @@ static void mock1_delete_producer(void*) {}
 static void* mock1_create_consumer(void) { return nullptr; }
 static void mock1_delete_consumer(void*) {}
 static RTI_VLAN_IFX mock1_vlan_ifx = {
-    mock1_create,
-    mock1_delete, 
-    mock1_create_producer,
-    mock1_delete_producer,
-    mock1_create_consumer,
-    mock1_delete_consumer
+    .createF = mock1_create,
+    .deleteF = mock1_delete,
+    .createProducerF = mock1_create_producer,
+    .deleteProducerF = mock1_delete_producer,
+    .createConsumerF = mock1_create_consumer,
+    .deleteConsumerF = mock1_delete_consumer,
 };
 RTI_VLAN_REGISTER_STATIC(&mock1_vlan_ifx, AUTO_VLAN1);
 
@@ -40,12 +40,12 @@ static void mock2_delete_producer(void*) {}
 static void* mock2_create_consumer(void) { return nullptr; }
 static void mock2_delete_consumer(void*) {}
 static RTI_VLAN_IFX mock2_vlan_ifx = {
-    mock2_create,
-    mock2_delete, 
-    mock2_create_producer,
-    mock2_delete_producer,
-    mock2_create_consumer,
-    mock2_delete_consumer
+    .createF = mock2_create,
+    .deleteF = mock2_delete,
+    .createProducerF = mock2_create_producer,
+    .deleteProducerF = mock2_delete_producer,
+    .createConsumerF = mock2_create_consumer,
+    .deleteConsumerF = mock2_delete_consumer,
 };
 RTI_VLAN_REGISTER_STATIC(&mock2_vlan_ifx, AUTO_VLAN2);
 
@@ -0,0 +1,201 @@
+/**
+ * @file vlan_bridge.cpp
+ * @author CYK-Dot
+ * @brief testcases for VLAN to VLAN bridge
+ * @version 0.1
+ * @date 2026-10-16
+ *
+ * @copyright Copyright (c) 2025 CYK-Dot, MIT License.
+ */
+
+/* Header import ------------------------------------------------------------------*/
+#include <gtest/gtest.h>
+#include <vector>
+#include "rti_bridge.h"
+#include "rti_queue.h"
+
+/* Config macros ------------------------------------------------------------------*/
+#ifdef RTI_TEST_COMMON
+
+/* Mock variables and functions  --------------------------------------------------*/
+RTI_VLAN_REGISTER_STATIC_QOS_WITH_ID(BRIDGE_SRC_VLAN, 32, 8, sizeof(uint32_t), 2, RTI_QUEUE_SCHED_STRICT);
+RTI_VLAN_REGISTER_STATIC_QOS_WITH_ID(BRIDGE_DST_VLAN, 33, 4, sizeof(uint32_t), 1, RTI_QUEUE_SCHED_STRICT);
+
+/**
+ * @brief forwards even messages only
+ *
+ */
+static bool TestBridgeEven(const void *msg, size_t size, uint8_t *lane, void *arg)
+{
+    (void)lane;
+    (*(uint32_t *)arg)++;
+    return size == sizeof(uint32_t) && (*(const uint32_t *)msg % 2) == 0;
+}
+
+/* Test suites --------------------------------------------------------------------*/
+
+/**
+ * @brief testcases for a bridge from VLAN 32 to VLAN 33
+ *
+ */
+class VlanBridgeTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        ASSERT_EQ(RTIPriv_VlanSelect(32, &src), RTI_OK);
+        ASSERT_EQ(RTIPriv_VlanSelect(33, &dst), RTI_OK);
+        srcVlan = src.ifx->createF();
+        dstVlan = dst.ifx->createF();
+        ASSERT_NE(srcVlan, nullptr);
+        ASSERT_NE(dstVlan, nullptr);
+        producer = src.ifx->createProducerF();
+        consumer = dst.ifx->createConsumerF();
+        ASSERT_NE(producer, nullptr);
+        ASSERT_NE(consumer, nullptr);
+    }
+    void TearDown() override {
+        RTI_BridgeDelete(bridge);
+        src.ifx->deleteProducerF(producer);
+        dst.ifx->deleteConsumerF(consumer);
+        src.ifx->deleteF(srcVlan);
+        dst.ifx->deleteF(dstVlan);
+    }
+    std::vector<uint32_t> Drain() {
+        std::vector<uint32_t> msgs;
+        uint32_t msg = 0;
+        size_t size = sizeof(msg);
+        while (dst.ifx->recvF(consumer, &msg, &size) == RTI_OK) {
+            msgs.push_back(msg);
+            size = sizeof(msg);
+        }
+        return msgs;
+    }
+    RTI_VLAN_DESC src;
+    RTI_VLAN_DESC dst;
+    void *srcVlan;
+    void *dstVlan;
+    void *producer;
+    void *consumer;
+    RTI_BRIDGE *bridge = nullptr;
+};
+
+/* Test cases ---------------------------------------------------------------------*/
+
+/**
+ * @brief full destination keeps the message pending, lanes beyond destination fold to its last lane
+ *
+ */
+TEST_F(VlanBridgeTest, PollBatch) {
+    RTI_BRIDGE_CFG cfg = {32, 33, 8, 0, false, nullptr, nullptr};
+    ASSERT_EQ(RTI_BridgeCreate(&cfg, &bridge), RTI_OK);
+    EXPECT_FALSE(RTI_BridgeIsInline(bridge));
+    for (uint32_t i = 0; i < 6; i++) {
+        ASSERT_EQ(src.ifx->sendF(producer, &i, sizeof(i), (uint8_t)(i % 2)), RTI_OK);
+    }
+    size_t moved = 0;
+    ASSERT_EQ(RTI_BridgePoll(bridge, &moved), RTI_OK);
+    EXPECT_EQ(moved, 4u);
+    EXPECT_EQ(Drain(), (std::vector<uint32_t>{0, 2, 4, 1}));
+    ASSERT_EQ(RTI_BridgePoll(bridge, &moved), RTI_OK);
+    EXPECT_EQ(moved, 2u);
+    EXPECT_EQ(Drain(), (std::vector<uint32_t>{3, 5}));
+    ASSERT_EQ(RTI_BridgePoll(bridge, &moved), RTI_OK);
+    EXPECT_EQ(moved, 0u);
+}
+
+/**
+ * @brief routing function drops messages, dropped ones are not counted as moved
+ *
+ */
+TEST_F(VlanBridgeTest, Route) {
+    uint32_t routed = 0;
+    RTI_BRIDGE_CFG cfg = {32, 33, 2, 0, false, TestBridgeEven, &routed};
+    ASSERT_EQ(RTI_BridgeCreate(&cfg, &bridge), RTI_OK);
+    for (uint32_t i = 0; i < 4; i++) {
+        ASSERT_EQ(src.ifx->sendF(producer, &i, sizeof(i), 0), RTI_OK);
+    }
+    size_t moved = 0;
+    ASSERT_EQ(RTI_BridgePoll(bridge, &moved), RTI_OK);
+    EXPECT_EQ(moved, 1u) << "batch of 2 holds one dropped message";
+    ASSERT_EQ(RTI_BridgePoll(bridge, &moved), RTI_OK);
+    EXPECT_EQ(moved, 1u);
+    EXPECT_EQ(routed, 4u);
+    EXPECT_EQ(Drain(), (std::vector<uint32_t>{0, 2}));
+}
+
+/**
+ * @brief inline bridge forwards sends in producer context, acquired slots still need polling
+ *
+ */
+TEST_F(VlanBridgeTest, Inline) {
+    uint32_t routed = 0;
+    RTI_BRIDGE_CFG cfg = {32, 33, 8, 0, true, TestBridgeEven, &routed};
+    ASSERT_EQ(RTI_BridgeCreate(&cfg, &bridge), RTI_OK);
+    ASSERT_TRUE(RTI_BridgeIsInline(bridge));
+    for (uint32_t i = 0; i < 4; i++) {
+        ASSERT_EQ(src.ifx->sendF(producer, &i, sizeof(i), 1), RTI_OK);
+    }
+    EXPECT_EQ(Drain(), (std::vector<uint32_t>{0, 2}));
+
+    RTI_QUEUE_BUF buf;
+    ASSERT_EQ(RTI_QueueSendAcquire(producer, sizeof(uint32_t), 0, &buf), RTI_OK);
+    *(uint32_t *)buf.data = 8;
+    ASSERT_EQ(RTI_QueueSendCommit(producer, &buf), RTI_OK);
+    EXPECT_EQ(Drain(), std::vector<uint32_t>{});
+    ASSERT_EQ(RTI_BridgePoll(bridge, nullptr), RTI_OK);
+    EXPECT_EQ(Drain(), std::vector<uint32_t>{8});
+
+    RTI_BridgeDelete(bridge);
+    bridge = nullptr;
+    uint32_t msg = 10;
+    ASSERT_EQ(src.ifx->sendF(producer, &msg, sizeof(msg), 0), RTI_OK);
+    EXPECT_EQ(Drain(), std::vector<uint32_t>{}) << "deleted bridge stops forwarding";
+}
+
+/**
+ * @brief flow control or rate limit on either VLAN keeps the bridge polling
+ *
+ */
+TEST_F(VlanBridgeTest, InlineRefused) {
+    RTI_BRIDGE_CFG cfg = {32, 33, 8, 0, true, nullptr, nullptr};
+    RTI_VLAN_FLOW_CFG flow = {8, 4, RTI_VLAN_FLOW_MODE_NONBLOCK, nullptr, nullptr};
+    ASSERT_EQ(RTI_QueueFlowSet(producer, &flow), RTI_OK);
+    ASSERT_EQ(RTI_BridgeCreate(&cfg, &bridge), RTI_OK);
+    EXPECT_FALSE(RTI_BridgeIsInline(bridge)) << "source flow control would be skipped";
+    uint32_t msg = 2;
+    ASSERT_EQ(src.ifx->sendF(producer, &msg, sizeof(msg), 1), RTI_OK);
+    ASSERT_EQ(RTI_BridgePoll(bridge, nullptr), RTI_OK);
+    EXPECT_EQ(Drain(), std::vector<uint32_t>{2});
+    RTI_BridgeDelete(bridge);
+    bridge = nullptr;
+    ASSERT_EQ(RTI_QueueFlowSet(producer, nullptr), RTI_OK);
+
+    ASSERT_EQ(RTI_BridgeCreate(&cfg, &bridge), RTI_OK);
+    ASSERT_TRUE(RTI_BridgeIsInline(bridge));
+    EXPECT_EQ(RTI_QueueFlowSet(producer, &flow), RTI_ERR_NOT_SUPPORTED) << "forwarded sends never enqueue";
+    RTI_BridgeDelete(bridge);
+    bridge = nullptr;
+
+#if RTI_ENABLE_RATE_LIMIT == 1
+    RTI_QUEUE *dstQueue = RTIPriv_QueueGet(consumer, false);
+    RTI_VLAN_RATE_CFG rate = {1000, 1, RTI_VLAN_RATE_DIVERT, 31};
+    ASSERT_EQ(RTI_QueueRateSet(dstQueue, &rate), RTI_OK);
+    ASSERT_EQ(RTI_BridgeCreate(&cfg, &bridge), RTI_OK);
+    EXPECT_FALSE(RTI_BridgeIsInline(bridge)) << "sources would share the divert producer";
+    ASSERT_EQ(RTI_QueueRateSet(dstQueue, nullptr), RTI_OK);
+#endif
+}
+
+/**
+ * @brief unknown and identical VLANs should be rejected
+ *
+ */
+TEST_F(VlanBridgeTest, Invalid) {
+    RTI_BRIDGE *bad = nullptr;
+    RTI_BRIDGE_CFG cfg = {32, 32, 1, 0, false, nullptr, nullptr};
+    EXPECT_EQ(RTI_BridgeCreate(&cfg, &bad), RTI_ERR_INVALID_PARAM);
+    cfg.dstVlan = 0x7FFF;
+    EXPECT_NE(RTI_BridgeCreate(&cfg, &bad), RTI_OK);
+    EXPECT_EQ(RTI_BridgePoll(nullptr, nullptr), RTI_ERR_INVALID_PARAM);
+}
+
+#endif
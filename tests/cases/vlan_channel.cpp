@@ -0,0 +1,95 @@
+/**
+ * @file vlan_channel.cpp
+ * @author CYK-Dot
+ * @brief testcases for typed C++ channels of VLANs
+ * @version 0.1
+ * @date 2026-10-16
+ *
+ * @copyright Copyright (c) 2025 CYK-Dot, MIT License.
+ */
+
+/* Header import ------------------------------------------------------------------*/
+#include <gtest/gtest.h>
+#include "rti_channel.hpp"
+
+/* Config macros ------------------------------------------------------------------*/
+#ifdef RTI_TEST_COMMON
+
+/* Mock variables and functions  --------------------------------------------------*/
+
+/**
+ * @brief message of the channel tests
+ *
+ */
+typedef struct {
+    uint32_t seq;
+    uint16_t tag;
+} TEST_CHANNEL_MSG;
+
+/**
+ * @brief message larger than slots of VLAN 40
+ *
+ */
+typedef struct {
+    uint8_t data[64];
+} TEST_CHANNEL_BIG_MSG;
+
+RTI_VLAN_REGISTER_STATIC_QOS_WITH_ID(CHANNEL_VLAN, 40, 8, sizeof(TEST_CHANNEL_MSG), 2, RTI_QUEUE_SCHED_STRICT);
+
+using TestQueueChannel = rti::Channel<TEST_CHANNEL_MSG, 40, rti::QueueBackend>;
+using TestDynamicChannel = rti::Channel<TEST_CHANNEL_MSG, 40>;
+using TestUnknownChannel = rti::Channel<TEST_CHANNEL_MSG, 0x7FFF>;
+using TestBigChannel = rti::Channel<TEST_CHANNEL_BIG_MSG, 40, rti::QueueBackend>;
+
+/* Test suites --------------------------------------------------------------------*/
+
+/* Test cases ---------------------------------------------------------------------*/
+
+/**
+ * @brief direct queue calls and interface calls carry the same typed messages
+ *
+ */
+TEST(VlanChannelTest, SendRecv) {
+    TestQueueChannel::Producer producer;
+    TestDynamicChannel::Consumer consumer;
+    ASSERT_EQ(TestQueueChannel::CreateProducer(&producer), RTI_OK);
+    ASSERT_EQ(TestDynamicChannel::CreateConsumer(&consumer), RTI_OK);
+    const RTI_VLAN_DESC *desc = nullptr;
+    ASSERT_EQ(TestQueueChannel::Resolve(&desc), RTI_OK);
+    EXPECT_EQ(desc->id, 40);
+    EXPECT_EQ(desc->ifx->sendF, &RTI_QueueSend);
+
+    ASSERT_EQ(producer.Send({1, 0xA5}, 1), RTI_OK);
+    ASSERT_EQ(producer.Send({2, 0x5A}, 0), RTI_OK);
+    TEST_CHANNEL_MSG msg = {};
+    ASSERT_EQ(consumer.Recv(msg), RTI_OK);
+    EXPECT_EQ(msg.seq, 2u) << "lane 0 first";
+    EXPECT_EQ(msg.tag, 0x5A);
+    ASSERT_EQ(consumer.Recv(msg), RTI_OK);
+    EXPECT_EQ(msg.seq, 1u);
+    EXPECT_EQ(consumer.Recv(msg), RTI_ERR_QUEUE_EMPTY);
+
+    TestQueueChannel::DeleteProducer(&producer);
+    TestDynamicChannel::DeleteConsumer(&consumer);
+    EXPECT_EQ(producer.handle(), nullptr);
+}
+
+/**
+ * @brief unknown VLANs and messages not fitting the backend are rejected once resolved
+ *
+ */
+TEST(VlanChannelTest, Resolve) {
+    TestUnknownChannel::Producer unknown;
+    EXPECT_NE(TestUnknownChannel::CreateProducer(&unknown), RTI_OK);
+    EXPECT_EQ(unknown.handle(), nullptr);
+
+    TestBigChannel::Consumer big;
+    EXPECT_EQ(TestBigChannel::CreateConsumer(&big), RTI_ERR_NOT_SUPPORTED);
+    const RTI_VLAN_DESC *first = nullptr;
+    const RTI_VLAN_DESC *second = nullptr;
+    TestDynamicChannel::Resolve(&first);
+    TestDynamicChannel::Resolve(&second);
+    EXPECT_EQ(first, second) << "descriptor is resolved once";
+}
+
+#endif
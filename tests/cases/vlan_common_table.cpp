@@ -23,12 +23,12 @@ static void mock1_delete_producer(void*) {}
 static void* mock1_create_consumer(void) { return nullptr; }
 static void mock1_delete_consumer(void*) {}
 static RTI_VLAN_IFX mock1_vlan_ifx = {
-    mock1_create,
-    mock1_delete, 
-    mock1_create_producer,
-    mock1_delete_producer,
-    mock1_create_consumer,
-    mock1_delete_consumer
+    .createF = mock1_create,
+    .deleteF = mock1_delete,
+    .createProducerF = mock1_create_producer,
+    .deleteProducerF = mock1_delete_producer,
+    .createConsumerF = mock1_create_consumer,
+    .deleteConsumerF = mock1_delete_consumer,
 };
 RTI_VLAN_REGISTER_STATIC_WITH_ID(&mock1_vlan_ifx, VLAN1, 1);
 
@@ -39,12 +39,12 @@ static void mock2_delete_producer(void*) {}
 static void* mock2_create_consumer(void) { return nullptr; }
 static void mock2_delete_consumer(void*) {}
 static RTI_VLAN_IFX mock2_vlan_ifx = {
-    mock2_create,
-    mock2_delete, 
-    mock2_create_producer,
-    mock2_delete_producer,
-    mock2_create_consumer,
-    mock2_delete_consumer
+    .createF = mock2_create,
+    .deleteF = mock2_delete,
+    .createProducerF = mock2_create_producer,
+    .deleteProducerF = mock2_delete_producer,
+    .createConsumerF = mock2_create_consumer,
+    .deleteConsumerF = mock2_delete_consumer,
 };
 RTI_VLAN_REGISTER_STATIC_WITH_ID(&mock2_vlan_ifx, VLAN2, 2);
 
@@ -55,23 +55,23 @@ static void mock3_delete_producer(void*) {}
 static void* mock3_create_consumer(void) { return nullptr; }
 static void mock3_delete_consumer(void*) {}
 static RTI_VLAN_IFX mock3_vlan_ifx = {
-    mock3_create,
-    mock3_delete, 
-    mock3_create_producer,
-    mock3_delete_producer,
-    mock3_create_consumer,
-    mock3_delete_consumer
+    .createF = mock3_create,
+    .deleteF = mock3_delete,
+    .createProducerF = mock3_create_producer,
+    .deleteProducerF = mock3_delete_producer,
+    .createConsumerF = mock3_create_consumer,
+    .deleteConsumerF = mock3_delete_consumer,
 };
-static RTI_VLAN_DESC mock3_vlan_desc = {&mock3_vlan_ifx, (char *)"VLAN3", 3};
+static RTI_VLAN_DESC mock3_vlan_desc = {.ifx = &mock3_vlan_ifx, .name = (char *)"VLAN3", .id = 3};
 static RTI_VLAN_IFX mock4_vlan_ifx = {
-    mock3_create,
-    mock3_delete, 
-    mock3_create_producer,
-    mock3_delete_producer,
-    mock3_create_consumer,
-    mock3_delete_consumer
+    .createF = mock3_create,
+    .deleteF = mock3_delete,
+    .createProducerF = mock3_create_producer,
+    .deleteProducerF = mock3_delete_producer,
+    .createConsumerF = mock3_create_consumer,
+    .deleteConsumerF = mock3_delete_consumer,
 };
-static RTI_VLAN_DESC mock4_vlan_desc = {&mock4_vlan_ifx, (char *)"VLAN4", 4};
+static RTI_VLAN_DESC mock4_vlan_desc = {.ifx = &mock4_vlan_ifx, .name = (char *)"VLAN4", .id = 4};
 
 /* Test suites --------------------------------------------------------------------*/
 
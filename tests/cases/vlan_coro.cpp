@@ -0,0 +1,220 @@
+/**
+ * @file vlan_coro.cpp
+ * @author CYK-Dot
+ * @brief testcases for coroutine awaitables of VLAN handles
+ * @version 0.1
+ * @date 2026-10-16
+ *
+ * @copyright Copyright (c) 2025 CYK-Dot, MIT License.
+ */
+
+/* Header import ------------------------------------------------------------------*/
+#include <gtest/gtest.h>
+#include <thread>
+#include "rti_queue.h"
+#if __cplusplus >= 202002L
+#include "rti_coro.hpp"
+#endif
+
+/* Config macros ------------------------------------------------------------------*/
+#if defined(RTI_TEST_COMMON) && __cplusplus >= 202002L
+
+/* Mock variables and functions  --------------------------------------------------*/
+RTI_VLAN_REGISTER_STATIC_QOS_WITH_ID(CORO_VLAN, 39, 4, sizeof(uint32_t), 1, RTI_QUEUE_SCHED_STRICT);
+RTI_VLAN_REGISTER_STATIC_QOS_WITH_ID(CORO_LANES_VLAN, 42, 4, sizeof(uint32_t), 2, RTI_QUEUE_SCHED_STRICT);
+
+/**
+ * @brief eagerly started coroutine, its frame is freed when it returns
+ *
+ */
+struct TestCoroTask {
+    struct promise_type {
+        TestCoroTask get_return_object() { return {}; }
+        std::suspend_never initial_suspend() noexcept { return {}; }
+        std::suspend_never final_suspend() noexcept { return {}; }
+        void return_void() {}
+        void unhandled_exception() { std::terminate(); }
+    };
+};
+
+/**
+ * @brief what a coroutine saw, and on which thread it was resumed
+ *
+ */
+typedef struct {
+    uint32_t count;
+    uint64_t sum;
+    RTI_ERR err;
+    std::thread::id thread;
+    bool done;
+} TEST_CORO_STATE;
+
+static TestCoroTask TestCoroReceiver(rti::CoConsumer consumer, uint32_t count, TEST_CORO_STATE *state)
+{
+    for (uint32_t i = 0; i < count; i++) {
+        uint32_t msg = 0;
+        rti::RecvResult result = co_await consumer.recv(msg);
+        state->thread = std::this_thread::get_id();
+        if (result.err != RTI_OK || result.size != sizeof(msg)) {
+            state->err = result.err;
+            break;
+        }
+        state->sum += msg;
+        state->count++;
+    }
+    state->done = true;
+}
+
+static TestCoroTask TestCoroSender(rti::CoProducer producer, uint32_t count, TEST_CORO_STATE *state)
+{
+    for (uint32_t i = 0; i < count; i++) {
+        RTI_ERR err = co_await producer.send(i);
+        state->thread = std::this_thread::get_id();
+        if (err != RTI_OK) {
+            state->err = err;
+            break;
+        }
+        state->count++;
+    }
+    state->done = true;
+}
+
+/* Test suites --------------------------------------------------------------------*/
+
+/**
+ * @brief testcases for VLAN 39, 4 slots
+ *
+ */
+class VlanCoroTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        ASSERT_EQ(RTIPriv_VlanSelect(39, &desc), RTI_OK);
+        producer = desc.ifx->createProducerF();
+        consumer = desc.ifx->createConsumerF();
+        ASSERT_NE(producer, nullptr);
+        ASSERT_NE(consumer, nullptr);
+    }
+    void TearDown() override {
+        desc.ifx->deleteProducerF(producer);
+        desc.ifx->deleteConsumerF(consumer);
+    }
+    RTI_VLAN_DESC desc;
+    void *producer;
+    void *consumer;
+};
+
+/* Test cases ---------------------------------------------------------------------*/
+
+/**
+ * @brief a receiver suspends on the empty VLAN and each send resumes it inline
+ *
+ */
+TEST_F(VlanCoroTest, RecvResumedBySender) {
+    TEST_CORO_STATE state = {};
+    uint32_t msg = 5;
+    ASSERT_EQ(desc.ifx->sendF(producer, &msg, sizeof(msg), 0), RTI_OK);
+    TestCoroReceiver(rti::CoConsumer(desc, consumer), 3, &state);
+    EXPECT_EQ(state.count, 1u) << "a queued message does not suspend";
+    EXPECT_FALSE(state.done);
+
+    std::thread sender([&]() {
+        for (uint32_t i = 6; i < 8; i++) {
+            ASSERT_EQ(desc.ifx->sendF(producer, &i, sizeof(i), 0), RTI_OK);
+            EXPECT_EQ(state.count, i - 4) << "resumed before send returns";
+            EXPECT_EQ(state.thread, std::this_thread::get_id()) << "resumed on the sender thread";
+        }
+    });
+    sender.join();
+    EXPECT_TRUE(state.done);
+    EXPECT_EQ(state.err, RTI_OK);
+    EXPECT_EQ(state.sum, 18u);
+    EXPECT_EQ(desc.ifx->recvArmF(consumer, nullptr, nullptr), RTI_ERR_INVALID_PARAM);
+}
+
+/**
+ * @brief a throttled sender suspends and is resumed by the draining receiver
+ *
+ */
+TEST_F(VlanCoroTest, SendResumedByReceiver) {
+    RTI_VLAN_FLOW_CFG flow = {4, 1, RTI_VLAN_FLOW_MODE_NONBLOCK, nullptr, nullptr};
+    ASSERT_EQ(desc.ifx->flowSetF(producer, &flow), RTI_OK);
+    TEST_CORO_STATE state = {};
+    TestCoroSender(rti::CoProducer(desc, producer), 6, &state);
+    EXPECT_EQ(state.count, 4u);
+    EXPECT_FALSE(state.done);
+
+    uint32_t msg = 0;
+    size_t size = sizeof(msg);
+    ASSERT_EQ(desc.ifx->recvF(consumer, &msg, &size), RTI_OK);
+    ASSERT_EQ(desc.ifx->recvF(consumer, &msg, &size), RTI_OK);
+    EXPECT_EQ(state.count, 4u) << "above low watermark";
+    ASSERT_EQ(desc.ifx->recvF(consumer, &msg, &size), RTI_OK);
+    EXPECT_TRUE(state.done) << "resumed on release of the message";
+    EXPECT_EQ(state.err, RTI_OK);
+    EXPECT_EQ(state.thread, std::this_thread::get_id());
+
+    uint64_t sum = 0;
+    for (uint32_t i = 0; i < 3; i++) {
+        size = sizeof(msg);
+        ASSERT_EQ(desc.ifx->recvF(consumer, &msg, &size), RTI_OK);
+        sum += msg;
+    }
+    EXPECT_EQ(sum, 3u + 4u + 5u);
+}
+
+/**
+ * @brief a sender suspends on a full lane below its watermarks and is resumed by a receive
+ *
+ */
+TEST(VlanCoroLaneTest, SendResumedOnFullLane) {
+    RTI_VLAN_DESC desc;
+    ASSERT_EQ(RTIPriv_VlanSelect(42, &desc), RTI_OK);
+    void *producer = desc.ifx->createProducerF();
+    void *consumer = desc.ifx->createConsumerF();
+    ASSERT_NE(producer, nullptr);
+    ASSERT_NE(consumer, nullptr);
+    RTI_VLAN_FLOW_CFG flow = {8, 4, RTI_VLAN_FLOW_MODE_NONBLOCK, nullptr, nullptr};
+    ASSERT_EQ(desc.ifx->flowSetF(producer, &flow), RTI_OK);
+
+    TEST_CORO_STATE state = {};
+    TestCoroSender(rti::CoProducer(desc, producer), 6, &state);
+    EXPECT_EQ(state.count, 4u) << "lane 0 holds 4";
+    EXPECT_FALSE(state.done);
+
+    uint32_t msg = 0;
+    size_t size = sizeof(msg);
+    ASSERT_EQ(desc.ifx->recvF(consumer, &msg, &size), RTI_OK);
+    EXPECT_EQ(state.count, 5u) << "resumed on release of the slot";
+    EXPECT_FALSE(state.done);
+    ASSERT_EQ(desc.ifx->recvF(consumer, &msg, &size), RTI_OK);
+    EXPECT_TRUE(state.done);
+    EXPECT_EQ(state.err, RTI_OK);
+    EXPECT_EQ(state.thread, std::this_thread::get_id());
+
+    for (uint32_t expect = 2; expect < 6; expect++) {
+        size = sizeof(msg);
+        ASSERT_EQ(desc.ifx->recvF(consumer, &msg, &size), RTI_OK);
+        EXPECT_EQ(msg, expect);
+    }
+    desc.ifx->deleteProducerF(producer);
+    desc.ifx->deleteConsumerF(consumer);
+}
+
+/**
+ * @brief a sender without flow control does not wait for space
+ *
+ */
+TEST_F(VlanCoroTest, SendWithoutFlow) {
+    TEST_CORO_STATE state = {};
+    TestCoroSender(rti::CoProducer(desc, producer), 5, &state);
+    EXPECT_TRUE(state.done);
+    EXPECT_EQ(state.count, 4u);
+    EXPECT_EQ(state.err, RTI_ERR_QUEUE_FULL);
+    uint32_t msg = 0;
+    size_t size = sizeof(msg);
+    for (uint32_t i = 0; i < 4; i++) {
+        ASSERT_EQ(desc.ifx->recvF(consumer, &msg, &size), RTI_OK);
+    }
+}
+
+#endif
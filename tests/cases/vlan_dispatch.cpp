@@ -0,0 +1,269 @@
+/**
+ * @file vlan_dispatch.cpp
+ * @author CYK-Dot
+ * @brief testcases for dispatcher groups consuming VLANs
+ * @version 0.1
+ * @date 2026-10-16
+ *
+ * @copyright Copyright (c) 2025 CYK-Dot, MIT License.
+ */
+
+/* Header import ------------------------------------------------------------------*/
+#include <gtest/gtest.h>
+#include <sched.h>
+#include <sys/resource.h>
+#include <atomic>
+#include <chrono>
+#include <thread>
+#include "rti_dispatch.h"
+#include "rti_queue.h"
+
+/* Config macros ------------------------------------------------------------------*/
+#if defined(RTI_TEST_COMMON) && RTI_ENABLE_OS_WAIT == 1
+
+/* Mock variables and functions  --------------------------------------------------*/
+RTI_VLAN_REGISTER_STATIC_QOS_WITH_ID(DISPATCH_FAST_VLAN, 37, 64, sizeof(uint32_t), 1, RTI_QUEUE_SCHED_STRICT);
+RTI_VLAN_REGISTER_STATIC_QOS_WITH_ID(DISPATCH_BULK_VLAN, 38, 64, sizeof(uint32_t), 2, RTI_QUEUE_SCHED_STRICT);
+
+/**
+ * @brief messages seen by callbacks, and CPUs they ran on
+ *
+ */
+typedef struct {
+    std::atomic<uint32_t> count;
+    std::atomic<uint64_t> sum;
+    std::atomic<uint32_t> wrongCpu;
+    std::atomic<uint32_t> wrongVlan;
+    std::atomic<uint32_t> wrongOrder;
+    std::atomic<bool> inFlight;
+    uint32_t last;
+    RTI_VlanId vlanId;
+} TEST_DISPATCH_SINK;
+
+static void TestDispatchHandler(RTI_VlanId vlanId, const void *msg, size_t size, void *arg)
+{
+    TEST_DISPATCH_SINK *sink = (TEST_DISPATCH_SINK *)arg;
+    if (vlanId != sink->vlanId || size != sizeof(uint32_t)) {
+        sink->wrongVlan++;
+    }
+    if (sched_getcpu() != 0) {
+        sink->wrongCpu++;
+    }
+    sink->sum += *(const uint32_t *)msg;
+    sink->count++;
+}
+
+/**
+ * @brief callbacks of a VLAN run one at a time and see its messages in sending order
+ *
+ */
+static void TestDispatchOrderHandler(RTI_VlanId vlanId, const void *msg, size_t size, void *arg)
+{
+    TEST_DISPATCH_SINK *sink = (TEST_DISPATCH_SINK *)arg;
+    if (sink->inFlight.exchange(true) == true) {
+        sink->wrongOrder++;
+    }
+    uint32_t value = *(const uint32_t *)msg;
+    if (sink->count.load() != 0 && value != sink->last + 1) {
+        sink->wrongOrder++;
+    }
+    sink->last = value;
+    if (vlanId != sink->vlanId || size != sizeof(uint32_t)) {
+        sink->wrongVlan++;
+    }
+    sink->sum += value;
+    sink->count++;
+    sink->inFlight.store(false);
+}
+
+static bool TestDispatchWait(TEST_DISPATCH_SINK *sink, uint32_t count)
+{
+    auto end = std::chrono::steady_clock::now() + std::chrono::seconds(5);
+    while (sink->count.load() < count && std::chrono::steady_clock::now() < end) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+    return sink->count.load() == count;
+}
+
+/* Test suites --------------------------------------------------------------------*/
+
+/**
+ * @brief testcases for VLAN 37 and 38, created by the test
+ *
+ */
+class VlanDispatchTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        ASSERT_EQ(RTIPriv_VlanSelect(37, &fast), RTI_OK);
+        ASSERT_EQ(RTIPriv_VlanSelect(38, &bulk), RTI_OK);
+        fastProducer = fast.ifx->createProducerF();
+        bulkProducer = bulk.ifx->createProducerF();
+        ASSERT_NE(fastProducer, nullptr);
+        ASSERT_NE(bulkProducer, nullptr);
+        fastSink.vlanId = 37;
+        bulkSink.vlanId = 38;
+    }
+    void TearDown() override {
+        RTI_DispatchGroupDelete(group);
+        fast.ifx->deleteProducerF(fastProducer);
+        bulk.ifx->deleteProducerF(bulkProducer);
+    }
+    RTI_VLAN_DESC fast;
+    RTI_VLAN_DESC bulk;
+    void *fastProducer;
+    void *bulkProducer;
+    TEST_DISPATCH_SINK fastSink = {};
+    TEST_DISPATCH_SINK bulkSink = {};
+    RTI_DISPATCH_GROUP *group = nullptr;
+};
+
+/* Test cases ---------------------------------------------------------------------*/
+
+/**
+ * @brief pinned threads dispatch every message of both VLANs exactly once
+ *
+ */
+TEST_F(VlanDispatchTest, Threads) {
+    RTI_DISPATCH_GROUP_CFG cfg = {};
+    RTI_DISPATCH_CPU_SET(cfg, 0);
+    cfg.threads = 2;
+    cfg.batch = 4;
+    cfg.pinEach = true;
+    ASSERT_EQ(RTI_DispatchGroupCreate(&cfg, &group), RTI_OK);
+    ASSERT_EQ(RTI_DispatchGroupAdd(group, 37, TestDispatchHandler, &fastSink), RTI_OK);
+    ASSERT_EQ(RTI_DispatchGroupAdd(group, 38, TestDispatchHandler, &bulkSink), RTI_OK);
+    ASSERT_EQ(RTI_DispatchGroupStart(group), RTI_OK);
+    EXPECT_EQ(RTI_DispatchGroupAdd(group, 1, TestDispatchHandler, &fastSink), RTI_ERR_NOT_SUPPORTED);
+    EXPECT_EQ(RTI_DispatchGroupPoll(group, nullptr), RTI_ERR_NOT_SUPPORTED);
+
+    uint64_t sum = 0;
+    for (uint32_t i = 0; i < 1000; i++) {
+        while (fast.ifx->sendF(fastProducer, &i, sizeof(i), 0) != RTI_OK) {
+            std::this_thread::yield();
+        }
+        while (bulk.ifx->sendF(bulkProducer, &i, sizeof(i), (uint8_t)(i % 2)) != RTI_OK) {
+            std::this_thread::yield();
+        }
+        sum += i;
+    }
+    ASSERT_TRUE(TestDispatchWait(&fastSink, 1000));
+    ASSERT_TRUE(TestDispatchWait(&bulkSink, 1000));
+    EXPECT_EQ(fastSink.sum.load(), sum);
+    EXPECT_EQ(bulkSink.sum.load(), sum);
+    EXPECT_EQ(fastSink.wrongCpu.load() + bulkSink.wrongCpu.load(), 0u);
+    EXPECT_EQ(fastSink.wrongVlan.load() + bulkSink.wrongVlan.load(), 0u);
+
+    ASSERT_EQ(RTI_DispatchGroupStop(group), RTI_OK);
+    EXPECT_EQ(RTI_DispatchGroupStop(group), RTI_ERR_INVALID_PARAM);
+    uint32_t msg = 7;
+    ASSERT_EQ(fast.ifx->sendF(fastProducer, &msg, sizeof(msg), 0), RTI_OK);
+    ASSERT_EQ(RTI_DispatchGroupStart(group), RTI_OK) << "a stopped group starts again";
+    ASSERT_TRUE(TestDispatchWait(&fastSink, 1001));
+}
+
+/**
+ * @brief group without threads is driven by polls, each VLAN gets one batch per round
+ *
+ */
+TEST_F(VlanDispatchTest, Poll) {
+    RTI_DISPATCH_GROUP_CFG cfg = {};
+    cfg.batch = 2;
+    ASSERT_EQ(RTI_DispatchGroupCreate(&cfg, &group), RTI_OK);
+    ASSERT_EQ(RTI_DispatchGroupAdd(group, 37, TestDispatchHandler, &fastSink), RTI_OK);
+    ASSERT_EQ(RTI_DispatchGroupAdd(group, 38, TestDispatchHandler, &bulkSink), RTI_OK);
+    EXPECT_EQ(RTI_DispatchGroupStart(group), RTI_ERR_INVALID_PARAM);
+    size_t dispatched = 0;
+    ASSERT_EQ(RTI_DispatchGroupPoll(group, &dispatched), RTI_OK);
+    EXPECT_EQ(dispatched, 0u);
+
+    for (uint32_t i = 0; i < 3; i++) {
+        ASSERT_EQ(fast.ifx->sendF(fastProducer, &i, sizeof(i), 0), RTI_OK);
+        ASSERT_EQ(bulk.ifx->sendF(bulkProducer, &i, sizeof(i), 1), RTI_OK);
+    }
+    ASSERT_EQ(RTI_DispatchGroupPoll(group, &dispatched), RTI_OK);
+    EXPECT_EQ(dispatched, 4u);
+    ASSERT_EQ(RTI_DispatchGroupPoll(group, &dispatched), RTI_OK);
+    EXPECT_EQ(dispatched, 2u);
+    EXPECT_EQ(fastSink.count.load(), 3u);
+    EXPECT_EQ(bulkSink.count.load(), 3u);
+}
+
+/**
+ * @brief threads steal batches of a busy VLAN without breaking its order
+ *
+ */
+TEST_F(VlanDispatchTest, Steal) {
+    RTI_DISPATCH_GROUP_CFG cfg = {};
+    cfg.threads = 3;
+    cfg.batch = 8;
+    cfg.steal = true;
+    ASSERT_EQ(RTI_DispatchGroupCreate(&cfg, &group), RTI_OK);
+    ASSERT_EQ(RTI_DispatchGroupAdd(group, 37, TestDispatchOrderHandler, &fastSink), RTI_OK);
+    ASSERT_EQ(RTI_DispatchGroupAdd(group, 38, TestDispatchOrderHandler, &bulkSink), RTI_OK);
+    ASSERT_EQ(RTI_DispatchGroupStart(group), RTI_OK);
+
+    uint64_t fastSum = 0;
+    uint64_t bulkSum = 0;
+    for (uint32_t i = 0; i < 20000; i++) {
+        while (fast.ifx->sendF(fastProducer, &i, sizeof(i), 0) != RTI_OK) {
+            std::this_thread::yield();
+        }
+        fastSum += i;
+        if (i % 100 == 0) {
+            uint32_t value = i / 100;
+            while (bulk.ifx->sendF(bulkProducer, &value, sizeof(value), 1) != RTI_OK) {
+                std::this_thread::yield();
+            }
+            bulkSum += value;
+        }
+    }
+    ASSERT_TRUE(TestDispatchWait(&fastSink, 20000));
+    ASSERT_TRUE(TestDispatchWait(&bulkSink, 200));
+    EXPECT_EQ(fastSink.sum.load(), fastSum);
+    EXPECT_EQ(bulkSink.sum.load(), bulkSum);
+    EXPECT_EQ(fastSink.wrongOrder.load() + bulkSink.wrongOrder.load(), 0u);
+    EXPECT_EQ(fastSink.wrongVlan.load() + bulkSink.wrongVlan.load(), 0u);
+
+    ASSERT_EQ(RTI_DispatchGroupStop(group), RTI_OK);
+    uint32_t msg = 20000;
+    ASSERT_EQ(fast.ifx->sendF(fastProducer, &msg, sizeof(msg), 0), RTI_OK);
+    ASSERT_EQ(RTI_DispatchGroupStart(group), RTI_OK) << "shared consumers are created again";
+    ASSERT_TRUE(TestDispatchWait(&fastSink, 20001));
+    EXPECT_EQ(fastSink.wrongOrder.load(), 0u);
+}
+
+/**
+ * @brief unknown, duplicated VLANs and missing callbacks should be rejected
+ *
+ */
+TEST_F(VlanDispatchTest, Invalid) {
+    RTI_DISPATCH_GROUP_CFG cfg = {};
+    cfg.threads = 1;
+    EXPECT_EQ(RTI_DispatchGroupCreate(nullptr, &group), RTI_ERR_INVALID_PARAM);
+    ASSERT_EQ(RTI_DispatchGroupCreate(&cfg, &group), RTI_OK);
+    EXPECT_EQ(RTI_DispatchGroupStart(group), RTI_ERR_INVALID_PARAM) << "group without VLANs";
+    EXPECT_NE(RTI_DispatchGroupAdd(group, 0x7FFF, TestDispatchHandler, &fastSink), RTI_OK);
+    EXPECT_EQ(RTI_DispatchGroupAdd(group, 37, nullptr, nullptr), RTI_ERR_INVALID_PARAM);
+    ASSERT_EQ(RTI_DispatchGroupAdd(group, 37, TestDispatchHandler, &fastSink), RTI_OK);
+    EXPECT_EQ(RTI_DispatchGroupAdd(group, 37, TestDispatchHandler, &fastSink), RTI_ERR_INVALID_PARAM);
+    EXPECT_EQ(RTI_DispatchGroupStop(group), RTI_ERR_INVALID_PARAM);
+}
+
+/**
+ * @brief group without a stop event for its threads is not created
+ *
+ */
+TEST_F(VlanDispatchTest, NoStopEvent) {
+    RTI_DISPATCH_GROUP_CFG cfg = {};
+    cfg.threads = 1;
+    struct rlimit limit;
+    ASSERT_EQ(getrlimit(RLIMIT_NOFILE, &limit), 0);
+    struct rlimit noFiles = {0, limit.rlim_max};
+    ASSERT_EQ(setrlimit(RLIMIT_NOFILE, &noFiles), 0);
+    RTI_ERR err = RTI_DispatchGroupCreate(&cfg, &group);
+    ASSERT_EQ(setrlimit(RLIMIT_NOFILE, &limit), 0);
+    EXPECT_EQ(err, RTI_ERR_FAILED);
+    EXPECT_EQ(group, nullptr);
+}
+
+#endif
@@ -23,14 +23,14 @@ static void mock_delete_producer(void*) {}
 static void* mock_create_consumer(void) { return nullptr; }
 static void mock_delete_consumer(void*) {}
 static RTI_VLAN_IFX mock_vlan_ifx = {
-    mock_create,
-    mock_delete, 
-    mock_create_producer,
-    mock_delete_producer,
-    mock_create_consumer,
-    mock_delete_consumer
+    .createF = mock_create,
+    .deleteF = mock_delete,
+    .createProducerF = mock_create_producer,
+    .deleteProducerF = mock_delete_producer,
+    .createConsumerF = mock_create_consumer,
+    .deleteConsumerF = mock_delete_consumer,
 };
-static RTI_VLAN_DESC mock_vlan_desc = {&mock_vlan_ifx, (char *)"VLAN1", 1};
+static RTI_VLAN_DESC mock_vlan_desc = {.ifx = &mock_vlan_ifx, .name = (char *)"VLAN1", .id = 1};
 
 static void* mock2_create(void) { return nullptr; }
 static void mock2_delete(void*) {}
@@ -39,15 +39,15 @@ static void mock2_delete_producer(void*) {}
 static void* mock2_create_consumer(void) { return nullptr; }
 static void mock2_delete_consumer(void*) {}
 static RTI_VLAN_IFX mock2_vlan_ifx = {
-    mock2_create,
-    mock2_delete, 
-    mock2_create_producer,
-    mock2_delete_producer,
-    mock2_create_consumer,
-    mock2_delete_consumer
+    .createF = mock2_create,
+    .deleteF = mock2_delete,
+    .createProducerF = mock2_create_producer,
+    .deleteProducerF = mock2_delete_producer,
+    .createConsumerF = mock2_create_consumer,
+    .deleteConsumerF = mock2_delete_consumer,
 };
-static RTI_VLAN_DESC mock2_vlan_desc = {&mock2_vlan_ifx, (char *)"VLAN2", 2};
-static RTI_VLAN_DESC mock3_vlan_desc = {&mock2_vlan_ifx, (char *)"VLAN3", 3};
+static RTI_VLAN_DESC mock2_vlan_desc = {.ifx = &mock2_vlan_ifx, .name = (char *)"VLAN2", .id = 2};
+static RTI_VLAN_DESC mock3_vlan_desc = {.ifx = &mock2_vlan_ifx, .name = (char *)"VLAN3", .id = 3};
 
 /* Test suites --------------------------------------------------------------------*/
 
@@ -161,7 +161,7 @@ TEST_F(VlanDynamicEmptyTest, SelectFromEmptyDynamicTable) {
  */
 TEST_F(VlanEmptyTest, DynamicFunctionsWhenNotSetup) {
     size_t count;
-    RTI_VLAN_DESC desc = {&mock_vlan_ifx, (char *)"test", 1};
+    RTI_VLAN_DESC desc = {.ifx = &mock_vlan_ifx, .name = (char *)"test", .id = 1};
 
     EXPECT_NE(RTI_VlanDynamicRegister(&desc), RTI_OK);
     EXPECT_NE(RTI_VlanDynamicIsRegister(&desc), RTI_OK);
@@ -170,7 +170,7 @@ TEST_F(VlanEmptyTest, DynamicFunctionsWhenNotSetup) {
 }
 TEST_F(VlanDynamicEmptyTest, DynamicFunctionsWhenSetupEmptyTable) {
     size_t count;
-    RTI_VLAN_DESC desc = {&mock_vlan_ifx, (char *)"test", 1};
+    RTI_VLAN_DESC desc = {.ifx = &mock_vlan_ifx, .name = (char *)"test", .id = 1};
 
     EXPECT_NE(RTI_VlanDynamicRegister(&desc), RTI_OK);
     EXPECT_NE(RTI_VlanDynamicIsRegister(&desc), RTI_OK);
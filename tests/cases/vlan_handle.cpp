@@ -0,0 +1,148 @@
+/**
+ * @file vlan_handle.cpp
+ * @author CYK-Dot
+ * @brief testcases for RAII owners of VLAN handles and their std::pmr allocation
+ * @version 0.1
+ * @date 2026-10-16
+ *
+ * @copyright Copyright (c) 2025 CYK-Dot, MIT License.
+ */
+
+/* Header import ------------------------------------------------------------------*/
+#include <gtest/gtest.h>
+#include <cstring>
+#include <stdexcept>
+#include "rti_queue.h"
+#include "rti_handle.hpp"
+
+/* Config macros ------------------------------------------------------------------*/
+#ifdef RTI_TEST_COMMON
+
+/* Mock variables and functions  --------------------------------------------------*/
+RTI_VLAN_REGISTER_STATIC_QOS_WITH_ID(HANDLE_VLAN, 41, 4, sizeof(uint64_t), 1, RTI_QUEUE_SCHED_STRICT);
+
+/**
+ * @brief memory resource counting what passes through it
+ *
+ */
+class TestCountingResource : public std::pmr::memory_resource {
+public:
+    size_t allocations = 0;
+    size_t bytes = 0;
+
+private:
+    void *do_allocate(size_t size, size_t align) override
+    {
+        allocations++;
+        bytes += size;
+        return std::pmr::new_delete_resource()->allocate(size, align);
+    }
+    void do_deallocate(void *ptr, size_t size, size_t align) override
+    {
+        allocations--;
+        bytes -= size;
+        std::pmr::new_delete_resource()->deallocate(ptr, size, align);
+    }
+    bool do_is_equal(const std::pmr::memory_resource &other) const noexcept override { return this == &other; }
+};
+
+/* Test suites --------------------------------------------------------------------*/
+
+/**
+ * @brief testcases for VLAN 41, 4 slots of 8 bytes
+ *
+ */
+class VlanHandleTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        ASSERT_EQ(RTIPriv_VlanSelect(41, &desc), RTI_OK);
+        ASSERT_EQ(desc.ifx->lazy.attachCnt, 0u);
+    }
+    void TearDown() override {
+        EXPECT_EQ(desc.ifx->lazy.attachCnt, 0u) << "every handle deleted";
+    }
+    RTI_VLAN_DESC desc;
+};
+
+/* Test cases ---------------------------------------------------------------------*/
+
+/**
+ * @brief handles are deleted by their owners, moves transfer them
+ *
+ */
+TEST_F(VlanHandleTest, OwnAndMove) {
+    rti::Producer producer;
+    ASSERT_EQ(producer.Create(desc), RTI_OK);
+    {
+        rti::Consumer consumer;
+        ASSERT_EQ(consumer.Create(desc), RTI_OK);
+        EXPECT_EQ(desc.ifx->lazy.attachCnt, 2u);
+
+        ASSERT_EQ(producer.Send(uint64_t(7)), RTI_OK);
+        rti::Consumer moved(std::move(consumer));
+        EXPECT_FALSE(consumer);
+        uint64_t msg = 0;
+        ASSERT_EQ(moved.Recv(msg), RTI_OK);
+        EXPECT_EQ(msg, 7u);
+        EXPECT_EQ(consumer.Recv(msg), RTI_ERR_NOT_SUPPORTED);
+    }
+    EXPECT_EQ(desc.ifx->lazy.attachCnt, 1u) << "consumer deleted at scope exit";
+
+    rti::Producer other;
+    ASSERT_EQ(other.Create(desc), RTI_OK);
+    other = std::move(producer);
+    EXPECT_EQ(desc.ifx->lazy.attachCnt, 1u) << "replaced producer deleted";
+    EXPECT_TRUE(other);
+
+    void *raw = other.release();
+    ASSERT_NE(raw, nullptr);
+    EXPECT_EQ(desc.ifx->lazy.attachCnt, 1u) << "released handle kept";
+    desc.ifx->deleteProducerF(raw);
+}
+
+/**
+ * @brief wrappers and receive buffers come from the caller resource, and are freed on exceptions
+ *
+ */
+TEST_F(VlanHandleTest, PmrOnException) {
+    TestCountingResource resource;
+    try {
+        rti::PmrPtr<rti::Producer> producer = rti::PmrNew<rti::Producer>(&resource);
+        rti::PmrPtr<rti::Consumer> consumer = rti::PmrNew<rti::Consumer>(&resource);
+        EXPECT_EQ(consumer->get_allocator().resource(), &resource) << "resource passed on";
+        ASSERT_EQ(producer->Create(desc), RTI_OK);
+        ASSERT_EQ(consumer->Create(desc, 16), RTI_OK);
+        EXPECT_EQ(resource.allocations, 3u);
+        EXPECT_EQ(resource.bytes, sizeof(rti::Producer) + sizeof(rti::Consumer) + 16);
+
+        ASSERT_EQ(producer->Send(uint64_t(42)), RTI_OK);
+        ASSERT_EQ(consumer->Recv(), RTI_OK);
+        EXPECT_EQ(consumer->size(), sizeof(uint64_t));
+        uint64_t msg = 0;
+        memcpy(&msg, consumer->data(), sizeof(msg));
+        EXPECT_EQ(msg, 42u);
+        throw std::runtime_error("request aborted");
+    } catch (const std::runtime_error &) {
+    }
+    EXPECT_EQ(resource.allocations, 0u);
+    EXPECT_EQ(resource.bytes, 0u);
+}
+
+/**
+ * @brief a monotonic arena owns the wrappers, handles are still deleted
+ *
+ */
+TEST_F(VlanHandleTest, PmrArena) {
+    alignas(std::max_align_t) std::byte storage[512];
+    std::pmr::monotonic_buffer_resource arena(storage, sizeof(storage), std::pmr::null_memory_resource());
+    {
+        rti::PmrPtr<rti::Consumer> consumer = rti::PmrNew<rti::Consumer>(&arena);
+        ASSERT_EQ(consumer->Create(desc, sizeof(uint64_t)), RTI_OK);
+        EXPECT_EQ(consumer->Recv(), RTI_ERR_QUEUE_EMPTY);
+        EXPECT_EQ(consumer->size(), 0u);
+        EXPECT_EQ(desc.ifx->lazy.attachCnt, 1u);
+    }
+    EXPECT_THROW(rti::PmrNew<rti::Consumer>(&arena)->Create(desc, sizeof(storage)), std::bad_alloc);
+}
+
+#endif
@@ -0,0 +1,137 @@
+/**
+ * @file vlan_lazy.cpp
+ * @author CYK-Dot
+ * @brief testcases for lazy instantiation and idle policy of VLANs
+ * @version 0.1
+ * @date 2026-10-16
+ *
+ * @copyright Copyright (c) 2025 CYK-Dot, MIT License.
+ */
+
+/* Header import ------------------------------------------------------------------*/
+#include <gtest/gtest.h>
+#include <thread>
+#include <vector>
+#include "rti_queue.h"
+
+/* Config macros ------------------------------------------------------------------*/
+#ifdef RTI_TEST_COMMON
+
+/* Mock variables and functions  --------------------------------------------------*/
+RTI_VLAN_REGISTER_STATIC_QOS_WITH_ID(LAZY_VLAN, 35, 8, sizeof(uint32_t), 1, RTI_QUEUE_SCHED_STRICT);
+
+/* Test suites --------------------------------------------------------------------*/
+
+/**
+ * @brief testcases for VLAN 35, created by handles only
+ *
+ */
+class VlanLazyTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        ASSERT_EQ(RTIPriv_VlanSelect(35, &desc), RTI_OK);
+        ASSERT_EQ(desc.ifx->lazy.vlan, nullptr);
+    }
+    void TearDown() override {
+        RTI_VlanIdleSet(35, RTI_VLAN_IDLE_KEEP);
+        desc.ifx->deleteF(desc.ifx->lazy.vlan);
+    }
+    RTI_VLAN_DESC desc;
+};
+
+/* Test cases ---------------------------------------------------------------------*/
+
+/**
+ * @brief the first handle creates the VLAN, it is kept by default after the last handle
+ *
+ */
+TEST_F(VlanLazyTest, KeepOnIdle) {
+    void *producer = desc.ifx->createProducerF();
+    ASSERT_NE(producer, nullptr);
+    void *vlan = desc.ifx->lazy.vlan;
+    ASSERT_NE(vlan, nullptr);
+    void *consumer = desc.ifx->createConsumerF();
+    ASSERT_NE(consumer, nullptr);
+    EXPECT_EQ(desc.ifx->lazy.vlan, vlan);
+    EXPECT_EQ(desc.ifx->lazy.attachCnt, 2u);
+
+    uint32_t msg = 5;
+    ASSERT_EQ(desc.ifx->sendF(producer, &msg, sizeof(msg), 0), RTI_OK);
+    desc.ifx->deleteProducerF(producer);
+    desc.ifx->deleteConsumerF(consumer);
+    EXPECT_EQ(desc.ifx->lazy.attachCnt, 0u);
+    ASSERT_EQ(desc.ifx->lazy.vlan, vlan);
+
+    consumer = desc.ifx->createConsumerF();
+    size_t size = sizeof(msg);
+    msg = 0;
+    ASSERT_EQ(desc.ifx->recvF(consumer, &msg, &size), RTI_OK);
+    EXPECT_EQ(msg, 5u) << "kept VLAN keeps its messages";
+    desc.ifx->deleteConsumerF(consumer);
+}
+
+/**
+ * @brief delete policy releases the VLAN on the last detach, unless createF pinned it
+ *
+ */
+TEST_F(VlanLazyTest, DeleteOnIdle) {
+    ASSERT_EQ(RTI_VlanIdleSet(35, RTI_VLAN_IDLE_DELETE), RTI_OK);
+    void *producer = desc.ifx->createProducerF();
+    void *consumer = desc.ifx->createConsumerF();
+    ASSERT_NE(producer, nullptr);
+    ASSERT_NE(consumer, nullptr);
+    desc.ifx->deleteProducerF(producer);
+    EXPECT_NE(desc.ifx->lazy.vlan, nullptr);
+    desc.ifx->deleteConsumerF(consumer);
+    EXPECT_EQ(desc.ifx->lazy.vlan, nullptr);
+
+    void *vlan = desc.ifx->createF();
+    ASSERT_NE(vlan, nullptr);
+    producer = desc.ifx->createProducerF();
+    EXPECT_EQ(desc.ifx->lazy.vlan, vlan);
+    desc.ifx->deleteProducerF(producer);
+    EXPECT_EQ(desc.ifx->lazy.vlan, vlan) << "pinned VLAN survives idle";
+    desc.ifx->deleteF(vlan);
+    EXPECT_EQ(desc.ifx->lazy.vlan, nullptr);
+}
+
+/**
+ * @brief threads racing on the first and last handle instantiate and release consistently
+ *
+ */
+TEST_F(VlanLazyTest, Concurrent) {
+    ASSERT_EQ(RTI_VlanIdleSet(35, RTI_VLAN_IDLE_DELETE), RTI_OK);
+    std::vector<std::thread> threads;
+    std::atomic<uint32_t> failed(0);
+    for (int t = 0; t < 4; t++) {
+        threads.emplace_back([&]() {
+            for (int i = 0; i < 2000; i++) {
+                void *producer = desc.ifx->createProducerF();
+                if (producer == nullptr) {
+                    failed++;
+                    continue;
+                }
+                uint32_t msg = (uint32_t)i;
+                desc.ifx->sendF(producer, &msg, sizeof(msg), 0);
+                desc.ifx->deleteProducerF(producer);
+            }
+        });
+    }
+    for (auto &thread : threads) {
+        thread.join();
+    }
+    EXPECT_EQ(failed.load(), 0u);
+    EXPECT_EQ(desc.ifx->lazy.attachCnt, 0u);
+    EXPECT_EQ(desc.ifx->lazy.vlan, nullptr);
+}
+
+/**
+ * @brief unknown VLAN and policy should be rejected
+ *
+ */
+TEST_F(VlanLazyTest, Invalid) {
+    EXPECT_EQ(RTI_VlanIdleSet(35, RTI_VLAN_IDLE_DELETE + 1), RTI_ERR_INVALID_PARAM);
+    EXPECT_NE(RTI_VlanIdleSet(0x7FFF, RTI_VLAN_IDLE_KEEP), RTI_OK);
+}
+
+#endif
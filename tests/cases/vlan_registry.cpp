@@ -0,0 +1,65 @@
+/**
+ * @file vlan_registry.cpp
+ * @author CYK-Dot
+ * @brief testcases for the generated constexpr VLAN registry
+ * @version 0.1
+ * @date 2026-10-16
+ *
+ * @copyright Copyright (c) 2025 CYK-Dot, MIT License.
+ */
+
+/* Header import ------------------------------------------------------------------*/
+#include <gtest/gtest.h>
+#include <cstring>
+#include "rti_vlan.h"
+#include "test_vlanid.h"
+#include "test_vlan_registry.hpp"
+
+/* Config macros ------------------------------------------------------------------*/
+#ifdef RTI_TEST_VLAN_TABLE_GENERATE
+
+/* Mock variables and functions  --------------------------------------------------*/
+
+/**
+ * @brief true if the name of T is found by a constant lookup
+ *
+ */
+template <class T, RTI_VlanId = rti::registry::test_cases::IdOf(T::name)>
+constexpr bool TestRegistryIsKnown(int) { return true; }
+template <class T>
+constexpr bool TestRegistryIsKnown(...) { return false; }
+
+struct TestRegistryKnown { static constexpr const char name[] = "AUTO_VLAN2"; };
+struct TestRegistryUnknown { static constexpr const char name[] = "AUTO_VLAN3"; };
+
+/* Compile time checks ------------------------------------------------------------*/
+static_assert(rti::registry::test_cases::IdOf("AUTO_VLAN1") == RTI_VLANID_AUTO_VLAN1, "lookup by name");
+static_assert(rti::registry::test_cases::IdOf("AUTO_VLAN2") == RTI_VLANID_AUTO_VLAN2, "lookup by name");
+static_assert(TestRegistryIsKnown<TestRegistryKnown>(0), "known name is a constant");
+static_assert(TestRegistryIsKnown<TestRegistryUnknown>(0) == false, "unknown name is not a constant");
+static_assert(rti::Vlan<RTI_VLANID_AUTO_VLAN1>::id == 100, "id of specialization");
+static_assert(rti::RegistryNameEqual(rti::Vlan<RTI_VLANID_AUTO_VLAN2>::name, "AUTO_VLAN2"), "name of specialization");
+
+/* Test cases ---------------------------------------------------------------------*/
+
+/**
+ * @brief the registry refers to the same descriptors as the VLAN table
+ *
+ */
+TEST(VlanRegistryTest, DescMatchesTable) {
+    RTI_VLAN_DESC desc;
+    ASSERT_EQ(RTIPriv_VlanSelect(RTI_VLANID_AUTO_VLAN1, &desc), RTI_OK);
+    const RTI_VLAN_DESC &registered = rti::VlanDesc<RTI_VLANID_AUTO_VLAN1>();
+    EXPECT_EQ(registered.ifx, desc.ifx);
+    EXPECT_EQ(registered.id, desc.id);
+    EXPECT_STREQ(registered.name, desc.name);
+
+    ASSERT_EQ(RTIPriv_VlanSelect(rti::registry::test_cases::IdOf("AUTO_VLAN2"), &desc), RTI_OK);
+    EXPECT_EQ(rti::Vlan<RTI_VLANID_AUTO_VLAN2>::Desc().ifx, desc.ifx);
+    EXPECT_STREQ(rti::Vlan<RTI_VLANID_AUTO_VLAN2>::name, desc.name);
+
+    const char *unknown = "AUTO_VLAN3";
+    EXPECT_EQ(rti::registry::test_cases::IdOf(unknown), 0) << "runtime lookup reports not found";
+}
+
+#endif